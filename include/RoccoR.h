@@ -146,6 +146,7 @@ class RoccoR{
 	int etaBin(double eta) const;
 	int phiBin(double phi) const;
 	template <typename T> double error(T f) const;
+	void kScale(TYPE T, int size, const int* Q, const double* pt, const double* eta, const double* phi, double* k, int s, int m) const;
 
     public:
 	RoccoR(); 
@@ -164,6 +165,11 @@ class RoccoR{
 	double kSpreadMC(int Q, double pt, double eta, double phi, double gt, int s=0, int m=0) const;
 	double kSmearMC(int Q, double pt, double eta, double phi, int n, double u, int s=0, int m=0) const;
 
+	// The same for size muons at once, from arrays of their properties.
+	// MC muons with a gen match (gt>0) are spread, the rest smeared with u.
+	void kScaleDT(int size, const int* Q, const double* pt, const double* eta, const double* phi, double* k, int s=0, int m=0) const;
+	void kCorrectMC(int size, const int* Q, const double* pt, const double* eta, const double* phi, const int* n, const double* gt, const double* u, double* k, int s=0, int m=0) const;
+
 	double kScaleDTerror(int Q, double pt, double eta, double phi) const;
 	double kSpreadMCerror(int Q, double pt, double eta, double phi, double gt) const;
 	double kSmearMCerror(int Q, double pt, double eta, double phi, int n, double u) const;
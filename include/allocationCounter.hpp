@@ -0,0 +1,17 @@
+#ifndef _allocationCounter_hpp_
+#define _allocationCounter_hpp_
+
+// Counts the heap allocations made through the global operator new, in the
+// executables that replace it with the counting version in
+// allocationCounterHooks.hpp. Elsewhere the count stays at zero and the
+// allocation functions are the standard library's. The counts are per
+// thread, so the difference across a call is what that call allocated even
+// while other threads are running.
+namespace AllocationCounter {
+    // Allocations made by the calling thread so far
+    [[gnu::pure]] long long count();
+    // Called by the replacement operator new
+    void record() noexcept;
+} // namespace AllocationCounter
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef _allocationCounterHooks_hpp_
+#define _allocationCounterHooks_hpp_
+
+#include "allocationCounter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+// Replacements for the global allocation functions that count for
+// AllocationCounter. Include in the one source file of the executables that
+// want the counts (analysisMain), so the others keep the standard ones. The
+// aligned versions are left to the standard library, which pairs them with
+// its own deletes.
+
+namespace AllocationCounter
+{
+    inline void* countedAlloc(std::size_t size) {
+        record();
+        // malloc(0) may return nullptr, which operator new must not
+        return std::malloc(size ? size : 1);
+    }
+} // namespace AllocationCounter
+
+void* operator new(std::size_t size) {
+    void* ptr{AllocationCounter::countedAlloc(size)};
+    if (!ptr) {
+        throw std::bad_alloc{};
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return AllocationCounter::countedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return AllocationCounter::countedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+#endif
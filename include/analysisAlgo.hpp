@@ -1,12 +1,17 @@
 #ifndef _analysisAlgo_hpp_
 #define _analysisAlgo_hpp_
 
+#include "config_parser.hpp"
 #include "cutClass.hpp"
 #include "dataset.hpp"
 #include "histogramPlotter.hpp"
+#include "scaleFactorTable.hpp"
 
+#include <algorithm>
+#include <array>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 class TH1D;
@@ -28,9 +33,22 @@ class AnalysisAlgo
     void runMainAnalysis();
     void savePlots();
 
+    // Pileup weights of the era, built once per process
+    static const ScaleFactorTable& loadPileupWeights(const bool is2016, const bool is2016APV, const bool is2018);
+
     private:
     // functions
     std::string channelSetup(unsigned);
+    void setupReadCache(TChain* chain) const;
+    // Pileup weights of an event, looked up by its number of vertices
+    const ScaleFactorTable::entry& pileupWeights(const int numVert) const {
+        if (numVert < 0) {
+            return pileupWeights_.at(numVert);
+        }
+        return pileupWeightsByNumVert_[std::min(static_cast<size_t>(numVert), pileupWeightsByNumVert_.size() - 1)];
+    }
+    // Throws unless the weights match those of the pileup histograms
+    void checkPileupWeights(const int numVert, const ScaleFactorTable::entry& weights) const;
 
     // variables?
     std::string config;
@@ -72,6 +90,17 @@ class AnalysisAlgo
     bool doZplusCR_;
     bool noData_;
     bool unblind_;
+    bool useBranchManifest_;
+    bool lazyLoading_;
+    bool countAllocations_;
+    bool validatePileup_;
+    unsigned numThreads_;
+    unsigned plotProcesses_;
+    readCacheSettings readCache_;
+    std::string systematicsConf_;
+    SystematicsRegistry systematics_;
+    // Conditions snapshot to read instead of the ROOT files, if any
+    std::string conditionsSnapshot_;
 
     std::vector<Dataset> datasets;
     double totalLumi;
@@ -106,17 +135,13 @@ class AnalysisAlgo
     // Systematic Stuff
     // Making a vector of strings that will give systematics name.
     std::vector<std::string> systNames;
-    TFile* dataPileupFile;
-    TH1D* dataPU;
-    TFile* mcPileupFile;
-    TH1D* mcPU;
-    TFile* systUpFile;
-    TH1D* pileupUpHist;
-    TFile* systDownFile;
-    TH1D* pileupDownHist;
-    TH1D* puReweight;
-    TH1D* puSystUp;
-    TH1D* puSystDown;
+    // Pileup weights and their up and down variations
+    ScaleFactorTable pileupWeights_;
+    // The same for each numVert from 0, the last being the overflow bin, so
+    // the event loop indexes them rather than searching the bins
+    std::vector<ScaleFactorTable::entry> pileupWeightsByNumVert_;
+    // Nominal, up and down data over MC histograms, for --validatePileup
+    std::array<std::unique_ptr<TH1D>, 3> pileupHistos_;
 
     // MC weight stuff
     double sumPositiveWeights_;
@@ -0,0 +1,809 @@
+#ifndef _analysisEventSchema_hpp_
+#define _analysisEventSchema_hpp_
+
+#include <cstddef>
+#include <stdexcept>
+
+// Branch schema of the ntuples. Each list calls S(type, name, condition) for
+// a scalar branch and A(type, name, size, condition) for an array, in file
+// order. An event type expands the lists it reads into both its members (the
+// value and its TBranch pointer) and its SetBranchAddress calls, so the two
+// can't drift apart, and a type that leaves a list out doesn't carry it. To
+// read another branch, add it to its list.
+//
+// In the ntuples but not read: the tau, photon, out of time photon and
+// isolated track collections, and the 2017 data scouting triggers.
+
+// The ntuples a branch is found in. The eras are exclusive: 2016 ntuples are
+// never also 2018 ones.
+enum class BranchCondition
+{
+    always,
+    mc,
+    mcNot2016,
+    not2016,
+    only2016,
+    only2017,
+    only2018
+};
+
+[[gnu::const]] inline bool readsBranch(const BranchCondition condition, const bool isMC, const bool is2016, const bool is2018) {
+    switch (condition) {
+        case BranchCondition::always: return true;
+        case BranchCondition::mc: return isMC;
+        case BranchCondition::mcNot2016: return isMC && !is2016;
+        case BranchCondition::not2016: return !is2016;
+        case BranchCondition::only2016: return is2016;
+        case BranchCondition::only2017: return !is2016 && !is2018;
+        case BranchCondition::only2018: return !is2016 && is2018;
+        default: throw std::logic_error("Unknown branch condition");
+    }
+}
+
+// Most entries each array collection holds
+#define ANALYSISEVENT_COLLECTION_SIZES(X) \
+    X(NELECTRONSMAX, 30)                  \
+    X(NMUONSMAX, 20)                      \
+    X(NMUONTKPAIRMAX, 100)                \
+    X(NJETSMAX, 40)                       \
+    X(NPACKEDCANDSMAX, 3000)              \
+    X(NCHSTKPAIRMAX, 350)                 \
+    X(NPVSMAX, 80)                        \
+    X(NSVSMAX, 20)                        \
+    X(NTRIGGERBITSMAX, 700)               \
+    X(NGENPARMAX, 1000)
+
+#define ANALYSISEVENT_DECLARE_SIZE(name, size) static constexpr size_t name{size};
+
+// A branch a file doesn't have leaves its scalar at zero
+#define ANALYSISEVENT_DECLARE_SCALAR(type, name, condition) \
+    type name{};                                            \
+    TBranch* b_##name{};
+
+#define ANALYSISEVENT_DECLARE_ARRAY(type, name, size, condition) \
+    type name[size];                                             \
+    TBranch* b_##name{};
+
+// Bind to TTree* tree, for the bools isMC, is2016 and is2018 in scope
+#define ANALYSISEVENT_BIND_SCALAR(type, name, condition)                  \
+    if (readsBranch(BranchCondition::condition, isMC, is2016, is2018)) { \
+        tree->SetBranchAddress(#name, &name, &b_##name);                 \
+    }
+
+#define ANALYSISEVENT_BIND_ARRAY(type, name, size, condition)             \
+    if (readsBranch(BranchCondition::condition, isMC, is2016, is2018)) { \
+        tree->SetBranchAddress(#name, name, &b_##name);                  \
+    }
+
+// Electrons, and the generator electrons matched to them
+// In the ntuples but not read: elePF2PATMvaIdWpHzz, elePF2PATMvaIdNoIsoWp80,
+// elePF2PATMvaIdNoIsoWp90, elePF2PATMvaIdNoIsoWpLoose,
+// elePF2PATPhotonConversionTagCustom
+#define ANALYSISEVENT_ELECTRON_BRANCHES(S, A)                              \
+    S(Int_t, numElePF2PAT, always)                                         \
+    A(Float_t, elePF2PATE, NELECTRONSMAX, always)                          \
+    A(Float_t, elePF2PATET, NELECTRONSMAX, always)                         \
+    A(Float_t, elePF2PATPX, NELECTRONSMAX, always)                         \
+    A(Float_t, elePF2PATPY, NELECTRONSMAX, always)                         \
+    A(Float_t, elePF2PATPZ, NELECTRONSMAX, always)                         \
+    A(Float_t, elePF2PATPhi, NELECTRONSMAX, always)                        \
+    A(Float_t, elePF2PATTheta, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATEta, NELECTRONSMAX, always)                        \
+    A(Float_t, elePF2PATPT, NELECTRONSMAX, always)                         \
+    A(Int_t, elePF2PATCharge, NELECTRONSMAX, always)                       \
+    A(Int_t, elePF2PATCutIdVeto, NELECTRONSMAX, always)                    \
+    A(Int_t, elePF2PATCutIdLoose, NELECTRONSMAX, always)                   \
+    A(Int_t, elePF2PATCutIdMedium, NELECTRONSMAX, always)                  \
+    A(Int_t, elePF2PATCutIdTight, NELECTRONSMAX, always)                   \
+    A(Int_t, elePF2PATMvaIdWp80, NELECTRONSMAX, always)                    \
+    A(Int_t, elePF2PATMvaIdWp90, NELECTRONSMAX, always)                    \
+    A(Int_t, elePF2PATMvaIdWpLoose, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATImpactTransDist, NELECTRONSMAX, always)            \
+    A(Float_t, elePF2PATImpactTransError, NELECTRONSMAX, always)           \
+    A(Float_t, elePF2PATImpactTransSignificance, NELECTRONSMAX, always)    \
+    A(Float_t, elePF2PATImpact3DDist, NELECTRONSMAX, always)               \
+    A(Float_t, elePF2PATImpact3DError, NELECTRONSMAX, always)              \
+    A(Float_t, elePF2PATImpact3DSignificance, NELECTRONSMAX, always)       \
+    A(Float_t, elePF2PATChargedHadronIso, NELECTRONSMAX, always)           \
+    A(Float_t, elePF2PATNeutralHadronIso, NELECTRONSMAX, always)           \
+    A(Float_t, elePF2PATPhotonIso, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATTrackPt, NELECTRONSMAX, always)                    \
+    A(Float_t, elePF2PATTrackPhi, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATTrackEta, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATTrackChi2, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATTrackNDOF, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATTrackD0, NELECTRONSMAX, always)                    \
+    A(Float_t, elePF2PATTrackDBD0, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATD0PV, NELECTRONSMAX, always)                       \
+    A(Float_t, elePF2PATDZPV, NELECTRONSMAX, always)                       \
+    A(Float_t, elePF2PATBeamSpotCorrectedTrackD0, NELECTRONSMAX, always)   \
+    A(Float_t, elePF2PATTrackDz, NELECTRONSMAX, always)                    \
+    A(Float_t, elePF2PATVtxZ, NELECTRONSMAX, always)                       \
+    A(Int_t, elePF2PATIsGsf, NELECTRONSMAX, always)                        \
+    A(Float_t, elePF2PATGsfPx, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATGsfPy, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATGsfPz, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATGsfE, NELECTRONSMAX, always)                       \
+    A(Float_t, elePF2PATEcalEnergy, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATSCEta, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATSCE, NELECTRONSMAX, always)                        \
+    A(Float_t, elePF2PATSCPhi, NELECTRONSMAX, always)                      \
+    A(Float_t, elePF2PATSCEoverP, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATSCSigmaEtaEta, NELECTRONSMAX, always)              \
+    A(Float_t, elePF2PATSCSigmaIEtaIEta, NELECTRONSMAX, always)            \
+    A(Float_t, elePF2PATSCSigmaIEtaIEta5x5, NELECTRONSMAX, always)         \
+    A(Float_t, elePF2PATSCE1x5, NELECTRONSMAX, always)                     \
+    A(Float_t, elePF2PATSCE5x5, NELECTRONSMAX, always)                     \
+    A(Float_t, elePF2PATSCE2x5max, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATTrackIso04, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATEcalIso04, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATHcalIso04, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATTrackIso03, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATEcalIso03, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATHcalIso03, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATdr04EcalRecHitSumEt, NELECTRONSMAX, always)        \
+    A(Float_t, elePF2PATdr03EcalRecHitSumEt, NELECTRONSMAX, always)        \
+    A(Float_t, elePF2PATEcalIsoDeposit, NELECTRONSMAX, always)             \
+    A(Float_t, elePF2PATHcalIsoDeposit, NELECTRONSMAX, always)             \
+    A(Float_t, elePF2PATComRelIso, NELECTRONSMAX, always)                  \
+    A(Float_t, elePF2PATComRelIsodBeta, NELECTRONSMAX, always)             \
+    A(Float_t, elePF2PATComRelIsoRho, NELECTRONSMAX, always)               \
+    A(Float_t, elePF2PATChHadIso, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATNtHadIso, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATGammaIso, NELECTRONSMAX, always)                   \
+    A(Float_t, elePF2PATRhoIso, NELECTRONSMAX, always)                     \
+    A(Float_t, elePF2PATAEff03, NELECTRONSMAX, always)                     \
+    A(Int_t, elePF2PATMissingInnerLayers, NELECTRONSMAX, always)           \
+    A(Float_t, elePF2PATHoverE, NELECTRONSMAX, always)                     \
+    A(Float_t, elePF2PATDeltaPhiSC, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATDeltaEtaSC, NELECTRONSMAX, always)                 \
+    A(Float_t, elePF2PATDeltaEtaSeedSC, NELECTRONSMAX, always)             \
+    A(Int_t, elePF2PATIsBarrel, NELECTRONSMAX, always)                     \
+    A(Int_t, elePF2PATPhotonConversionTag, NELECTRONSMAX, always)          \
+    A(Float_t, elePF2PATPhotonConversionDist, NELECTRONSMAX, always)       \
+    A(Float_t, elePF2PATPhotonConversionDcot, NELECTRONSMAX, always)       \
+    A(Int_t, elePF2PATPhotonConversionVeto, NELECTRONSMAX, always)         \
+    A(Float_t, elePF2PATPhotonConversionDistCustom, NELECTRONSMAX, always) \
+    A(Float_t, elePF2PATPhotonConversionDcotCustom, NELECTRONSMAX, always) \
+    A(Float_t, elePF2PATTriggerMatch, NELECTRONSMAX, always)               \
+    A(Float_t, elePF2PATJetOverlap, NELECTRONSMAX, always)                 \
+    A(Int_t, elePF2PATNumSourceCandidates, NELECTRONSMAX, always)          \
+    A(Int_t, elePF2PATPackedCandIndex, NELECTRONSMAX, always)              \
+    A(Float_t, genElePF2PATPT, NELECTRONSMAX, mc)                          \
+    A(Float_t, genElePF2PATET, NELECTRONSMAX, mc)                          \
+    A(Float_t, genElePF2PATPX, NELECTRONSMAX, mc)                          \
+    A(Float_t, genElePF2PATPY, NELECTRONSMAX, mc)                          \
+    A(Float_t, genElePF2PATPZ, NELECTRONSMAX, mc)                          \
+    A(Float_t, genElePF2PATPhi, NELECTRONSMAX, mc)                         \
+    A(Float_t, genElePF2PATTheta, NELECTRONSMAX, mc)                       \
+    A(Float_t, genElePF2PATEta, NELECTRONSMAX, mc)                         \
+    A(Int_t, genElePF2PATCharge, NELECTRONSMAX, mc)                        \
+    A(Int_t, genElePF2PATPdgId, NELECTRONSMAX, mc)                         \
+    A(Int_t, genElePF2PATMotherId, NELECTRONSMAX, mc)                      \
+    A(Int_t, genElePF2PATPromptDecayed, NELECTRONSMAX, mc)                 \
+    A(Int_t, genElePF2PATPromptFinalState, NELECTRONSMAX, mc)              \
+    A(Int_t, genElePF2PATHardProcess, NELECTRONSMAX, mc)                   \
+    A(Int_t, genElePF2PATPythiaSixStatusThree, NELECTRONSMAX, mc)          \
+    A(Int_t, genElePF2PATScalarAncestor, NELECTRONSMAX, mc)                \
+    A(Int_t, genElePF2PATDirectScalarAncestor, NELECTRONSMAX, mc)
+
+// Muons, and the generator muons matched to them
+#define ANALYSISEVENT_MUON_BRANCHES(S, A)                            \
+    S(Int_t, numMuonPF2PAT, always)                                  \
+    A(Float_t, muonPF2PATE, NMUONSMAX, always)                       \
+    A(Float_t, muonPF2PATET, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATPt, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATPX, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATPY, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATPZ, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATPhi, NMUONSMAX, always)                     \
+    A(Float_t, muonPF2PATTheta, NMUONSMAX, always)                   \
+    A(Float_t, muonPF2PATEta, NMUONSMAX, always)                     \
+    A(Int_t, muonPF2PATCharge, NMUONSMAX, always)                    \
+    A(Int_t, muonPF2PATLooseCutId, NMUONSMAX, always)                \
+    A(Int_t, muonPF2PATMediumCutId, NMUONSMAX, always)               \
+    A(Int_t, muonPF2PATTightCutId, NMUONSMAX, always)                \
+    A(Int_t, muonPF2PATPfIsoVeryLoose, NMUONSMAX, not2016)           \
+    A(Int_t, muonPF2PATPfIsoLoose, NMUONSMAX, not2016)               \
+    A(Int_t, muonPF2PATPfIsoMedium, NMUONSMAX, not2016)              \
+    A(Int_t, muonPF2PATPfIsoTight, NMUONSMAX, not2016)               \
+    A(Int_t, muonPF2PATPfIsoVeryTight, NMUONSMAX, not2016)           \
+    A(Int_t, muonPF2PATTkIsoLoose, NMUONSMAX, not2016)               \
+    A(Int_t, muonPF2PATTkIsoTight, NMUONSMAX, not2016)               \
+    A(Int_t, muonPF2PATMvaLoose, NMUONSMAX, not2016)                 \
+    A(Int_t, muonPF2PATMvaMedium, NMUONSMAX, not2016)                \
+    A(Int_t, muonPF2PATMvaTight, NMUONSMAX, not2016)                 \
+    A(Float_t, muonPF2PATGlobalID, NMUONSMAX, always)                \
+    A(Float_t, muonPF2PATTrackID, NMUONSMAX, always)                 \
+    A(Float_t, muonPF2PATChi2, NMUONSMAX, always)                    \
+    A(Float_t, muonPF2PATD0, NMUONSMAX, always)                      \
+    A(Float_t, muonPF2PATTrackDBD0, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATDBInnerTrackD0, NMUONSMAX, always)          \
+    A(Float_t, muonPF2PATBeamSpotCorrectedD0, NMUONSMAX, always)     \
+    A(Int_t, muonPF2PATTrackNHits, NMUONSMAX, always)                \
+    A(Int_t, muonPF2PATMuonNHits, NMUONSMAX, always)                 \
+    A(Float_t, muonPF2PATNDOF, NMUONSMAX, always)                    \
+    A(Float_t, muonPF2PATVertX, NMUONSMAX, always)                   \
+    A(Float_t, muonPF2PATVertY, NMUONSMAX, always)                   \
+    A(Float_t, muonPF2PATVertZ, NMUONSMAX, always)                   \
+    A(Float_t, muonPF2PATInnerTkPt, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATInnerTkPx, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATInnerTkPy, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATInnerTkPz, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATInnerTkEta, NMUONSMAX, always)              \
+    A(Float_t, muonPF2PATInnerTkPhi, NMUONSMAX, always)              \
+    A(Float_t, muonPF2PATChargedHadronIso, NMUONSMAX, always)        \
+    A(Float_t, muonPF2PATNeutralHadronIso, NMUONSMAX, always)        \
+    A(Float_t, muonPF2PATPhotonIso, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATTrackIso, NMUONSMAX, always)                \
+    A(Float_t, muonPF2PATEcalIso, NMUONSMAX, always)                 \
+    A(Float_t, muonPF2PATHcalIso, NMUONSMAX, always)                 \
+    A(Float_t, muonPF2PATComRelIso, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATComRelIsodBeta, NMUONSMAX, always)          \
+    A(Int_t, muonPF2PATIsPFMuon, NMUONSMAX, always)                  \
+    A(Int_t, muonPF2PATNChambers, NMUONSMAX, always)                 \
+    A(Int_t, muonPF2PATNMatches, NMUONSMAX, always)                  \
+    A(Int_t, muonPF2PATTkLysWithMeasurements, NMUONSMAX, always)     \
+    A(Float_t, muonPF2PATGlbTkNormChi2, NMUONSMAX, always)           \
+    A(Float_t, muonPF2PATInnerTkNormChi2, NMUONSMAX, always)         \
+    A(Float_t, muonPF2PATValidFraction, NMUONSMAX, always)           \
+    A(Float_t, muonPF2PATChi2LocalPosition, NMUONSMAX, always)       \
+    A(Float_t, muonPF2PATTrkKick, NMUONSMAX, always)                 \
+    A(Float_t, muonPF2PATSegmentCompatibility, NMUONSMAX, always)    \
+    A(Float_t, muonPF2PATDBPV, NMUONSMAX, always)                    \
+    A(Float_t, muonPF2PATDBPVError, NMUONSMAX, always)               \
+    A(Float_t, muonPF2PATDZPV, NMUONSMAX, always)                    \
+    A(Float_t, muonPF2PATDZPVError, NMUONSMAX, always)               \
+    A(Int_t, muonPF2PATVldPixHits, NMUONSMAX, always)                \
+    A(Int_t, muonPF2PATMatchedStations, NMUONSMAX, always)           \
+    A(Float_t, muonPF2PATImpactTransDist, NMUONSMAX, always)         \
+    A(Float_t, muonPF2PATImpactTransError, NMUONSMAX, always)        \
+    A(Float_t, muonPF2PATImpactTransSignificance, NMUONSMAX, always) \
+    A(Float_t, muonPF2PATImpact3DDist, NMUONSMAX, always)            \
+    A(Float_t, muonPF2PATImpact3DError, NMUONSMAX, always)           \
+    A(Float_t, muonPF2PATImpact3DSignificance, NMUONSMAX, always)    \
+    A(Int_t, muonPF2PATNumSourceCandidates, NMUONSMAX, always)       \
+    A(Int_t, muonPF2PATPackedCandIndex, NMUONSMAX, always)           \
+    A(Float_t, genMuonPF2PATPT, NMUONSMAX, mc)                       \
+    A(Float_t, genMuonPF2PATET, NMUONSMAX, mc)                       \
+    A(Float_t, genMuonPF2PATPX, NMUONSMAX, mc)                       \
+    A(Float_t, genMuonPF2PATPY, NMUONSMAX, mc)                       \
+    A(Float_t, genMuonPF2PATPZ, NMUONSMAX, mc)                       \
+    A(Float_t, genMuonPF2PATPhi, NMUONSMAX, mc)                      \
+    A(Float_t, genMuonPF2PATTheta, NMUONSMAX, mc)                    \
+    A(Float_t, genMuonPF2PATEta, NMUONSMAX, mc)                      \
+    A(Int_t, genMuonPF2PATCharge, NMUONSMAX, mc)                     \
+    A(Int_t, genMuonPF2PATPdgId, NMUONSMAX, mc)                      \
+    A(Int_t, genMuonPF2PATMotherId, NMUONSMAX, mc)                   \
+    A(Int_t, genMuonPF2PATPromptDecayed, NMUONSMAX, mc)              \
+    A(Int_t, genMuonPF2PATPromptFinalState, NMUONSMAX, mc)           \
+    A(Int_t, genMuonPF2PATHardProcess, NMUONSMAX, mc)                \
+    A(Int_t, genMuonPF2PATPythiaSixStatusThree, NMUONSMAX, mc)       \
+    A(Int_t, genMuonPF2PATScalarAncestor, NMUONSMAX, mc)             \
+    A(Int_t, genMuonPF2PATDirectScalarAncestor, NMUONSMAX, mc)
+
+// Refitted muon track pairs
+#define ANALYSISEVENT_MUONTKPAIR_BRANCHES(S, A)                              \
+    S(Int_t, numMuonTrackPairsPF2PAT, always)                                \
+    A(Int_t, muonTkPairPF2PATIndex1, NMUONTKPAIRMAX, always)                 \
+    A(Int_t, muonTkPairPF2PATIndex2, NMUONTKPAIRMAX, always)                 \
+    A(Float_t, muonTkPairPF2PATTkVtxPx, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTkVtxPy, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTkVtxPz, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTkVtxP2, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTkVx, NMUONTKPAIRMAX, always)                 \
+    A(Float_t, muonTkPairPF2PATTkVy, NMUONTKPAIRMAX, always)                 \
+    A(Float_t, muonTkPairPF2PATTkVz, NMUONTKPAIRMAX, always)                 \
+    A(Float_t, muonTkPairPF2PATTkVtxCov00, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov01, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov02, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov10, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov11, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov12, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov20, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov21, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxCov22, NMUONTKPAIRMAX, always)           \
+    A(Float_t, muonTkPairPF2PATTkVtxChi2, NMUONTKPAIRMAX, always)            \
+    A(Float_t, muonTkPairPF2PATTkVtxNdof, NMUONTKPAIRMAX, always)            \
+    A(Float_t, muonTkPairPF2PATTkVtxTime, NMUONTKPAIRMAX, always)            \
+    A(Float_t, muonTkPairPF2PATTkVtxTimeError, NMUONTKPAIRMAX, always)       \
+    A(Float_t, muonTkPairPF2PATTkVtxAngleXY, NMUONTKPAIRMAX, always)         \
+    A(Float_t, muonTkPairPF2PATTkVtxDistMagXY, NMUONTKPAIRMAX, always)       \
+    A(Float_t, muonTkPairPF2PATTkVtxDistMagXYSigma, NMUONTKPAIRMAX, always)  \
+    A(Float_t, muonTkPairPF2PATTkVtxAngleXYZ, NMUONTKPAIRMAX, always)        \
+    A(Float_t, muonTkPairPF2PATTkVtxDistMagXYZ, NMUONTKPAIRMAX, always)      \
+    A(Float_t, muonTkPairPF2PATTkVtxDistMagXYZSigma, NMUONTKPAIRMAX, always) \
+    A(Float_t, muonTkPairPF2PATTk1Pt, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk1Px, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk1Py, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk1Pz, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk1P2, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk1Eta, NMUONTKPAIRMAX, always)               \
+    A(Float_t, muonTkPairPF2PATTk1Phi, NMUONTKPAIRMAX, always)               \
+    A(Int_t, muonTkPairPF2PATTk1Charge, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTk1Chi2, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTk1Ndof, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTk2Pt, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk2Px, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk2Py, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk2Pz, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk2P2, NMUONTKPAIRMAX, always)                \
+    A(Float_t, muonTkPairPF2PATTk2Eta, NMUONTKPAIRMAX, always)               \
+    A(Float_t, muonTkPairPF2PATTk2Phi, NMUONTKPAIRMAX, always)               \
+    A(Int_t, muonTkPairPF2PATTk2Charge, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTk2Chi2, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTk2Ndof, NMUONTKPAIRMAX, always)              \
+    A(Float_t, muonTkPairPF2PATTkVtxDcaPreFit, NMUONTKPAIRMAX, always)
+
+// Jets, and the generator jets matched to them. 2016 ntuples call the
+// b tag discriminator jetPF2PATBDiscriminator, which AnalysisEvent binds by
+// hand.
+#define ANALYSISEVENT_JET_BRANCHES(S, A)                                                 \
+    S(Int_t, numJetPF2PAT, always)                                                       \
+    A(Double_t, jetPF2PATE, NJETSMAX, always)                                            \
+    A(Double_t, jetPF2PATEt, NJETSMAX, always)                                           \
+    A(Double_t, jetPF2PATPt, NJETSMAX, always)                                           \
+    A(Double_t, jetPF2PATPtRaw, NJETSMAX, always)                                        \
+    A(Double_t, jetPF2PATUnCorEt, NJETSMAX, always)                                      \
+    A(Double_t, jetPF2PATUnCorPt, NJETSMAX, always)                                      \
+    A(Double_t, jetPF2PATEta, NJETSMAX, always)                                          \
+    A(Double_t, jetPF2PATTheta, NJETSMAX, always)                                        \
+    A(Double_t, jetPF2PATPhi, NJETSMAX, always)                                          \
+    A(Double_t, jetPF2PATPx, NJETSMAX, always)                                           \
+    A(Double_t, jetPF2PATPy, NJETSMAX, always)                                           \
+    A(Double_t, jetPF2PATPz, NJETSMAX, always)                                           \
+    A(Double_t, jetPF2PATdRClosestLepton, NJETSMAX, always)                              \
+    A(Int_t, jetPF2PATNtracksInJet, NJETSMAX, always)                                    \
+    A(Float_t, jetPF2PATJetCharge, NJETSMAX, always)                                     \
+    A(Float_t, jetPF2PATfHPD, NJETSMAX, always)                                          \
+    A(Float_t, jetPF2PATBtagSoftMuonPtRel, NJETSMAX, always)                             \
+    A(Float_t, jetPF2PATBtagSoftMuonQuality, NJETSMAX, always)                           \
+    A(Float_t, jetPF2PATCorrFactor, NJETSMAX, always)                                    \
+    A(Float_t, jetPF2PATCorrResidual, NJETSMAX, always)                                  \
+    A(Float_t, jetPF2PATL2L3ResErr, NJETSMAX, always)                                    \
+    A(Float_t, jetPF2PATCorrErrLow, NJETSMAX, always)                                    \
+    A(Float_t, jetPF2PATCorrErrHi, NJETSMAX, always)                                     \
+    A(Float_t, jetPF2PATN90Hits, NJETSMAX, always)                                       \
+    A(Float_t, jetPF2PATTriggered, NJETSMAX, always)                                     \
+    A(Float_t, jetPF2PATSVX, NJETSMAX, always)                                           \
+    A(Float_t, jetPF2PATSVY, NJETSMAX, always)                                           \
+    A(Float_t, jetPF2PATSVZ, NJETSMAX, always)                                           \
+    A(Float_t, jetPF2PATSVDX, NJETSMAX, always)                                          \
+    A(Float_t, jetPF2PATSVDY, NJETSMAX, always)                                          \
+    A(Float_t, jetPF2PATSVDZ, NJETSMAX, always)                                          \
+    A(Float_t, jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags, NJETSMAX, not2016) \
+    A(Float_t, jetPF2PATpfCombinedCvsLJetTags, NJETSMAX, not2016)                        \
+    A(Float_t, jetPF2PATpfCombinedCvsBJetTags, NJETSMAX, not2016)                        \
+    A(Int_t, jetPF2PATNConstituents, NJETSMAX, always)                                   \
+    A(Int_t, jetPF2PATPID, NJETSMAX, always)                                             \
+    A(Float_t, jetPF2PATClosestBPartonDeltaR, NJETSMAX, always)                          \
+    A(Float_t, jetPF2PATClosestCPartonDeltaR, NJETSMAX, always)                          \
+    A(Float_t, genJetPF2PATE, NJETSMAX, mc)                                              \
+    A(Float_t, genJetPF2PATET, NJETSMAX, mc)                                             \
+    A(Float_t, genJetPF2PATPT, NJETSMAX, mc)                                             \
+    A(Float_t, genJetPF2PATPX, NJETSMAX, mc)                                             \
+    A(Float_t, genJetPF2PATPY, NJETSMAX, mc)                                             \
+    A(Float_t, genJetPF2PATPZ, NJETSMAX, mc)                                             \
+    A(Float_t, genJetPF2PATMass, NJETSMAX, mc)                                           \
+    A(Float_t, genJetPF2PATPhi, NJETSMAX, mc)                                            \
+    A(Float_t, genJetPF2PATTheta, NJETSMAX, mc)                                          \
+    A(Float_t, genJetPF2PATEta, NJETSMAX, mc)                                            \
+    A(Int_t, genJetPF2PATPID, NJETSMAX, mc)                                              \
+    A(Int_t, genJetPF2PATMotherPID, NJETSMAX, mc)                                        \
+    A(Int_t, genJetPF2PATScalarAncestor, NJETSMAX, mc)                                   \
+    A(Float_t, jetPF2PATMuEnergy, NJETSMAX, always)                                      \
+    A(Float_t, jetPF2PATMuEnergyFraction, NJETSMAX, always)                              \
+    A(Float_t, jetPF2PATNeutralHadEnergy, NJETSMAX, always)                              \
+    A(Float_t, jetPF2PATNeutralEmEnergy, NJETSMAX, always)                               \
+    A(Float_t, jetPF2PATChargedHadronEnergyFraction, NJETSMAX, always)                   \
+    A(Float_t, jetPF2PATNeutralHadronEnergyFraction, NJETSMAX, always)                   \
+    A(Float_t, jetPF2PATChargedEmEnergyFraction, NJETSMAX, always)                       \
+    A(Float_t, jetPF2PATNeutralEmEnergyFraction, NJETSMAX, always)                       \
+    A(Float_t, jetPF2PATMuonFraction, NJETSMAX, always)                                  \
+    A(Float_t, jetPF2PATChargedHadronEnergyFractionCorr, NJETSMAX, always)               \
+    A(Float_t, jetPF2PATNeutralHadronEnergyFractionCorr, NJETSMAX, always)               \
+    A(Float_t, jetPF2PATChargedEmEnergyFractionCorr, NJETSMAX, always)                   \
+    A(Float_t, jetPF2PATNeutralEmEnergyFractionCorr, NJETSMAX, always)                   \
+    A(Float_t, jetPF2PATMuonFractionCorr, NJETSMAX, always)                              \
+    A(Int_t, jetPF2PATNeutralMultiplicity, NJETSMAX, always)                             \
+    A(Int_t, jetPF2PATChargedMultiplicity, NJETSMAX, always)                             \
+    S(Float_t, fixedGridRhoFastjetAll, not2016)
+
+// Missing transverse energy
+#define ANALYSISEVENT_MET_BRANCHES(S, A)           \
+    S(Double_t, metPF2PATE, always)                \
+    S(Double_t, metPF2PATEt, always)               \
+    S(Double_t, metPF2PATEtRaw, always)            \
+    S(Double_t, metPF2PATPhi, always)              \
+    S(Double_t, metPF2PATPt, always)               \
+    S(Double_t, metPF2PATPx, always)               \
+    S(Double_t, metPF2PATPy, always)               \
+    S(Double_t, metPF2PATPz, always)               \
+    S(Float_t, metPF2PATScalarEt, always)          \
+    S(Float_t, metPF2PATEtUncorrected, always)     \
+    S(Float_t, metPF2PATPhiUncorrected, always)    \
+    S(Float_t, metPF2PATUnclusteredEnUp, always)   \
+    S(Float_t, metPF2PATUnclusteredEnDown, always) \
+    S(Float_t, genMetPF2PATE, mc)                  \
+    S(Float_t, genMetPF2PATEt, mc)                 \
+    S(Float_t, genMetPF2PATPhi, mc)                \
+    S(Float_t, genMetPF2PATPt, mc)                 \
+    S(Float_t, genMetPF2PATPx, mc)                 \
+    S(Float_t, genMetPF2PATPy, mc)                 \
+    S(Float_t, genMetPF2PATPz, mc)
+
+// Packed PF candidates
+// In the ntuples but not read:
+// packedCandsPt, packedCandsEta, packedCandsTheta, packedCandsPhi,
+// packedCandsVEta, packedCandsVPhi, packedCandsBeamSpotCorrectedD0,
+// packedCandsDzAssocPV, packedCandsVtxChi2Norm, packedCandsTauIndex,
+// packedCandsPseudoTrkPixelLayersWithMeasurement,
+// packedCandsPseudoTrkStripLayersWithMeasurement,
+// packedCandsPseudoTrkTrackerLayersWithMeasurement
+#define ANALYSISEVENT_PACKEDCANDS_BRANCHES(S, A)                               \
+    S(Int_t, numPackedCands, always)                                           \
+    A(Float_t, packedCandsPx, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsPy, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsPz, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsE, NPACKEDCANDSMAX, always)                          \
+    A(Int_t, packedCandsCharge, NPACKEDCANDSMAX, always)                       \
+    A(Int_t, packedCandsPdgId, NPACKEDCANDSMAX, always)                        \
+    A(Float_t, packedCandsTime, NPACKEDCANDSMAX, always)                       \
+    A(Int_t, packedCandsFromPV, NPACKEDCANDSMAX, always)                       \
+    A(Int_t, packedCandsPVquality, NPACKEDCANDSMAX, always)                    \
+    A(Float_t, packedCandsVx, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsVy, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsVz, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsDz, NPACKEDCANDSMAX, always)                         \
+    A(Float_t, packedCandsDxy, NPACKEDCANDSMAX, always)                        \
+    A(Int_t, packedCandsElectronIndex, NPACKEDCANDSMAX, always)                \
+    A(Int_t, packedCandsMuonIndex, NPACKEDCANDSMAX, always)                    \
+    A(Int_t, packedCandsPhotonIndex, NPACKEDCANDSMAX, always)                  \
+    A(Int_t, packedCandsJetIndex, NPACKEDCANDSMAX, always)                     \
+    A(Int_t, packedCandsHasTrackDetails, NPACKEDCANDSMAX, always)              \
+    A(Float_t, packedCandsDzError, NPACKEDCANDSMAX, always)                    \
+    A(Float_t, packedCandsDxyError, NPACKEDCANDSMAX, always)                   \
+    A(Float_t, packedCandsTimeError, NPACKEDCANDSMAX, always)                  \
+    A(Float_t, packedCandsPseudoTrkPt, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkPx, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkPy, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkPz, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkEta, NPACKEDCANDSMAX, always)               \
+    A(Float_t, packedCandsPseudoTrkPhi, NPACKEDCANDSMAX, always)               \
+    A(Int_t, packedCandsPseudoTrkCharge, NPACKEDCANDSMAX, always)              \
+    A(Float_t, packedCandsPseudoTrkVx, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkVy, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkVz, NPACKEDCANDSMAX, always)                \
+    A(Float_t, packedCandsPseudoTrkChi2Norm, NPACKEDCANDSMAX, always)          \
+    A(Int_t, packedCandsPseudoTrkNumberOfHits, NPACKEDCANDSMAX, always)        \
+    A(Int_t, packedCandsPseudoTrkNumberOfPixelHits, NPACKEDCANDSMAX, always)   \
+    A(Int_t, packedCandsHighPurityTrack, NPACKEDCANDSMAX, always)              \
+    A(Float_t, packedCandsTrkImpactTransDist, NPACKEDCANDSMAX, always)         \
+    A(Float_t, packedCandsTrkImpactTransError, NPACKEDCANDSMAX, always)        \
+    A(Float_t, packedCandsTrkImpactTransSignificance, NPACKEDCANDSMAX, always) \
+    A(Float_t, packedCandsTrkImpact3DDist, NPACKEDCANDSMAX, always)            \
+    A(Float_t, packedCandsTrkImpact3DError, NPACKEDCANDSMAX, always)           \
+    A(Float_t, packedCandsTrkImpact3DSignificance, NPACKEDCANDSMAX, always)
+
+// Refitted charged hadron track pairs
+#define ANALYSISEVENT_CHSTKPAIR_BRANCHES(S, A)                       \
+    S(Int_t, numChsTrackPairs, always)                               \
+    A(Int_t, chsTkPairIndex1, NCHSTKPAIRMAX, always)                 \
+    A(Int_t, chsTkPairIndex2, NCHSTKPAIRMAX, always)                 \
+    A(Float_t, chsTkPairTkVtxPx, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTkVtxPy, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTkVtxPz, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTkVtxP2, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTkVx, NCHSTKPAIRMAX, always)                 \
+    A(Float_t, chsTkPairTkVy, NCHSTKPAIRMAX, always)                 \
+    A(Float_t, chsTkPairTkVz, NCHSTKPAIRMAX, always)                 \
+    A(Float_t, chsTkPairTkVtxCov00, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov01, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov02, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov10, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov11, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov12, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov20, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov21, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxCov22, NCHSTKPAIRMAX, always)           \
+    A(Float_t, chsTkPairTkVtxChi2, NCHSTKPAIRMAX, always)            \
+    A(Float_t, chsTkPairTkVtxNdof, NCHSTKPAIRMAX, always)            \
+    A(Float_t, chsTkPairTkVtxTime, NCHSTKPAIRMAX, always)            \
+    A(Float_t, chsTkPairTkVtxTimeError, NCHSTKPAIRMAX, always)       \
+    A(Float_t, chsTkPairTkVtxAngleXY, NCHSTKPAIRMAX, always)         \
+    A(Float_t, chsTkPairTkVtxDistMagXY, NCHSTKPAIRMAX, always)       \
+    A(Float_t, chsTkPairTkVtxDistMagXYSigma, NCHSTKPAIRMAX, always)  \
+    A(Float_t, chsTkPairTkVtxAngleXYZ, NCHSTKPAIRMAX, always)        \
+    A(Float_t, chsTkPairTkVtxDistMagXYZ, NCHSTKPAIRMAX, always)      \
+    A(Float_t, chsTkPairTkVtxDistMagXYZSigma, NCHSTKPAIRMAX, always) \
+    A(Float_t, chsTkPairTk1Pt, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk1Px, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk1Py, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk1Pz, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk1P2, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk1Eta, NCHSTKPAIRMAX, always)               \
+    A(Float_t, chsTkPairTk1Phi, NCHSTKPAIRMAX, always)               \
+    A(Int_t, chsTkPairTk1Charge, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTk1Chi2, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTk1Ndof, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTk2Pt, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk2Px, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk2Py, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk2Pz, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk2P2, NCHSTKPAIRMAX, always)                \
+    A(Float_t, chsTkPairTk2Eta, NCHSTKPAIRMAX, always)               \
+    A(Float_t, chsTkPairTk2Phi, NCHSTKPAIRMAX, always)               \
+    A(Int_t, chsTkPairTk2Charge, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTk2Chi2, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTk2Ndof, NCHSTKPAIRMAX, always)              \
+    A(Float_t, chsTkPairTkVtxDcaPreFit, NCHSTKPAIRMAX, always)
+
+// Generator and process information, event weights, the beam spot, primary
+// and secondary vertices, MHT and the trigger bits
+#define ANALYSISEVENT_EVENT_BRANCHES(S, A)         \
+    S(Int_t, isElePlusJets, mc)                    \
+    S(Float_t, genPDFScale, mc)                    \
+    S(Float_t, genPDFx1, mc)                       \
+    S(Float_t, genPDFx2, mc)                       \
+    S(Int_t, genPDFf1, mc)                         \
+    S(Int_t, genPDFf2, mc)                         \
+    S(Double_t, topPtReweight, mc)                 \
+    S(Int_t, processId, always)                    \
+    S(Float_t, processPtHat, always)               \
+    S(Double_t, processMCWeight, always)           \
+    S(Float_t, beamSpotX, always)                  \
+    S(Float_t, beamSpotY, always)                  \
+    S(Float_t, beamSpotZ, always)                  \
+    S(Int_t, numPVs, always)                       \
+    A(Float_t, pvX, NPVSMAX, always)               \
+    A(Float_t, pvY, NPVSMAX, always)               \
+    A(Float_t, pvZ, NPVSMAX, always)               \
+    A(Float_t, pvCov00, NPVSMAX, always)           \
+    A(Float_t, pvCov01, NPVSMAX, always)           \
+    A(Float_t, pvCov02, NPVSMAX, always)           \
+    A(Float_t, pvCov10, NPVSMAX, always)           \
+    A(Float_t, pvCov11, NPVSMAX, always)           \
+    A(Float_t, pvCov12, NPVSMAX, always)           \
+    A(Float_t, pvCov20, NPVSMAX, always)           \
+    A(Float_t, pvCov21, NPVSMAX, always)           \
+    A(Float_t, pvCov22, NPVSMAX, always)           \
+    A(Float_t, pvRho, NPVSMAX, always)             \
+    A(Int_t, pvIsFake, NPVSMAX, always)            \
+    A(Float_t, pvNdof, NPVSMAX, always)            \
+    A(Float_t, pvChi2, NPVSMAX, always)            \
+    A(Float_t, pvNtracks, NPVSMAX, always)         \
+    A(Float_t, pvNtracksW05, NPVSMAX, always)      \
+    A(Float_t, pvTime, NPVSMAX, always)            \
+    A(Float_t, pvTimeError, NPVSMAX, always)       \
+    S(Int_t, numSVs, always)                       \
+    A(Float_t, svPt, NSVSMAX, always)              \
+    A(Float_t, svPx, NSVSMAX, always)              \
+    A(Float_t, svPy, NSVSMAX, always)              \
+    A(Float_t, svPz, NSVSMAX, always)              \
+    A(Float_t, svMass, NSVSMAX, always)            \
+    A(Float_t, svE, NSVSMAX, always)               \
+    A(Float_t, svEta, NSVSMAX, always)             \
+    A(Float_t, svTheta, NSVSMAX, always)           \
+    A(Float_t, svPhi, NSVSMAX, always)             \
+    A(Float_t, svX, NSVSMAX, always)               \
+    A(Float_t, svY, NSVSMAX, always)               \
+    A(Float_t, svZ, NSVSMAX, always)               \
+    A(Float_t, svCov00, NSVSMAX, always)           \
+    A(Float_t, svCov01, NSVSMAX, always)           \
+    A(Float_t, svCov02, NSVSMAX, always)           \
+    A(Float_t, svCov10, NSVSMAX, always)           \
+    A(Float_t, svCov11, NSVSMAX, always)           \
+    A(Float_t, svCov12, NSVSMAX, always)           \
+    A(Float_t, svCov20, NSVSMAX, always)           \
+    A(Float_t, svCov21, NSVSMAX, always)           \
+    A(Float_t, svCov22, NSVSMAX, always)           \
+    A(Float_t, svVertexChi2, NSVSMAX, always)      \
+    A(Float_t, svVertexNdof, NSVSMAX, always)      \
+    A(Int_t, svNtracks, NSVSMAX, always)           \
+    A(Float_t, svDist3D, NSVSMAX, always)          \
+    A(Float_t, svDist3DSig, NSVSMAX, always)       \
+    A(Float_t, svDist3DError, NSVSMAX, always)     \
+    A(Float_t, svDistXY, NSVSMAX, always)          \
+    A(Float_t, svDistXYSig, NSVSMAX, always)       \
+    A(Float_t, svDistXYError, NSVSMAX, always)     \
+    A(Float_t, svAnglePV, NSVSMAX, always)         \
+    A(Int_t, svIsLambda, NSVSMAX, always)          \
+    A(Int_t, svIsKshort, NSVSMAX, always)          \
+    S(Float_t, mhtPt, always)                      \
+    S(Float_t, mhtPy, always)                      \
+    S(Float_t, mhtPx, always)                      \
+    S(Float_t, mhtPhi, always)                     \
+    S(Float_t, mhtSumEt, always)                   \
+    S(Float_t, mhtSignif, always)                  \
+    S(Int_t, nTriggerBits, always)                 \
+    A(Int_t, TriggerBits, NTRIGGERBITSMAX, always) \
+    S(Double_t, weight_muF0p5, mc)                 \
+    S(Double_t, weight_muF2, mc)                   \
+    S(Double_t, weight_muR0p5, mc)                 \
+    S(Double_t, weight_muR2, mc)                   \
+    S(Double_t, weight_muF0p5muR0p5, mc)           \
+    S(Double_t, weight_muF2muR2, mc)               \
+    S(Double_t, origWeightForNorm, mc)             \
+    S(Double_t, weight_pdfMax, mc)                 \
+    S(Double_t, weight_pdfMin, mc)                 \
+    S(Double_t, weight_alphaMax, mc)               \
+    S(Double_t, weight_alphaMin, mc)               \
+    S(Double_t, isrRedHi, mcNot2016)               \
+    S(Double_t, fsrRedHi, mcNot2016)               \
+    S(Double_t, isrRedLo, mcNot2016)               \
+    S(Double_t, fsrRedLo, mcNot2016)               \
+    S(Double_t, isrDefHi, mcNot2016)               \
+    S(Double_t, fsrDefHi, mcNot2016)               \
+    S(Double_t, isrDefLo, mcNot2016)               \
+    S(Double_t, fsrDefLo, mcNot2016)               \
+    S(Double_t, isrConHi, mcNot2016)               \
+    S(Double_t, fsrConHi, mcNot2016)               \
+    S(Double_t, isrConLo, mcNot2016)               \
+    S(Double_t, fsrConLo, mcNot2016)
+
+// Generator particles
+#define ANALYSISEVENT_GENPARTICLE_BRANCHES(S, A)   \
+    S(Int_t, nGenPar, mc)                          \
+    A(Float_t, genParEta, NGENPARMAX, mc)          \
+    A(Float_t, genParPhi, NGENPARMAX, mc)          \
+    A(Float_t, genParE, NGENPARMAX, mc)            \
+    A(Float_t, genParPt, NGENPARMAX, mc)           \
+    A(Int_t, genParId, NGENPARMAX, mc)             \
+    A(Float_t, genParVx, NGENPARMAX, mc)           \
+    A(Float_t, genParVy, NGENPARMAX, mc)           \
+    A(Float_t, genParVz, NGENPARMAX, mc)           \
+    A(Int_t, genParMotherId, NGENPARMAX, mc)       \
+    A(Int_t, genParMotherIndex, NGENPARMAX, mc)    \
+    A(Int_t, genParNumDaughters, NGENPARMAX, mc)   \
+    A(Int_t, genParDaughterId1, NGENPARMAX, mc)    \
+    A(Int_t, genParDaughterId2, NGENPARMAX, mc)    \
+    A(Int_t, genParDaughter1Index, NGENPARMAX, mc) \
+    A(Int_t, genParDaughter2Index, NGENPARMAX, mc) \
+    A(Int_t, genParStatus, NGENPARMAX, mc)         \
+    A(Int_t, genParCharge, NGENPARMAX, mc)
+
+// Run, event and lumi block numbers and the number of vertices
+#define ANALYSISEVENT_EVENTINFO_BRANCHES(S, A) \
+    S(Int_t, eventRun, always)                 \
+    S(Int_t, eventNum, always)                 \
+    S(Float_t, eventLumiblock, always)         \
+    S(Int_t, numVert, always)
+
+// Muon triggers of each era, and the 2018 b parking triggers
+#define ANALYSISEVENT_TRIGGER_BRANCHES(S, A)                           \
+    S(Int_t, HLT_IsoMu24_v1, only2016)                                 \
+    S(Int_t, HLT_IsoMu24_v2, only2016)                                 \
+    S(Int_t, HLT_IsoMu24_v4, only2016)                                 \
+    S(Int_t, HLT_IsoTkMu24_v1, only2016)                               \
+    S(Int_t, HLT_IsoTkMu24_v2, only2016)                               \
+    S(Int_t, HLT_IsoTkMu24_v3, only2016)                               \
+    S(Int_t, HLT_IsoTkMu24_v4, only2016)                               \
+    S(Int_t, HLT_IsoMu27_v3, only2016)                                 \
+    S(Int_t, HLT_IsoMu27_v4, only2016)                                 \
+    S(Int_t, HLT_IsoMu27_v5, only2016)                                 \
+    S(Int_t, HLT_IsoMu27_v7, only2016)                                 \
+    S(Int_t, HLT_IsoTkMu27_v3, only2016)                               \
+    S(Int_t, HLT_IsoTkMu27_v4, only2016)                               \
+    S(Int_t, HLT_IsoTkMu27_v5, only2016)                               \
+    S(Int_t, HLT_IsoTkMu27_v6, only2016)                               \
+    S(Int_t, HLT_IsoTkMu27_v7, only2016)                               \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v2, only2016)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v3, only2016)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v4, only2016)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v7, only2016)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v2, only2016)       \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v3, only2016)       \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v6, only2016)       \
+    S(Int_t, HLT_DoubleMu33NoFiltersNoVtx_v2, only2016)                \
+    S(Int_t, HLT_DoubleMu33NoFiltersNoVtx_v3, only2016)                \
+    S(Int_t, HLT_DoubleMu33NoFiltersNoVtx_v5, only2016)                \
+    S(Int_t, HLT_DoubleMu23NoFiltersNoVtxDisplaced_v2, only2016)       \
+    S(Int_t, HLT_DoubleMu23NoFiltersNoVtxDisplaced_v3, only2016)       \
+    S(Int_t, HLT_DoubleMu23NoFiltersNoVtxDisplaced_v5, only2016)       \
+    S(Int_t, HLT_L2DoubleMu23_NoVertex_v2, only2016)                   \
+    S(Int_t, HLT_L2DoubleMu23_NoVertex_v3, only2016)                   \
+    S(Int_t, HLT_L2DoubleMu23_NoVertex_v4, only2016)                   \
+    S(Int_t, HLT_L2DoubleMu23_NoVertex_v6, only2016)                   \
+    S(Int_t, HLT_IsoMu24_v11, only2018)                                \
+    S(Int_t, HLT_IsoMu24_v12, only2018)                                \
+    S(Int_t, HLT_IsoMu24_v13, only2018)                                \
+    S(Int_t, HLT_IsoMu27_v14, not2016)                                 \
+    S(Int_t, HLT_IsoMu27_v15, only2018)                                \
+    S(Int_t, HLT_IsoMu27_v16, only2018)                                \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v4, not2016)  \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v5, only2018) \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v4, not2016)    \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v5, only2018)   \
+    S(Int_t, HLT_DoubleL2Mu50_v2, not2016)                             \
+    S(Int_t, HLT_DoubleL2Mu23NoVtx_2Cha_v1, only2018)                  \
+    S(Int_t, HLT_DoubleL2Mu23NoVtx_2Cha_v2, only2018)                  \
+    S(Int_t, HLT_DoubleL2Mu25NoVtx_2Cha_Eta2p4_v1, only2018)           \
+    S(Int_t, HLT_DoubleL2Mu25NoVtx_2Cha_Eta2p4_v2, only2018)           \
+    S(Int_t, HLT_DoubleL2Mu25NoVtx_2Cha_v1, only2018)                  \
+    S(Int_t, HLT_DoubleL2Mu25NoVtx_2Cha_v2, only2018)                  \
+    S(Int_t, HLT_DoubleL2Mu30NoVtx_2Cha_Eta2p4_v1, only2018)           \
+    S(Int_t, HLT_DoubleL2Mu30NoVtx_2Cha_Eta2p4_v2, only2018)           \
+    S(Int_t, HLT_DoubleMu33NoFiltersNoVtxDisplaced_v1, only2018)       \
+    S(Int_t, HLT_DoubleMu40NoFiltersNoVtxDisplaced_v1, only2018)       \
+    S(Int_t, HLT_DoubleMu43NoFiltersNoVtx_v3, not2016)                 \
+    S(Int_t, HLT_DoubleMu43NoFiltersNoVtx_v4, only2018)                \
+    S(Int_t, HLT_DoubleMu48NoFiltersNoVtx_v3, not2016)                 \
+    S(Int_t, HLT_DoubleMu48NoFiltersNoVtx_v4, only2018)                \
+    S(Int_t, HLT_IsoMu27_v8, only2017)                                 \
+    S(Int_t, HLT_IsoMu27_v9, only2017)                                 \
+    S(Int_t, HLT_IsoMu27_v10, only2017)                                \
+    S(Int_t, HLT_IsoMu27_v11, only2017)                                \
+    S(Int_t, HLT_IsoMu27_v12, only2017)                                \
+    S(Int_t, HLT_IsoMu27_v13, only2017)                                \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v8, only2017)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v9, only2017)         \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v10, only2017)        \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v11, only2017)        \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v12, only2017)        \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v13, only2017)        \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v14, only2017)        \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v1, only2017)   \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v2, only2017)   \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v3, only2017)   \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v7, only2017)   \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v8, only2017)   \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v1, only2017) \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v2, only2017) \
+    S(Int_t, HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v3, only2017) \
+    S(Int_t, HLT_DoubleMu43NoFiltersNoVtx_v2, only2017)                \
+    S(Int_t, HLT_DoubleMu48NoFiltersNoVtx_v2, only2017)                \
+    S(Int_t, HLT_DoubleL2Mu50_v1, only2017)                            \
+    S(Int_t, HLT_Mu12_IP6_part0_v2, only2018)                          \
+    S(Int_t, HLT_Mu12_IP6_part1_v2, only2018)                          \
+    S(Int_t, HLT_Mu12_IP6_part2_v2, only2018)                          \
+    S(Int_t, HLT_Mu12_IP6_part3_v2, only2018)                          \
+    S(Int_t, HLT_Mu12_IP6_part4_v2, only2018)                          \
+    S(Int_t, HLT_Mu9_IP5_part0_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP5_part1_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP5_part2_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP5_part3_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP5_part4_v2, only2018)                           \
+    S(Int_t, HLT_Mu7_IP4_part0_v2, only2018)                           \
+    S(Int_t, HLT_Mu7_IP4_part1_v2, only2018)                           \
+    S(Int_t, HLT_Mu7_IP4_part2_v2, only2018)                           \
+    S(Int_t, HLT_Mu7_IP4_part3_v2, only2018)                           \
+    S(Int_t, HLT_Mu7_IP4_part4_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP5_part0_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP5_part1_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP5_part2_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP5_part3_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP5_part4_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP6_part0_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP6_part1_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP6_part2_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP6_part3_v2, only2018)                           \
+    S(Int_t, HLT_Mu8_IP6_part4_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part0_v1, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part1_v1, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part2_v1, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part3_v1, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part4_v1, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part0_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part1_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part2_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part3_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part4_v2, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part0_v3, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part1_v3, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part2_v3, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part3_v3, only2018)                           \
+    S(Int_t, HLT_Mu9_IP6_part4_v3, only2018)
+
+// MET filters
+#define ANALYSISEVENT_METFILTER_BRANCHES(S, A)                \
+    S(Int_t, Flag_goodVertices, always)                       \
+    S(Int_t, Flag_globalTightHalo2016Filter, always)          \
+    S(Int_t, Flag_HBHENoiseFilter, always)                    \
+    S(Int_t, Flag_HBHENoiseIsoFilter, always)                 \
+    S(Int_t, Flag_EcalDeadCellTriggerPrimitiveFilter, always) \
+    S(Int_t, Flag_BadPFMuonFilter, always)                    \
+    S(Int_t, Flag_BadChargedCandidateFilter, always)          \
+    S(Int_t, Flag_eeBadScFilter, always)                      \
+    S(Int_t, Flag_ecalBadCalibFilter, always)
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef _binnedFormula_hpp_
+#define _binnedFormula_hpp_
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// A function of one variable, x, with its own parameters in each bin of one
+// or more binning variables, as in the JetMET JRDatabase text files and the
+// BTV CSV scale factor files. The formula is compiled once to a short postfix
+// program, and the parameters of every bin are stored one after the other,
+// so evaluating it is a bin lookup and a pass over the program. Values
+// outside the table are clamped to its edges, and x to the range of its bin.
+// A binning variable whose first edge is zero is looked up in absolute value,
+// so |eta| tables work with a signed eta.
+class BinnedFormula
+{
+    public:
+    BinnedFormula();
+
+    // JRDatabase resolution or scale factor file. For a scale factor file the
+    // formula is "None" and the parameters of a bin are the nominal, down and
+    // up values.
+    static BinnedFormula fromJRDatabase(const std::string& fileName);
+    // The BTV CSV records of one operating point, measurement, systematic and
+    // flavour, binned in eta and pT with x = pT. Their numeric constants
+    // become the parameters, so the records must share a form.
+    static BinnedFormula fromBTagCSV(const std::string& fileName,
+                                     const int operatingPoint,
+                                     const std::string& measurement,
+                                     const std::string& sysType,
+                                     const int flavour);
+
+    size_t numBinVariables() const {
+        return edges_.size();
+    }
+    size_t numParameters() const {
+        return numParameters_;
+    }
+    // vars holds one value per binning variable
+    [[gnu::pure]] size_t bin(const double* vars) const;
+    const double* parameters(const size_t bin) const {
+        return &parameters_[bin * numParameters_];
+    }
+
+    double evaluate(const double* vars, const double x) const;
+    // n points at once; vars[v] holds the n values of binning variable v
+    void evaluate(const double* const* vars, const double* x, const size_t n, double* result) const;
+
+    private:
+    enum class Code { x, constant, parameter, add, subtract, multiply, divide, negate, log, exp, sqrt, abs, pow, min, max };
+    struct op
+    {
+        Code code;
+        size_t index;
+        double value;
+    };
+    // Points evaluated together, and the deepest stack that needs
+    static constexpr size_t CHUNK{16};
+    static constexpr size_t MAX_STACK{16};
+
+    struct record
+    {
+        std::vector<double> binMin;
+        std::vector<double> binMax;
+        double xMin;
+        double xMax;
+        std::vector<double> parameters;
+    };
+
+    // With extractConstants, numeric literals become parameters, appended to
+    // constants in order
+    static std::vector<op> compile(const std::string& formula, const bool extractConstants, std::vector<double>& constants);
+    [[gnu::pure]] static bool sameForm(const std::vector<op>& a, const std::vector<op>& b);
+    // Values the operation pushes onto the stack, less those it pops
+    static int stackChange(const Code code);
+    void build(const std::vector<record>& records, const std::string& source);
+    void evaluateChunk(const size_t* bins, const double* x, const size_t n, double* result) const;
+
+    std::vector<op> program_;
+    size_t numParameters_;
+    // Edges of each binning variable, and the stride of its bins
+    std::vector<std::vector<double>> edges_;
+    std::vector<bool> absolute_;
+    std::vector<size_t> strides_;
+    // Per bin
+    std::vector<double> parameters_;
+    std::vector<double> xMin_;
+    std::vector<double> xMax_;
+};
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef _conditions_hpp_
+#define _conditions_hpp_
+
+#include "scaleFactorTable.hpp"
+
+#include <functional>
+#include <istream>
+#include <memory>
+#include <string>
+
+// Process wide store of the scale factors and other conditions a job reads
+// at startup. Tables built from ROOT files are built once per process and
+// shared by every Cuts object. With a snapshot, written by
+// makeConditionsSnapshot and memory mapped read only, the tables and text
+// files come out of the mapping instead, so a job neither opens the ROOT
+// files nor goes to the disk for each text file, and concurrent jobs on a
+// node share the pages.
+class Conditions
+{
+    public:
+    // Map a snapshot, which must have been written for the same era
+    static void useSnapshot(const std::string& fileName, const std::string& era);
+
+    // The named table, from the snapshot if it has one, else from build
+    static const ScaleFactorTable& table(const std::string& name, const std::function<ScaleFactorTable()>& build);
+    // A text file, from the snapshot if it has a copy, else from the disk.
+    // Check the stream as for an ifstream.
+    static std::unique_ptr<std::istream> open(const std::string& fileName);
+
+    // Write every table built and text file opened so far
+    static void writeSnapshot(const std::string& fileName, const std::string& era);
+
+    static std::string era(const bool is2016, const bool is2016APV, const bool is2018) {
+        return is2016 ? "2016" : is2016APV ? "2016APV" : is2018 ? "2018" : "2017";
+    }
+};
+
+#endif
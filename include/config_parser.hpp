@@ -10,6 +10,16 @@
 #include <string>
 #include <vector>
 
+// TTreeCache settings for the dataset chains, from the readCache block of the
+// main config
+struct readCacheSettings
+{
+    long long size{-1}; // bytes. Negative leaves ROOT's default alone
+    int learnEntries{100};
+    std::vector<std::string> branches{"*"};
+    bool asyncPrefetch{false};
+};
+
 namespace Parser {
     void parse_config(const std::string conf,
                       std::vector<Dataset>& datasets,
@@ -33,6 +43,8 @@ namespace Parser {
                       std::string&,
                       const bool = false,
                       const bool = false);
+    void parse_read_cache(const std::string conf, readCacheSettings& cache);
+    void parse_systematics(const std::string conf, std::string& systematicsConf);
     void parse_files(const std::vector<std::string> files,
                      std::vector<Dataset>& datasets,
                      double& lumi,
@@ -2,15 +2,23 @@
 #define _cutClass_hpp_
 
 #include "AnalysisEvent.hpp"
+#include "binnedFormula.hpp"
+#include "fourVector.hpp"
+#include "histogramBuffer.hpp"
+#include "jecUncertaintyTable.hpp"
 #include "RoccoR.h"
 #include "plots.hpp"
+#include "scaleFactorTable.hpp"
+#include "systematics.hpp"
 
 #include <TH1F.h>
 #include <TH2D.h>
 #include <TH2F.h>
-#include <TLorentzVector.h>
+#include <array>
 #include <fstream>
 #include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 class Cuts
@@ -20,37 +28,41 @@ class Cuts
                         double& eventWeight,
                         std::map<std::string, std::shared_ptr<Plots>>& plotMap,
                         TH1D& cutFlow,
-                        const int& syst);
-    std::pair<std::vector<int>, std::vector<double>> makeJetCuts(const AnalysisEvent& event,
-                    const int syst,
-                    double& eventWeight,
-                    const bool isProper = true) const;
-    [[gnu::pure]] std::vector<int> makeBCuts(const AnalysisEvent& event,
-                                             const std::vector<int> jets,
-                                             const int syst = 0) const;
-
-    [[gnu::pure]] std::vector<int> getTightEles(const AnalysisEvent& event) const;
-    [[gnu::pure]] std::vector<int> getLooseEles(const AnalysisEvent& event) const;
-    [[gnu::pure]] std::vector<int> getTightMuons(const AnalysisEvent& event) const;
-    [[gnu::pure]] std::vector<int> getLooseMuons(const AnalysisEvent& event) const;
-    [[gnu::pure]] std::vector<int> getChargedHadronTracks(const AnalysisEvent& event) const;
+                        const Systematic& syst);
+    // The selections below clear and refill the vectors they are given, so
+    // passing the same vectors every event keeps their capacity and the
+    // selection doesn't allocate once they have grown to size.
+    void makeJetCuts(const AnalysisEvent& event,
+                     const Systematic& syst,
+                     double& eventWeight,
+                     std::vector<int>& jets,
+                     std::vector<double>& smears,
+                     const bool isProper = true) const;
+    void makeBCuts(const AnalysisEvent& event,
+                   const std::vector<int>& jets,
+                   std::vector<int>& bJets,
+                   const Systematic& syst) const;
+
+    void getTightEles(const AnalysisEvent& event, std::vector<int>& electrons) const;
+    void getLooseEles(const AnalysisEvent& event, std::vector<int>& electrons) const;
+    void getTightMuons(const AnalysisEvent& event, std::vector<int>& muons) const;
+    void getLooseMuons(const AnalysisEvent& event, std::vector<int>& muons) const;
+    void getChargedHadronTracks(const AnalysisEvent& event, std::vector<int>& chs) const;
     bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons) const;
     bool getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) const;
     double getWbosonQuarksCand(AnalysisEvent& event,
                                const std::vector<int>& jets,
-                               const int& syst) const;
+                               const Systematic& syst) const;
 
     [[gnu::const]] double getTopMass(const AnalysisEvent& event) const;
-    bool triggerCuts(const AnalysisEvent& event,
-                     double& eventWeight,
-                     const int& syst = 0) const;
+    bool triggerCuts(const AnalysisEvent& event) const;
     [[gnu::const]] bool metFilters(const AnalysisEvent& event) const;
 
     std::vector<double> getRochesterSFs(const AnalysisEvent& event) const;
     // Function to get lepton SF
-    double getLeptonWeight(const AnalysisEvent& event, const int& syst) const;
-    double eleSF(const double& pt, const double& eta, const int& syst) const;
-    double muonSF(const double& pt, const double& eta, const int& syst, const bool& leadingMuon) const;
+    double getLeptonWeight(const AnalysisEvent& event, const Systematic& syst) const;
+    double eleSF(const double& pt, const double& eta, const Systematic& syst) const;
+    double muonSF(const double& pt, const double& eta, const Systematic& syst, const bool& leadingMuon) const;
 
     // grab the muon track pair index for selected muons
     int getMuonTrackPairIndex(const AnalysisEvent& event) const;
@@ -127,25 +139,25 @@ class Cuts
     // Rochester Corrections
     RoccoR rc_;
 
-    // Some things that will be used for JEC uncertainties.
-    std::vector<double> ptMinJEC_;
-    std::vector<double> ptMaxJEC_;
-    std::vector<double> etaMinJEC_;
-    std::vector<double> etaMaxJEC_;
-    std::vector<std::vector<double>> jecSFUp_;
-    std::vector<std::vector<double>> jecSFDown_;
+    // Shared by every copy of the cuts
+    std::shared_ptr<const JECUncertaintyTable> jecUncertainties_;
     void initialiseJECCors();
-    [[gnu::pure]] double getJECUncertainty(const double& pt,
-                                           const double& eta,
-                                           const int& syst) const;
-    std::pair<TLorentzVector, double> getJetLVec(const AnalysisEvent& event,
-                                                 const int& index,
-                                                 const int& syst,
-                                                 const bool& initialRun) const;
-    static double jet2016PtSimRes(const double& pt, const double& eta, const double& rho);
-    static double jet2017PtSimRes(const double& pt, const double& eta, const double& rho);
-    [[gnu::const]] static std::pair<double, double> jet2016SFs(const double& eta);
-    static std::pair<double, double> jet2017SFs(const double& eta);
+    // JEC uncertainty lookups made by this copy of the cuts
+    mutable long long jecLookups_;
+    double getJECUncertainty(const double& pt,
+                             const double& eta,
+                             const bool up) const;
+    static JetCorrectionCache::Variation jetVariation(const Systematic& syst);
+    // Jets of the event for the systematic, worked out on first use and
+    // cached in the event for every later stage and systematic
+    const JetCorrectionCache::jets& correctedJets(const AnalysisEvent& event,
+                                                  const Systematic& syst) const;
+    void fillJetResolutions(const AnalysisEvent& event, JetCorrectionCache& cache) const;
+    // JER resolutions in eta and rho as functions of pT, and scale factors
+    // in eta, from the JRDatabase text files
+    void initialiseJetSFs();
+    BinnedFormula jetResolutions_;
+    BinnedFormula jerSFs_;
 
     // Sets whether to do MC or data cuts. Set every time a new dataset is
     // processed in the main loop.
@@ -160,6 +172,9 @@ class Cuts
 
     // For producing post-lepsel skims
     TTree* postLepSelTree_;
+    // Whether the event passed by makeSharedCuts passes the hadron pair mass
+    // and side band cuts, which come after the per systematic plots
+    bool passesHadronMassCuts_;
 
     // For removing trigger cuts. Will be set to false by default
     bool skipTrigger_;
@@ -171,14 +186,18 @@ class Cuts
     bool makeBTagEffPlots_;
     // And the efficiency plots.
     std::vector<TH2D*> bTagEffPlots_;
+    // Efficiencies of b, c, light and gluon jets read from the plots
+    std::array<ScaleFactorTable, 4> bTagEffs_;
     bool getBTagWeight_;
+    // b-tag scale factors of b, c and light jets, each down, central and up
+    std::array<std::array<BinnedFormula, 3>, 3> bTagSFs_;
 
-    [[gnu::const]] double
-        getBSF(const int flavour, const int type, const double pt) const;
+    [[gnu::pure]] double getBSF(const int flavour, const int type, const double pt, const double eta) const;
 
     void getBWeight(const AnalysisEvent& event,
-                    const TLorentzVector& jet,
+                    const FourVector& jet,
                     const int& index,
+                    const int effBin,
                     double& mcTag,
                     double& mcNoTag,
                     double& dataTag,
@@ -209,30 +228,55 @@ class Cuts
     double minEleIdPt_;
     double minEleIdReco_;
 
-    TFile* muonHltFile;
-    TFile* muonIdFile;
-    TFile* muonIsoFile;
-
-    TH2F* h_muonHlt;
-    TH2F* h_muonId;
-    TH2F* h_muonIdSyst;
-    TH2F* h_muonIdStat;
-    TH2F* h_muonIso;
-    TH2F* h_muonIsoSyst;
-    TH2F* h_muonIsoStat;
+    ScaleFactorTable muonIdSFs_;
+    ScaleFactorTable muonIsoSFs_;
 
     double maxMuonIdPt_;
     double maxMuonIsoPt_;
-    double maxMuonHltPt_;
 
     double minMuonIdPt_;
     double minMuonIsoPt_;
-    double minMuonHltPt_;
 
     public:
     Cuts(const bool doPlots, const bool fillCutFlows, const bool invertLepCut, const bool is2016, const bool is2016APV, const bool is2018);
     ~Cuts();
-    bool makeCuts(AnalysisEvent& event, double& eventWeight, std::map<std::string, std::shared_ptr<Plots>>& plotMap, TH1D& cutFlow, const int systToRun);
+    // Copy for a worker thread. The SF histograms are shared read-only and
+    // stay owned by the original, which must outlive the copy.
+    std::unique_ptr<Cuts> clone() const;
+    // JEC uncertainty lookups made by this copy since it was made
+    long long jecLookups() const {
+        return jecLookups_;
+    }
+
+    // One systematic variation of the selection
+    struct SystVariation
+    {
+        const Systematic* systematic;
+        // Event weight, updated by the selection
+        double weight;
+        std::map<std::string, std::shared_ptr<Plots>>* plots;
+        HistogramBuffer* cutFlow;
+        // For the caller, not used by the selection
+        unsigned index;
+    };
+    // Whether variation takes the jet selection made for selected: the
+    // weight-only systematics take the nominal one
+    static bool sharesSelection(const SystVariation& selected, const SystVariation& variation) {
+        return &variation == &selected || (selected.systematic->isNominal() && variation.systematic->weightOnly());
+    }
+    // The selection is run for every systematic at once. makeSharedCuts does
+    // the stages that are the same for all variations (trigger, MET filters,
+    // muons, dilepton and dihadron candidates) once, filling their plots and
+    // cut flows for each variation. If it passes, makeSystCuts does the jet
+    // selection and b-tag weight for variations[selected] and says whether
+    // it passes. The nominal selection is shared by all the weight-only
+    // variations, whose weights and plots are updated along with it. Call it
+    // for each other variation in turn; the event holds the jets of the last
+    // one run.
+    bool makeSharedCuts(AnalysisEvent& event, std::vector<SystVariation>& variations);
+    bool makeSystCuts(AnalysisEvent& event, std::vector<SystVariation>& variations, const size_t selected);
+    // Ntuple branches read by the selection, for AnalysisEvent::setBranchManifest
+    std::vector<std::string> getBranchManifest() const;
     void setMC(bool isMC) {
         isMC_ = isMC;
     }
@@ -254,11 +298,7 @@ class Cuts
     void setTriggerFlag(std::string triggerFlag) {
         triggerFlag_ = triggerFlag;
     }
-    void setBTagPlots(std::vector<TH2D*> vec, bool makePlotsOrRead) {
-        makeBTagEffPlots_ = makePlotsOrRead;
-        bTagEffPlots_ = vec;
-        getBTagWeight_ = !makePlotsOrRead;
-    }
+    void setBTagPlots(std::vector<TH2D*> vec, bool makePlotsOrRead);
     void setSkipTrig(bool skip) {
         skipTrigger_ = skip;
     }
@@ -305,6 +345,14 @@ class Cuts
     [[gnu::const]] static double deltaR(const double& eta1, const double& phi1, const double& eta2, const double& phi2);
     [[gnu::const]] static double deltaPhi(const double& phi1, const double& phi2);
 
+    private:
+    // Fill the plots and cut flows of stageVariations_ at a cut stage
+    void fillStage(const AnalysisEvent& event, const std::string& stage, const double cutFlowBin);
+
+    // The variations filled by fillStage, and scratch space for it
+    std::vector<SystVariation*> stageVariations_;
+    std::vector<Plots*> stagePlots_;
+    std::vector<double> stageWeights_;
 };
 
 #endif
@@ -0,0 +1,73 @@
+#ifndef _derivedQuantities_hpp_
+#define _derivedQuantities_hpp_
+
+#include "fourVector.hpp"
+
+#include <array>
+#include <cstddef>
+
+class AnalysisEvent;
+
+// Kinematics of the selected lepton and hadron pairs and the quantities of
+// their fitted vertices, which many fill expressions and the plots of every
+// cut stage share. Each is worked out the first time it is asked for in an
+// event and read back after that. A value is only reused while what it was
+// worked out from is unchanged: a pair's until the event's pair generation
+// moves on, which Cuts does each time it sets a pair, and a vertex's while
+// the track pair index stays the same. So plots filled before the selection
+// picks a pair don't leave a stale value for the stages after.
+class DerivedQuantities
+{
+    public:
+    enum class Pair { zPair, zPairRefit, chsPair, chsTrkPair, chsTrkPairRefit, numPairs };
+    enum class Vertex { mumu, dichs, numVertices };
+    static constexpr size_t NPAIRS{static_cast<size_t>(Pair::numPairs)};
+    static constexpr size_t NVERTICES{static_cast<size_t>(Vertex::numVertices)};
+
+    struct pairKinematics
+    {
+        FourVector sum;
+        double mass;
+        double pt;
+        double eta;
+        double phi;
+    };
+
+    struct vertexQuantities
+    {
+        float p;
+        float vxy;
+        float vabs;
+        float chi2Ndof;
+        float sigXY;
+        float sigXYZ;
+    };
+
+    // Start a new event
+    void reset() {
+        pairs_ = {};
+        vertices_ = {};
+    }
+
+    const pairKinematics& pair(const AnalysisEvent& event, const Pair pair);
+    const vertexQuantities& vertex(const AnalysisEvent& event, const Vertex vertex);
+
+    private:
+    struct pairEntry
+    {
+        bool valid;
+        unsigned generation;
+        pairKinematics value;
+    };
+    struct vertexEntry
+    {
+        bool valid;
+        int index;
+        vertexQuantities value;
+    };
+
+    std::array<pairEntry, NPAIRS> pairs_;
+    std::array<vertexEntry, NVERTICES> vertices_;
+};
+
+#endif
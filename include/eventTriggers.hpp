@@ -0,0 +1,257 @@
+#ifndef _eventTriggers_hpp_
+#define _eventTriggers_hpp_
+
+#include "analysisEventSchema.hpp"
+
+#include <TTree.h>
+
+// The trigger and MET filter bits of an event, and each era's trigger
+// decisions made from them. AnalysisEvent and the slimmed event types derive
+// from this and bind the bits with bindTriggerBranches().
+class EventTriggers
+{
+    public:
+    ANALYSISEVENT_TRIGGER_BRANCHES(ANALYSISEVENT_DECLARE_SCALAR, ANALYSISEVENT_DECLARE_ARRAY)
+    ANALYSISEVENT_METFILTER_BRANCHES(ANALYSISEVENT_DECLARE_SCALAR, ANALYSISEVENT_DECLARE_ARRAY)
+
+    const bool is2016_;
+    const bool is2018_;
+
+    bool muTrig() const;
+    bool mumuTrig() const;
+    bool mumuTrig_noMassCut() const;
+    bool mumuTrig_massCut() const;
+    bool mumuL2Trig() const;
+    bool mumuNoVtxTrig() const;
+    bool bParkingTrigInclusive() const;
+    bool bParkingTrig_Mu9_IP5() const;
+    bool bParkingTrig_Mu9_IP6() const;
+    bool bParkingTrig_Mu12_IP6() const;
+//    bool dataScoutingTrig() const;
+
+    bool metFilters() const;
+
+    protected:
+    EventTriggers(const bool is2016, const bool is2018)
+        : is2016_{is2016}
+        , is2018_{is2018}
+    {
+    }
+    void bindTriggerBranches(TTree* tree, const bool isMC);
+};
+
+inline void EventTriggers::bindTriggerBranches(TTree* tree, const bool isMC) {
+    const bool is2016{is2016_};
+    const bool is2018{is2018_};
+    ANALYSISEVENT_TRIGGER_BRANCHES(ANALYSISEVENT_BIND_SCALAR, ANALYSISEVENT_BIND_ARRAY)
+    ANALYSISEVENT_METFILTER_BRANCHES(ANALYSISEVENT_BIND_SCALAR, ANALYSISEVENT_BIND_ARRAY)
+}
+
+inline bool EventTriggers::muTrig() const {
+    if (is2016_) { // 2016
+        if ( HLT_IsoMu24_v1 > 0 || HLT_IsoMu24_v2 > 0 || HLT_IsoMu24_v4 > 0 || HLT_IsoTkMu24_v1 > 0 || HLT_IsoTkMu24_v2 > 0 || HLT_IsoTkMu24_v3 > 0 || HLT_IsoTkMu24_v4 > 0 
+          || HLT_IsoMu27_v3 > 0 || HLT_IsoMu27_v4 > 0 || HLT_IsoMu27_v5 > 0 || HLT_IsoMu27_v7 > 0 
+          || HLT_IsoTkMu27_v3 > 0 || HLT_IsoTkMu27_v4 > 0 || HLT_IsoTkMu27_v5 > 0 || HLT_IsoTkMu27_v6 > 0 || HLT_IsoTkMu27_v7 > 0 ) return true;
+        else return false;
+    }
+    else if (is2018_) { // 2018 
+       if ( HLT_IsoMu24_v11 > 0 || HLT_IsoMu24_v12 > 0 || HLT_IsoMu24_v13  
+         || HLT_IsoMu27_v14 > 0 || HLT_IsoMu27_v15 > 0 || HLT_IsoMu27_v16 > 0 ) return true;
+        else return false;
+    }
+    else { // 2017
+        if ( HLT_IsoMu27_v8 > 0 || HLT_IsoMu27_v9 > 0 || HLT_IsoMu27_v10 > 0 || HLT_IsoMu27_v11 > 0 || HLT_IsoMu27_v12 > 0 || HLT_IsoMu27_v13 > 0 || HLT_IsoMu27_v14 > 0 ) return true;
+        else return false;
+    }
+}
+
+inline bool EventTriggers::mumuTrig() const {
+
+    if (is2016_) { // 2016
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v2 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v7 > 0
+          || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v2 > 0 || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v3 > 0 || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v6 > 0 ) return true;
+        else return false;
+    }
+    else if (is2018_) { // 2018
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v5 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v5 > 0 ) return true;
+        else return false;
+    }
+    else { // 2017
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v8 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v9 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v10 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v11 > 0
+          || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v12 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v13 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v14 > 0 
+          || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v1 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v2 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v4 > 0
+          || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v7 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v8 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v1 > 0 
+          || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v2 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v4 > 0 ) return true;
+        else return false;
+   }
+}
+
+inline bool EventTriggers::mumuTrig_noMassCut() const {
+    if (is2016_) { // 2016
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v2 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v7 > 0
+          || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v2 > 0 || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v3 > 0 || HLT_Mu17_TrkIsoVVL_TkMu8_TrkIsoVVL_DZ_v6 > 0 ) return true;
+        else return false;
+    }
+    else if (is2018_) { // 2018
+        return false;
+    }
+    else { // 2017
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v8 > 0	|| HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v9 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v10 > 0 ||	HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v11 > 0   
+      	   || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v12 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v13 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_v14 > 0 ) return true;
+        else return false;
+   }
+}
+
+inline bool EventTriggers::mumuTrig_massCut() const {
+    if (is2016_) return false; // 2016
+    else if (is2018_) { // 2018
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v5 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v4 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v5 > 0 ) return true;
+        return false;
+    }
+    else { // 2017
+        if ( HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v1 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v2 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v4 > 0
+       	  || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v7 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass8_v8 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v1 > 0	
+          || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v2 > 0	|| HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v3 > 0 || HLT_Mu17_TrkIsoVVL_Mu8_TrkIsoVVL_DZ_Mass3p8_v4 > 0 ) return true;
+        else return false;
+   }
+}
+
+inline bool EventTriggers::mumuL2Trig() const {
+    if (is2016_) { // 2016
+        if ( HLT_L2DoubleMu23_NoVertex_v2 > 0 || HLT_L2DoubleMu23_NoVertex_v3 > 0 || HLT_L2DoubleMu23_NoVertex_v4 > 0 || HLT_L2DoubleMu23_NoVertex_v6 > 0 ) return true;
+        else return false;
+    }
+    else if (is2018_) { // 2018
+        if ( HLT_DoubleL2Mu50_v2 > 0 || HLT_DoubleL2Mu23NoVtx_2Cha_v1 > 0 || HLT_DoubleL2Mu23NoVtx_2Cha_v2 > 0 || HLT_DoubleL2Mu25NoVtx_2Cha_Eta2p4_v1 > 0 || HLT_DoubleL2Mu25NoVtx_2Cha_Eta2p4_v2 > 0
+          || HLT_DoubleL2Mu25NoVtx_2Cha_v1 > 0 || HLT_DoubleL2Mu25NoVtx_2Cha_v2 > 0 || HLT_DoubleL2Mu30NoVtx_2Cha_Eta2p4_v1 > 0 || HLT_DoubleL2Mu30NoVtx_2Cha_Eta2p4_v2 > 0 ) return true;
+        else return false;
+    }
+    else { // 2017
+        if ( HLT_DoubleL2Mu50_v1 > 0 || HLT_DoubleL2Mu50_v2 > 0 ) return true;
+        else return false;
+    }
+}
+
+inline bool EventTriggers::mumuNoVtxTrig() const {
+    if (is2016_) { // 2016
+        if ( HLT_DoubleMu33NoFiltersNoVtx_v2 > 0 || HLT_DoubleMu33NoFiltersNoVtx_v3 > 0 || HLT_DoubleMu33NoFiltersNoVtx_v5 > 0 
+          || HLT_DoubleMu23NoFiltersNoVtxDisplaced_v2 > 0 || HLT_DoubleMu23NoFiltersNoVtxDisplaced_v3 > 0 || HLT_DoubleMu23NoFiltersNoVtxDisplaced_v5 ) return true;
+       	else return false;
+    }
+    else if (is2018_) { // 2018
+        if ( HLT_DoubleMu33NoFiltersNoVtxDisplaced_v1 > 0 || HLT_DoubleMu40NoFiltersNoVtxDisplaced_v1 > 0 || HLT_DoubleMu43NoFiltersNoVtx_v3 > 0 
+          || HLT_DoubleMu43NoFiltersNoVtx_v4 > 0 || HLT_DoubleMu48NoFiltersNoVtx_v3 > 0 || HLT_DoubleMu48NoFiltersNoVtx_v4 > 0 ) return true;
+       	else return false;
+    }
+    else { // 2017
+        if ( HLT_DoubleMu43NoFiltersNoVtx_v2 > 0 || HLT_DoubleMu43NoFiltersNoVtx_v3 > 0 || HLT_DoubleMu48NoFiltersNoVtx_v2 > 0 || HLT_DoubleMu48NoFiltersNoVtx_v3 > 0 ) return true;
+        else return false;
+    }
+}
+
+
+inline bool EventTriggers::bParkingTrigInclusive() const {
+    if ( !is2018_ ) return false;
+    else {
+        if ( HLT_Mu12_IP6_part0_v2 > 0 || HLT_Mu12_IP6_part1_v2 > 0 || HLT_Mu12_IP6_part2_v2 > 0 || HLT_Mu12_IP6_part3_v2 > 0 || HLT_Mu12_IP6_part4_v2 > 0
+          || HLT_Mu9_IP5_part0_v2 > 0 || HLT_Mu9_IP5_part1_v2 > 0 || HLT_Mu9_IP5_part2_v2 > 0 || HLT_Mu9_IP5_part3_v2 > 0 || HLT_Mu9_IP5_part4_v2 > 0
+          || HLT_Mu7_IP4_part0_v2 > 0 || HLT_Mu7_IP4_part1_v2 > 0 || HLT_Mu7_IP4_part2_v2 > 0 || HLT_Mu7_IP4_part3_v2 > 0 || HLT_Mu7_IP4_part4_v2 > 0
+          || HLT_Mu8_IP5_part0_v2 > 0 || HLT_Mu8_IP5_part1_v2 > 0 || HLT_Mu8_IP5_part2_v2 > 0 || HLT_Mu8_IP5_part3_v2 > 0 || HLT_Mu8_IP5_part4_v2 > 0
+          || HLT_Mu8_IP6_part0_v2 > 0 || HLT_Mu8_IP6_part1_v2 > 0 || HLT_Mu8_IP6_part2_v2 > 0 || HLT_Mu8_IP6_part3_v2 > 0 || HLT_Mu8_IP6_part4_v2 > 0
+          || HLT_Mu9_IP6_part0_v3 > 0 || HLT_Mu9_IP6_part1_v3 > 0 || HLT_Mu9_IP6_part2_v3 > 0 || HLT_Mu9_IP6_part3_v3 > 0 || HLT_Mu9_IP6_part4_v3 > 0 ) return true;
+        else return false;
+    }
+}
+
+inline bool EventTriggers::bParkingTrig_Mu9_IP5() const {
+    if ( !is2018_ ) return false;
+    else {
+        if ( HLT_Mu9_IP5_part0_v2 > 0 
+          || HLT_Mu9_IP5_part1_v2 > 0  
+          || HLT_Mu9_IP5_part2_v2 > 0  
+          || HLT_Mu9_IP5_part3_v2 > 0  
+          || HLT_Mu9_IP5_part4_v2 > 0 ) return true;
+        else return false;
+    }
+}
+
+inline bool EventTriggers::bParkingTrig_Mu9_IP6() const {
+    if ( !is2018_ ) return false;
+    else {
+        if ( HLT_Mu9_IP6_part0_v3 > 0 
+          || HLT_Mu9_IP6_part1_v3 > 0  
+          || HLT_Mu9_IP6_part2_v3 > 0  
+          || HLT_Mu9_IP6_part3_v3 > 0  
+          || HLT_Mu9_IP6_part4_v3 > 0 ) return true;
+        else return false;
+    }
+}
+
+inline bool EventTriggers::bParkingTrig_Mu12_IP6() const {
+    if ( !is2018_ ) return false;
+    else {
+        if ( HLT_Mu12_IP6_part0_v2 > 0 
+          || HLT_Mu12_IP6_part1_v2 > 0  
+          || HLT_Mu12_IP6_part2_v2 > 0  
+          || HLT_Mu12_IP6_part3_v2 > 0  
+          || HLT_Mu12_IP6_part4_v2 > 0 ) return true;
+        else return false;
+    }
+}
+
+/*
+inline bool EventTriggers::dataScoutingTrig() const {
+    return is2016_ ?
+// 2016 triggers
+                   0
+//2017 triggers
+                   : DST_HT250_CaloScouting_v6 > 0
+                         || DST_HT250_CaloScouting_v7 > 0
+                         || DST_HT250_CaloScouting_v8 > 0
+                         || DST_HT250_CaloScouting_v9 > 0
+                         || DST_HT250_CaloBTagScouting_v5 > 0
+                         || DST_HT250_CaloBTagScouting_v6 > 0
+                         || DST_HT250_CaloBTagScouting_v7 > 0
+                         || DST_HT250_CaloBTagScouting_v8 > 0
+                         || DST_HT410_PFScouting_v9 > 0
+                         || DST_HT410_PFScouting_v10 > 0
+                         || DST_HT410_PFScouting_v11 > 0
+                         || DST_HT410_PFScouting_v12 > 0
+                         || DST_HT410_PFScouting_v13 > 0
+                         || DST_HT410_PFScouting_v14 > 0
+                         || DST_HT410_BTagScouting_v10 > 0
+                         || DST_HT410_BTagScouting_v11 > 0
+                         || DST_HT410_BTagScouting_v12 > 0
+                         || DST_HT410_BTagScouting_v13 > 0
+                         || DST_HT410_BTagScouting_v14 > 0
+                         || DST_DoubleMu3_noVtx_CaloScouting_v2 > 0
+                         || DST_DoubleMu3_noVtx_CaloScouting_v3 > 0
+                         || DST_DoubleMu3_noVtx_CaloScouting_v4 > 0
+                         || DST_DoubleMu3_noVtx_CaloScouting_v5 > 0;
+}
+*/
+inline bool EventTriggers::metFilters() const {
+    return is2016_ ?
+// 2016 filters
+               Flag_goodVertices > 0 // Recommended 16, 17, 18
+            && Flag_globalTightHalo2016Filter > 0 // Recommended 16, 17, 18
+            && Flag_HBHENoiseFilter > 0 // Recommended 16, 17, 18
+            && Flag_HBHENoiseIsoFilter > 0 // Recommended 16, 17, 18
+            && Flag_EcalDeadCellTriggerPrimitiveFilter > 0 // Recommended 16, 17, 18
+            && Flag_BadPFMuonFilter > 0 // Recommended 16, 17, 18
+
+//2017 + 2018 filters
+                   : 
+               Flag_goodVertices > 0 // Recommended 16, 17, 18
+            && Flag_globalTightHalo2016Filter > 0 // Recommended 16, 17, 18
+            && Flag_HBHENoiseFilter > 0 // Recommended 16, 17, 18
+            && Flag_HBHENoiseIsoFilter > 0 // Recommended 16, 17, 18
+            && Flag_EcalDeadCellTriggerPrimitiveFilter > 0 // Recommended 16, 17, 18
+            && Flag_BadPFMuonFilter > 0 // Recommended 16, 17, 18
+            && Flag_ecalBadCalibFilter > 0; // Recommended 17, 18 (no comment on 16)
+
+//            && Flag_BadChargedCandidateFilter > 0 // NOT Recommended
+//            && Flag_eeBadScFilter > 0 // NOT Recommended
+}
+
+#endif
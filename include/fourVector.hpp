@@ -0,0 +1,188 @@
+#ifndef _fourVector_hpp_
+#define _fourVector_hpp_
+
+#include <TLorentzVector.h>
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+// Plain (px, py, pz, E) four-vector for the selection and plotting hot paths.
+// Unlike TLorentzVector it is not a TObject, so it has no vtable and is
+// trivially copyable. The accessors have the same names and conventions as
+// TLorentzVector's; convert with toTLorentzVector() where ROOT needs one.
+class FourVector
+{
+    public:
+    constexpr FourVector() : px_{0.}, py_{0.}, pz_{0.}, e_{0.} {}
+    constexpr FourVector(const double px, const double py, const double pz, const double e) : px_{px}, py_{py}, pz_{pz}, e_{e} {}
+    explicit FourVector(const TLorentzVector& vec) : px_{vec.Px()}, py_{vec.Py()}, pz_{vec.Pz()}, e_{vec.E()} {}
+
+    static FourVector fromPtEtaPhiE(const double pt, const double eta, const double phi, const double e) {
+        FourVector vec;
+        vec.SetPtEtaPhiE(pt, eta, phi, e);
+        return vec;
+    }
+    static FourVector fromPtEtaPhiM(const double pt, const double eta, const double phi, const double m) {
+        FourVector vec;
+        vec.SetPtEtaPhiM(pt, eta, phi, m);
+        return vec;
+    }
+
+    void SetPxPyPzE(const double px, const double py, const double pz, const double e) {
+        px_ = px;
+        py_ = py;
+        pz_ = pz;
+        e_ = e;
+    }
+    void SetPx(const double px) {
+        px_ = px;
+    }
+    void SetPy(const double py) {
+        py_ = py;
+    }
+    void SetPz(const double pz) {
+        pz_ = pz;
+    }
+    void SetE(const double e) {
+        e_ = e;
+    }
+    void SetPtEtaPhiE(const double pt, const double eta, const double phi, const double e) {
+        const double absPt{std::abs(pt)};
+        SetPxPyPzE(absPt * std::cos(phi), absPt * std::sin(phi), absPt * std::sinh(eta), e);
+    }
+    void SetPtEtaPhiM(const double pt, const double eta, const double phi, const double m) {
+        const double absPt{std::abs(pt)};
+        px_ = absPt * std::cos(phi);
+        py_ = absPt * std::sin(phi);
+        pz_ = absPt * std::sinh(eta);
+        const double p2{px_ * px_ + py_ * py_ + pz_ * pz_};
+        e_ = m >= 0. ? std::sqrt(p2 + m * m) : std::sqrt(std::max(p2 - m * m, 0.));
+    }
+
+    constexpr double Px() const {
+        return px_;
+    }
+    constexpr double Py() const {
+        return py_;
+    }
+    constexpr double Pz() const {
+        return pz_;
+    }
+    constexpr double E() const {
+        return e_;
+    }
+    constexpr double X() const {
+        return px_;
+    }
+    constexpr double Y() const {
+        return py_;
+    }
+    constexpr double Z() const {
+        return pz_;
+    }
+    constexpr double T() const {
+        return e_;
+    }
+    constexpr double Perp2() const {
+        return px_ * px_ + py_ * py_;
+    }
+    double Pt() const {
+        return std::sqrt(Perp2());
+    }
+    double P() const {
+        return std::sqrt(Perp2() + pz_ * pz_);
+    }
+    double Phi() const {
+        return std::atan2(py_, px_);
+    }
+    // As TLorentzVector::Eta, including +-1e10 along the beam line
+    double Eta() const {
+        const double p{P()};
+        const double cosTheta{p > 0. ? pz_ / p : 1.};
+        if (cosTheta * cosTheta < 1.) {
+            return -0.5 * std::log((1. - cosTheta) / (1. + cosTheta));
+        }
+        return pz_ > 0. ? 10e10 : pz_ < 0. ? -10e10 : 0.;
+    }
+    double Rapidity() const {
+        return 0.5 * std::log((e_ + pz_) / (e_ - pz_));
+    }
+    constexpr double M2() const {
+        return e_ * e_ - Perp2() - pz_ * pz_;
+    }
+    double M() const {
+        const double m2{M2()};
+        return m2 < 0. ? -std::sqrt(-m2) : std::sqrt(m2);
+    }
+    double Mt() const {
+        const double mt2{e_ * e_ - pz_ * pz_};
+        return mt2 < 0. ? -std::sqrt(-mt2) : std::sqrt(mt2);
+    }
+    double Et() const {
+        const double pt2{Perp2()};
+        const double et2{pt2 > 0. ? e_ * e_ * pt2 / (pt2 + pz_ * pz_) : 0.};
+        return e_ < 0. ? -std::sqrt(et2) : std::sqrt(et2);
+    }
+
+    // In [-pi, pi]
+    double DeltaPhi(const FourVector& vec) const {
+        double dPhi{Phi() - vec.Phi()};
+        if (dPhi > M_PI) {
+            dPhi -= 2. * M_PI;
+        }
+        else if (dPhi < -M_PI) {
+            dPhi += 2. * M_PI;
+        }
+        return dPhi;
+    }
+    double DeltaR(const FourVector& vec) const {
+        const double dEta{Eta() - vec.Eta()};
+        const double dPhi{DeltaPhi(vec)};
+        return std::sqrt(dEta * dEta + dPhi * dPhi);
+    }
+
+    constexpr FourVector operator+(const FourVector& vec) const {
+        return {px_ + vec.px_, py_ + vec.py_, pz_ + vec.pz_, e_ + vec.e_};
+    }
+    constexpr FourVector operator-(const FourVector& vec) const {
+        return {px_ - vec.px_, py_ - vec.py_, pz_ - vec.pz_, e_ - vec.e_};
+    }
+    FourVector& operator+=(const FourVector& vec) {
+        px_ += vec.px_;
+        py_ += vec.py_;
+        pz_ += vec.pz_;
+        e_ += vec.e_;
+        return *this;
+    }
+    FourVector& operator-=(const FourVector& vec) {
+        px_ -= vec.px_;
+        py_ -= vec.py_;
+        pz_ -= vec.pz_;
+        e_ -= vec.e_;
+        return *this;
+    }
+    constexpr FourVector operator*(const double scale) const {
+        return {px_ * scale, py_ * scale, pz_ * scale, e_ * scale};
+    }
+    FourVector& operator*=(const double scale) {
+        px_ *= scale;
+        py_ *= scale;
+        pz_ *= scale;
+        e_ *= scale;
+        return *this;
+    }
+
+    TLorentzVector toTLorentzVector() const {
+        return {px_, py_, pz_, e_};
+    }
+
+    private:
+    double px_;
+    double py_;
+    double pz_;
+    double e_;
+};
+
+static_assert(std::is_trivially_copyable<FourVector>::value, "FourVector must stay trivially copyable");
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef _histogramBuffer_hpp_
+#define _histogramBuffer_hpp_
+
+#include <cstddef>
+#include <vector>
+
+class TH1D;
+
+// Stand-in for a TH1D that a worker thread fills on its own: the bin
+// contents, the sums of squared weights and the fill statistics in plain
+// arrays, binned as the histogram it was made from. Nothing is shared or
+// registered with ROOT, so filling needs no locks, and the buffer is only
+// turned into the histogram when addTo is called. The sums are updated as
+// TH1::Fill updates them, so this gives the histogram that filling it
+// directly would have, up to the order of the additions. Uniform bins, which
+// all of the configured plots have, are found with a multiply by the
+// precomputed bins per unit and clamps rather than branches; a value within
+// rounding of a bin edge can land in the other bin from the one
+// TAxis::FindFixBin, which divides, would give it.
+class HistogramBuffer
+{
+    public:
+    explicit HistogramBuffer(const TH1D& hist);
+
+    void fill(const double x, const double w) {
+        accumulate(x, w, w * w);
+    }
+    // All of an event's values for one plot, which share its weight
+    void fill(const float* x, const size_t n, const double w) {
+        const double w2{w * w};
+        for (size_t i{0}; i < n; i++) {
+            accumulate(x[i], w, w2);
+        }
+    }
+
+    // Buffers must have the same binning
+    void add(const HistogramBuffer& other);
+    void addTo(TH1D& hist) const;
+    void reset();
+    bool empty() const {
+        return !(entries_ > 0.);
+    }
+
+    private:
+    void accumulate(const double x, const double w, const double w2) {
+        const int b{edges_.empty() ? uniformBin(x) : variableBin(x)};
+        contents_[static_cast<size_t>(b)] += w;
+        sumw2_[static_cast<size_t>(b)] += w2;
+        entries_ += 1.;
+        // TH1 leaves the under and overflow out of the statistics. Selected
+        // rather than branched on, and x is zeroed too so an infinite
+        // overflow can't make them NaN.
+        const bool inRange{b > 0 && b <= numBins_};
+        const double wIn{inRange ? w : 0.};
+        const double xIn{inRange ? x : 0.};
+        tsumw_ += wIn;
+        tsumw2_ += inRange ? w2 : 0.;
+        tsumwx_ += wIn * xIn;
+        tsumwx2_ += wIn * xIn * xIn;
+    }
+    int uniformBin(const double x) const {
+        // -1 for the underflow and numBins_ for the overflow, which NaN
+        // goes to as it does in TAxis
+        double u{(x - xMin_) * binsPerUnit_};
+        u = u < 0. ? -1. : u;
+        u = u < numBins_ ? u : numBins_;
+        return 1 + static_cast<int>(u);
+    }
+    int variableBin(const double x) const;
+
+    int numBins_;
+    double xMin_;
+    double xMax_;
+    double binsPerUnit_;
+    // Only for variable binning
+    std::vector<double> edges_;
+    // Including the under and overflow bins
+    std::vector<double> contents_;
+    std::vector<double> sumw2_;
+    double entries_;
+    double tsumw_;
+    double tsumw2_;
+    double tsumwx_;
+    double tsumwx2_;
+};
+
+#endif
@@ -28,6 +28,7 @@ class HistogramPlotter {
     const bool is2016APV_; // Era
     const bool is2018_; // Era
     bool loadHistos_;
+    unsigned plotProcesses_;
 
     // Orders of various things and information regarding plotting.
     std::vector<std::string> plotOrder_;
@@ -51,6 +52,10 @@ class HistogramPlotter {
     // writes the lumi information and the CMS "logo" in the FigGuidelines style
     void CMS_lumi(TPad*, int = 10);
     void setTDRStyle();
+    // Plot i of a cut stage, for every dataset
+    void plotStage(std::map<std::string, std::map<std::string, std::shared_ptr<Plots>>>& plotMap,
+                   const unsigned i,
+                   const std::string& stage);
 
     public:
     // Constructor
@@ -92,6 +97,11 @@ class HistogramPlotter {
     {
         extensions_ = extentions;
     }
+    // plotHistos shares the plots out between this many forked processes
+    void setPlotProcesses(unsigned processes)
+    {
+        plotProcesses_ = processes;
+    }
     // Actual plotting commands
     void plotHistos(
         std::map<std::string, std::map<std::string, std::shared_ptr<Plots>>>);
@@ -0,0 +1,33 @@
+#ifndef _jecUncertaintyTable_hpp_
+#define _jecUncertaintyTable_hpp_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// JES uncertainties from a JetMET uncertainty text file, which gives the up
+// and down uncertainties at a list of pT points in each eta bin. Each file is
+// read once per process and the table shared, read only, by everything that
+// asks for it. The values sit in one array, eta bin by eta bin, and the bins
+// are found by binary search. Between pT points the uncertainty is linearly
+// interpolated; beyond the table pT and eta are clamped to its edges.
+class JECUncertaintyTable
+{
+    public:
+    static std::shared_ptr<const JECUncertaintyTable> load(const std::string& fileName);
+
+    // Size of the uncertainty, without a sign. Without interpolation it is
+    // the value at the pT point below.
+    [[gnu::pure]] double uncertainty(const double pt, const double eta, const bool up, const bool interpolate = true) const;
+
+    private:
+    explicit JECUncertaintyTable(const std::string& fileName);
+
+    std::vector<double> etaEdges_;
+    std::vector<double> ptPoints_;
+    // [etaBin * ptPoints_.size() + ptPoint]
+    std::vector<double> up_;
+    std::vector<double> down_;
+};
+
+#endif
@@ -0,0 +1,85 @@
+#ifndef _jetCorrectionCache_hpp_
+#define _jetCorrectionCache_hpp_
+
+#include "fourVector.hpp"
+
+#include <array>
+#include <cstddef>
+
+// Smeared and JES shifted jets of the current event for each jet variation.
+// Cuts fills a variation the first time a selection stage asks for it, and
+// every later stage and systematic using the same jets reads it back. The
+// parts of the JER smearing that don't depend on the scale factor are worked
+// out once per event and shared by the nominal and JER variations.
+class JetCorrectionCache
+{
+    public:
+    static constexpr size_t MAXJETS{40};
+
+    enum class Variation { nominal, jesUp, jesDown, jerUp, jerDown, numVariations };
+    static constexpr size_t NVARIATIONS{static_cast<size_t>(Variation::numVariations)};
+
+    struct jets
+    {
+        // As used by the jet selection
+        std::array<FourVector, MAXJETS> selected;
+        // Raw jet times the smear, then JES shifted. Differs from selected
+        // only for jets outside the range of the JER corrections, which the
+        // jet selection leaves untouched.
+        std::array<FourVector, MAXJETS> rescaled;
+        std::array<double, MAXJETS> smear;
+    };
+
+    // JER inputs that are the same for every variation
+    struct resolution
+    {
+        // Within the pT, eta and rho range of the JER corrections
+        bool inRange;
+        bool genMatched;
+        // Raw reco - gen pT of the matched gen jet
+        double genDPt;
+        double ptRes;
+        // Standard normal draw, seeded by the jet, for unmatched jets
+        double gaus;
+        double jerSF;
+        double jerSFUp;
+        double jerSFDown;
+    };
+
+    // Start a new event
+    void reset() {
+        filled_.fill(false);
+        resolutionsFilled_ = false;
+    }
+
+    bool filled(const Variation variation) const {
+        return filled_[static_cast<size_t>(variation)];
+    }
+    const jets& operator[](const Variation variation) const {
+        return jets_[static_cast<size_t>(variation)];
+    }
+    // For Cuts to fill; marks the variation as filled
+    jets& fill(const Variation variation) {
+        filled_[static_cast<size_t>(variation)] = true;
+        return jets_[static_cast<size_t>(variation)];
+    }
+
+    bool resolutionsFilled() const {
+        return resolutionsFilled_;
+    }
+    const std::array<resolution, MAXJETS>& resolutions() const {
+        return resolutions_;
+    }
+    std::array<resolution, MAXJETS>& fillResolutions() {
+        resolutionsFilled_ = true;
+        return resolutions_;
+    }
+
+    private:
+    std::array<jets, NVARIATIONS> jets_;
+    std::array<bool, NVARIATIONS> filled_{};
+    std::array<resolution, MAXJETS> resolutions_;
+    bool resolutionsFilled_{false};
+};
+
+#endif
@@ -2,10 +2,12 @@
 #define _jetCorrectionUncertainty_hpp_
 
 #include "MvaEvent.hpp"
+#include "jecUncertaintyTable.hpp"
 
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <sstream>
 #include <vector>
 
@@ -25,14 +27,8 @@ class JetCorrectionUncertainty
                                                 const int jesUD) const;
 
     private:
-    std::vector<double> ptMinJEC_;
-    std::vector<double> ptMaxJEC_;
-
-    std::vector<double> etaMinJEC_;
-    std::vector<double> etaMaxJEC_;
-
-    std::vector<std::vector<float>> jecSFUp_;
-    std::vector<std::vector<float>> jecSFDown_;
+    // The same table as the selection uses
+    std::shared_ptr<const JECUncertaintyTable> table_;
 };
 
 #endif
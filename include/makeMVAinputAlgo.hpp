@@ -9,7 +9,7 @@
 
 class TTree;
 class MvaEvent;
-class TLorentzVector;
+class FourVector;
 
 class MakeMvaInputs
 {
@@ -31,30 +31,30 @@ class MakeMvaInputs
     void sameSignAnalysis(const std::map<std::string, std::string>& listOfMCs,
                           const std::vector<std::string>& channels,
                           const bool useSidebandRegion);
-    std::pair<TLorentzVector, TLorentzVector>
+    std::pair<FourVector, FourVector>
         sortOutLeptons(const MvaEvent* tree, const std::string& channel) const;
-    std::pair<TLorentzVector, TLorentzVector>
+    std::pair<FourVector, FourVector>
         sortOutHadronicW(const MvaEvent* tree,
                          const int syst,
-                         TLorentzVector met,
+                         FourVector met,
                          const std::vector<int>& jets) const;
-        std::pair<std::vector<int>, std::vector<TLorentzVector>> getJets(
-            const MvaEvent* tree, const int syst, TLorentzVector met) const;
-    std::pair<std::vector<int>, std::vector<TLorentzVector>>
+        std::pair<std::vector<int>, std::vector<FourVector>> getJets(
+            const MvaEvent* tree, const int syst, FourVector met) const;
+    std::pair<std::vector<int>, std::vector<FourVector>>
         getBjets(const MvaEvent* tree,
                  const int syst,
-                 TLorentzVector met,
+                 FourVector met,
                  const std::vector<int>& jets) const;
-    TLorentzVector getJetVec(const MvaEvent* tree,
+    FourVector getJetVec(const MvaEvent* tree,
                              const int index,
                              const float smearValue,
-                             TLorentzVector& metVec,
+                             FourVector& metVec,
                              const int syst,
                              const bool doMetSmear) const;
-    TLorentzVector doUncMet(TLorentzVector met,
-                            const TLorentzVector& zLep1,
-                            const TLorentzVector& zLep2,
-                            const std::vector<TLorentzVector>& jetVecs,
+    FourVector doUncMet(FourVector met,
+                            const FourVector& zLep1,
+                            const FourVector& zLep2,
+                            const std::vector<FourVector>& jetVecs,
                             const unsigned syst) const;
     void setupBranches(TTree* tree);
     void fillTree(TTree* outTreeSig,
@@ -0,0 +1,43 @@
+#ifndef _packedCandGrid_hpp_
+#define _packedCandGrid_hpp_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// Eta-phi grid over the packed candidates, so that a cone query only has to
+// look at the candidates in the cells next to its axis rather than at all of
+// them. Cells are at least CELL_SIZE wide in both eta and phi, and phi wraps
+// around, so the 3x3 block of cells around an axis holds every candidate
+// within deltaR < CELL_SIZE of it.
+class PackedCandGrid
+{
+    public:
+    static constexpr float CELL_SIZE{0.4f};
+    // Candidates beyond this go in the outermost cells
+    static constexpr float ETA_MAX{5.5f};
+    static constexpr size_t NETA{27};
+    static constexpr size_t NPHI{15};
+    static constexpr size_t NCELLS{NETA * NPHI};
+    static constexpr size_t MAXCANDS{3000};
+
+    void build(const float* eta, const float* phi, const int numCands);
+
+    // Indices, in ascending order, of the candidates in the cells around any
+    // of the axes. Includes every candidate within CELL_SIZE of an axis.
+    void candidatesNear(const float* axisEta, const float* axisPhi, const size_t numAxes, std::vector<int>& indices) const;
+
+    private:
+    static size_t cell(const size_t etaBin, const size_t phiBin) {
+        return etaBin * NPHI + phiBin;
+    }
+    [[gnu::const]] static size_t etaBin(const float eta);
+    [[gnu::const]] static size_t phiBin(const float phi);
+
+    // Candidates sorted by cell; those in cell c are
+    // cellCands_[cellStart_[c]] to cellCands_[cellStart_[c + 1] - 1]
+    std::array<int, NCELLS + 1> cellStart_;
+    std::array<int, MAXCANDS> cellCands_;
+};
+
+#endif
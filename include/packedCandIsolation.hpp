@@ -0,0 +1,83 @@
+#ifndef _packedCandIsolation_hpp_
+#define _packedCandIsolation_hpp_
+
+#include "fourVector.hpp"
+#include "packedCandKinematics.hpp"
+
+#include <array>
+#include <vector>
+
+// Charged (from the PV), neutral and pileup isolation sums
+struct isoSums
+{
+    float charged;
+    float neutral;
+    float pu;
+};
+
+// Isolation of a pair of objects against the packed candidates. A single pass
+// over the candidates gives the sums around both objects and around their sum
+// for every cone size. Only the candidates in the grid cells around the axes
+// are visited. Results are cached per pair for the rest of the event, so no
+// pair is ever scanned twice. The cache is a flat list that keeps its
+// capacity between events, so steady state running doesn't allocate.
+class PackedCandIsolation
+{
+    public:
+    static constexpr std::array<float, 2> CONES{0.3f, 0.4f};
+    static constexpr size_t NCONES{CONES.size()};
+    static constexpr size_t CONE_0P3{0};
+    static constexpr size_t CONE_0P4{1};
+
+    // Axes: the two objects and their sum
+    static constexpr size_t NAXES{3};
+    static constexpr size_t FIRST{0};
+    static constexpr size_t SECOND{1};
+    static constexpr size_t SUM{2};
+
+    // What the pair indices refer to
+    enum class Pair { muons, chargedHadrons };
+    // Which four-vector of the candidates to use
+    enum class Vec { pf, pseudoTrack };
+
+    // sums[axis][cone]
+    using pairSums = std::array<std::array<isoSums, NCONES>, NAXES>;
+
+    PackedCandIsolation();
+
+    // Start a new event
+    void reset(const PackedCandKinematics& cands);
+
+    // The candidates at exclude1 and exclude2 (-1 for none) are not counted.
+    // Returned by value, as later pairs can move the cache entries.
+    pairSums pairIsolation(const Pair pair,
+                           const int index1,
+                           const int index2,
+                           const Vec vec,
+                           const FourVector& first,
+                           const FourVector& second,
+                           const int exclude1,
+                           const int exclude2);
+
+    // Passes over the candidates made this event
+    size_t numScans() const {
+        return numScans_;
+    }
+
+    private:
+    struct cacheEntry
+    {
+        Pair pair;
+        int index1;
+        int index2;
+        Vec vec;
+        pairSums sums;
+    };
+
+    const PackedCandKinematics* cands_;
+    std::vector<cacheEntry> cache_;
+    std::vector<int> nearCands_;
+    size_t numScans_;
+};
+
+#endif
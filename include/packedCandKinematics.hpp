@@ -0,0 +1,50 @@
+#ifndef _packedCandKinematics_hpp_
+#define _packedCandKinematics_hpp_
+
+#include "packedCandGrid.hpp"
+
+#include <cstddef>
+
+class AnalysisEvent;
+
+// Single precision kinematics of the packed PF candidates, one contiguous
+// array per quantity, for both the PF and the pseudo-track four-vectors.
+// Filled once per event so that the isolation and deltaR loops in Cuts don't
+// have to build a TLorentzVector per candidate.
+class PackedCandKinematics
+{
+    public:
+    static constexpr size_t MAXCANDS{3000};
+
+    void fill(const AnalysisEvent& event);
+
+    int size;
+
+    // PF candidate
+    alignas(64) float pt[MAXCANDS];
+    alignas(64) float eta[MAXCANDS];
+    alignas(64) float phi[MAXCANDS];
+    alignas(64) float et[MAXCANDS];
+
+    // Pseudo-track
+    alignas(64) float trkPt[MAXCANDS];
+    alignas(64) float trkEta[MAXCANDS];
+    alignas(64) float trkPhi[MAXCANDS];
+    alignas(64) float trkEt[MAXCANDS];
+
+    // Isolation contributions, zero for candidates outside the category:
+    // neutrals with pT >= 0.5, charged from the PV (fromPV >= 2), and
+    // charged pileup with pT >= 0.5
+    alignas(64) float neutralEt[MAXCANDS];
+    alignas(64) float neutralTrkEt[MAXCANDS];
+    alignas(64) float chargedPt[MAXCANDS];
+    alignas(64) float chargedTrkPt[MAXCANDS];
+    alignas(64) float puPt[MAXCANDS];
+    alignas(64) float puTrkPt[MAXCANDS];
+
+    // Cone query grids over the PF and pseudo-track directions
+    PackedCandGrid grid;
+    PackedCandGrid trkGrid;
+};
+
+#endif
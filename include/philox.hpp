@@ -0,0 +1,51 @@
+#ifndef _philox_hpp_
+#define _philox_hpp_
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 counter based random numbers (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3"). The output is a pure function of a key and
+// a counter, so keying on the event and counting over the objects in it gives
+// each object the same draw every time it is processed, without seeding and
+// warming up an engine per object.
+class Philox
+{
+    public:
+    using counter = std::array<uint32_t, 4>;
+    using key = std::array<uint32_t, 2>;
+
+    static constexpr counter generate(counter ctr, key k) {
+        for (int round{0}; round < 10; round++) {
+            ctr = roundOf(ctr, k);
+            k[0] += W0;
+            k[1] += W1;
+        }
+        return ctr;
+    }
+
+    // Uniform in (0, 1) with 53 random bits, from the first two words
+    static constexpr double uniform(const uint64_t k, const uint64_t ctr) {
+        const counter out{generate({static_cast<uint32_t>(ctr), static_cast<uint32_t>(ctr >> 32), 0, 0},
+                                   {static_cast<uint32_t>(k), static_cast<uint32_t>(k >> 32)})};
+        const uint64_t bits{(static_cast<uint64_t>(out[0]) << 21) ^ out[1]};
+        return (static_cast<double>(bits & ((uint64_t{1} << 53) - 1)) + 0.5) * 0x1p-53;
+    }
+
+    private:
+    static constexpr uint32_t M0{0xD2511F53};
+    static constexpr uint32_t M1{0xCD9E8D57};
+    static constexpr uint32_t W0{0x9E3779B9};
+    static constexpr uint32_t W1{0xBB67AE85};
+
+    static constexpr counter roundOf(const counter& ctr, const key& k) {
+        const uint64_t p0{static_cast<uint64_t>(M0) * ctr[0]};
+        const uint64_t p1{static_cast<uint64_t>(M1) * ctr[2]};
+        return {static_cast<uint32_t>(p1 >> 32) ^ ctr[1] ^ k[0],
+                static_cast<uint32_t>(p1),
+                static_cast<uint32_t>(p0 >> 32) ^ ctr[3] ^ k[1],
+                static_cast<uint32_t>(p0)};
+    }
+};
+
+#endif
@@ -2,20 +2,80 @@
 #define _plots_hpp_
 
 #include "AnalysisEvent.hpp"
+#include "histogramBuffer.hpp"
 
-#include <functional>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 typedef struct plot plot;
 
+// The values a fill expression gives for one event, written into a fixed
+// buffer the caller keeps across events rather than a new vector
+class FillValues
+{
+    public:
+    // At most one value per jet
+    static constexpr size_t capacity{AnalysisEvent::NJETSMAX};
+
+    FillValues& add(const float value) {
+        if (size_ == capacity) {
+            throw std::logic_error("Too many values for one fill expression");
+        }
+        values_[size_++] = value;
+        return *this;
+    }
+    void clear() {
+        size_ = 0;
+    }
+    const float* begin() const {
+        return values_.data();
+    }
+    const float* end() const {
+        return values_.data() + size_;
+    }
+    size_t size() const {
+        return size_;
+    }
+
+    private:
+    std::array<float, capacity> values_;
+    size_t size_{0};
+};
+
+// A fill expression either always gives one value, returned by scalar, or
+// gives any number, which list adds to the buffer. Exactly one is set.
+struct FillExpression
+{
+    float (*scalar)(const AnalysisEvent&);
+    FillValues& (*list)(const AnalysisEvent&, FillValues&);
+
+    // All of the values for the event at once
+    const FillValues& evaluate(const AnalysisEvent& event, FillValues& buffer) const {
+        buffer.clear();
+        return scalar ? buffer.add(scalar(event)) : list(event, buffer);
+    }
+};
+
 class TH1D;
 
 class Plots
 {
     private:
     std::vector<plot> plotPoint;
+    // In place of the histograms, for a copy made by cloneBuffered
+    std::vector<HistogramBuffer> buffers;
+    // Ntuple branches needed by the plots filled at this cut stage
+    std::vector<std::string> branchManifest;
+
+    Plots() = default;
+
+    // Into the buffer, if there are buffers, or else the histogram
+    void fill(const size_t i, const FillValues& values, const double eventWeight);
 
     public:
     Plots(const std::vector<std::string> titles,
@@ -29,7 +89,18 @@ class Plots
           const unsigned thisCutStage,
           const std::string postfixName);
     ~Plots();
+    // Same plots filling histogram buffers rather than histograms, for a
+    // worker thread or a block of events
+    std::shared_ptr<Plots> cloneBuffered() const;
+    // Adds the buffers of a copy made by cloneBuffered, to this one's
+    // buffers if it has them or else to its histograms
+    void addPlots(const Plots& other);
+    void resetBuffers();
     void fillAllPlots(const AnalysisEvent& event, const double eventWeight);
+    // Fill the same plots for several systematics, each with its own
+    // weight, evaluating every fill expression once. All of the plots must
+    // have been made from the same config.
+    static void fillAllPlots(const AnalysisEvent& event, const std::vector<Plots*>& plots, const std::vector<double>& eventWeights);
     void saveAllPlots();
     void fillOnePlot(std::string, AnalysisEvent&, float);
     void saveOnePlots(int);
@@ -37,9 +108,14 @@ class Plots
     {
         return plotPoint;
     }
-    std::unordered_map<std::string,
-                       std::function<std::vector<float>(const AnalysisEvent&)>>
-        getFncMap() const;
+    // Throws std::out_of_range for a name with no expression
+    static const FillExpression& getFillExpression(const std::string& name);
+    static std::unordered_map<std::string, std::vector<std::string>>
+        getBranchMap();
+    const std::vector<std::string>& getBranchManifest() const
+    {
+        return branchManifest;
+    }
 };
 
 struct plot
@@ -47,7 +123,7 @@ struct plot
     std::string name;
     std::string title;
     TH1D* plotHist;
-    std::function<std::vector<float>(const AnalysisEvent&)> fillExp;
+    FillExpression fillExp;
     std::string xAxisLabel;
     bool fillPlot;
 };
@@ -0,0 +1,95 @@
+#ifndef _scaleFactorTable_hpp_
+#define _scaleFactorTable_hpp_
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+class TH1;
+
+// Scale factors binned in one or two variables, copied out of ROOT
+// histograms at startup so that the event loop doesn't go through
+// TH1::FindBin and GetBinContent. The nominal, up and down values of each
+// bin sit next to each other. Bins are numbered as TH1::GetBin does, flow
+// bins included, but values beyond the axes clamp to the first and last real
+// bins rather than to the flow bins, which hold nothing useful in an SF
+// histogram. The bin search is a branch free count over the edges, which
+// vectorises when looking up many points at once.
+class ScaleFactorTable
+{
+    public:
+    struct entry
+    {
+        double nominal;
+        double up;
+        double down;
+    };
+
+    ScaleFactorTable();
+    // Up and down are the contents plus and minus the bin errors
+    explicit ScaleFactorTable(const TH1& nominal);
+    // Up and down are the contents plus and minus the quadrature sum of the
+    // bin errors of the uncertainty histograms, which share the binning
+    ScaleFactorTable(const TH1& nominal, const std::vector<const TH1*>& uncertainties);
+    // Up and down from their own histograms, which share the binning
+    ScaleFactorTable(const TH1& nominal, const TH1& up, const TH1& down);
+    // Bin by bin ratio, 0/0 giving NaN as TH1 division would; up and down
+    // are the same as nominal
+    static ScaleFactorTable ratio(const TH1& numerator, const TH1& denominator);
+
+    // For conditions snapshots; read throws on a truncated record
+    void write(std::ostream& out) const;
+    static ScaleFactorTable read(const char* data, const size_t size);
+
+    bool empty() const {
+        return values_.empty();
+    }
+    // Lowest and highest x edges
+    double xMin() const {
+        return xEdges_.front();
+    }
+    double xMax() const {
+        return xEdges_.back();
+    }
+    bool sameBinning(const ScaleFactorTable& other) const {
+        return xEdges_ == other.xEdges_ && yEdges_ == other.yEdges_;
+    }
+
+    int bin(const double x, const double y = 0.) const {
+        const int xBin{axisBin(xEdges_.data(), xEdges_.size(), x)};
+        return yEdges_.empty() ? xBin : xBin + stride_ * axisBin(yEdges_.data(), yEdges_.size(), y);
+    }
+    // Bins of n points at once; y may be null for a one dimensional table
+    void bins(const double* x, const double* y, const size_t n, int* result) const;
+
+    const entry& operator[](const int bin) const {
+        return values_[static_cast<size_t>(bin)];
+    }
+    const entry& at(const double x, const double y = 0.) const {
+        return values_[static_cast<size_t>(bin(x, y))];
+    }
+
+    private:
+    // The number of edges at or below x, which is TAxis::FindBin's bin,
+    // clamped to the real bins. NaN takes the first.
+    static int axisBin(const double* edges, const size_t numEdges, const double x) {
+        int bin{0};
+        for (size_t k{0}; k < numEdges; k++) {
+            bin += x >= edges[k];
+        }
+        const int lastBin{static_cast<int>(numEdges) - 1};
+        bin = bin > 1 ? bin : 1;
+        return bin < lastBin ? bin : lastBin;
+    }
+
+    void setBinning(const TH1& hist);
+
+    // A one dimensional table has no y edges, and its y bin is always 0
+    std::vector<double> xEdges_;
+    std::vector<double> yEdges_;
+    // Bins along x, including under and overflow
+    int stride_;
+    std::vector<entry> values_;
+};
+
+#endif
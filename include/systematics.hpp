@@ -0,0 +1,75 @@
+#ifndef _systematics_hpp_
+#define _systematics_hpp_
+
+#include "AnalysisEvent.hpp"
+
+#include <string>
+#include <vector>
+
+// One systematic variation, as declared in the systematics config
+struct Systematic
+{
+    // Shape variations change the selected objects, weight variations only
+    // the event weight
+    enum class Type { shape, weight };
+    // What the variation changes
+    enum class Target { nominal, leptonSF, jes, jer, pileup, bTag, pdf, meScale, alphaS, isr, fsr };
+
+    std::string name;
+    // Appended to the histogram and tree names, e.g. "__jes__plus"
+    std::string postfix;
+    Type type;
+    Target target;
+    bool up;
+    // Bit of the --syst mask that turns the variation on, 0 for nominal
+    int mask;
+    // Event weight branch multiplied in after the selection, if any
+    std::string weightBranch;
+    Double_t AnalysisEvent::*weight;
+    // Branch used in place of origWeightForNorm in the generator weight, if any
+    std::string generatorWeightBranch;
+    Double_t AnalysisEvent::*generatorWeight;
+
+    bool isNominal() const {
+        return target == Target::nominal;
+    }
+    bool weightOnly() const {
+        return type == Type::weight;
+    }
+    bool varies(const Target what) const {
+        return target == what;
+    }
+};
+
+// The systematic variations the analysis knows about, read from a YAML file.
+// Each entry there makes an up ("__<name>__plus") and a down
+// ("__<name>__minus") variation, switched on by consecutive bits of the
+// --syst mask in the order they are listed. The nominal comes first, at
+// index 0, and always runs.
+class SystematicsRegistry
+{
+    public:
+    SystematicsRegistry();
+    explicit SystematicsRegistry(const std::string& conf);
+
+    size_t size() const {
+        return systematics_.size();
+    }
+    const Systematic& operator[](const size_t index) const {
+        return systematics_[index];
+    }
+    const Systematic& nominal() const {
+        return systematics_.front();
+    }
+    // Whether the variation at index runs for this --syst mask
+    bool runs(const size_t index, const int mask, const bool isMC) const {
+        return index == 0 || (isMC && (systematics_[index].mask & mask));
+    }
+    // Weight branches read by the variations that run for this mask
+    std::vector<std::string> weightBranches(const int mask) const;
+
+    private:
+    std::vector<Systematic> systematics_;
+};
+
+#endif
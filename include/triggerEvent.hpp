@@ -0,0 +1,36 @@
+#ifndef _triggerEvent_hpp_
+#define _triggerEvent_hpp_
+
+#include "analysisEventSchema.hpp"
+#include "eventTriggers.hpp"
+
+#include <TTree.h>
+
+// A slimmed event for the trigger skims: the run and event numbers and the
+// trigger and MET filter bits, without the collections of AnalysisEvent.
+// GetEntry still reads every active branch, so a clone of the tree is filled
+// in full.
+class TriggerEvent : public EventTriggers
+{
+    public:
+    ANALYSISEVENT_EVENTINFO_BRANCHES(ANALYSISEVENT_DECLARE_SCALAR, ANALYSISEVENT_DECLARE_ARRAY)
+
+    TriggerEvent(bool isMC, TTree* tree, bool is2016, bool is2018);
+    Int_t GetEntry(const Long64_t entry) {
+        return fChain->GetEntry(entry);
+    }
+
+    private:
+    TTree* fChain;
+};
+
+inline TriggerEvent::TriggerEvent(const bool isMC, TTree* tree, const bool is2016, const bool is2018)
+    : EventTriggers{is2016, is2018}
+    , fChain{tree}
+{
+    fChain->SetMakeClass(1);
+    bindTriggerBranches(tree, isMC);
+    ANALYSISEVENT_EVENTINFO_BRANCHES(ANALYSISEVENT_BIND_SCALAR, ANALYSISEVENT_BIND_ARRAY)
+}
+
+#endif
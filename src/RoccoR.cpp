@@ -1,10 +1,12 @@
 #ifndef ElectroWeakAnalysis_RoccoR
 #define ElectroWeakAnalysis_RoccoR
 
-#include <fstream>
+#include <algorithm>
+#include <memory>
 #include <sstream>
 #include <stdexcept>
 #include "RoccoR.h"
+#include "conditions.hpp"
 
 const double CrystalBall::pi = 3.14159;
 const double CrystalBall::sqrtPiOver2 = sqrt(CrystalBall::pi/2.0);
@@ -125,7 +127,8 @@ void RoccoR::reset(){
 
 
 void RoccoR::init(std::string filename){
-    std::ifstream in(filename.c_str());
+    std::unique_ptr<std::istream> file = Conditions::open(filename);
+    std::istream& in = *file;
     if(in.fail()) throw std::invalid_argument("RoccoR::init could not open file " + filename);
 
     int RMIN(0), RTRK(0), RETA(0);
@@ -235,7 +238,6 @@ void RoccoR::init(std::string filename){
 	    for(auto &r: rcm.RR.resol)
 		for(auto &i: r.cb) i.init();
 
-    in.close();
 }
 
 const double RoccoR::MPHI=-CrystalBall::pi;
@@ -280,6 +282,32 @@ double RoccoR::kSmearMC(int Q, double pt, double eta, double phi, int n, double
     return k*rc.RR.kExtra(k*pt, eta, n, u);
 }
 
+// The scale of every muon first, with branch free bin lookups, then the
+// resolution terms, whose Crystal Ball constants were set up in init
+void RoccoR::kScale(TYPE T, int size, const int* Q, const double* pt, const double* eta, const double* phi, double* k, int s, int m) const{
+    const auto& cp=RC[s][m].CP[T];
+    const double* edges=etabin.data();
+    for(int i=0; i<size; ++i){
+	int H=0;
+	for(int j=1; j<NETA; ++j) H += eta[i]>=edges[j];
+	int F = std::min(std::max(static_cast<int>((phi[i]-MPHI)/DPHI), 0), NPHI-1);
+	k[i]=1.0/(cp[H][F].M + Q[i]*cp[H][F].A*pt[i]);
+    }
+}
+
+void RoccoR::kScaleDT(int size, const int* Q, const double* pt, const double* eta, const double* phi, double* k, int s, int m) const{
+    kScale(DT, size, Q, pt, eta, phi, k, s, m);
+}
+
+void RoccoR::kCorrectMC(int size, const int* Q, const double* pt, const double* eta, const double* phi, const int* n, const double* gt, const double* u, double* k, int s, int m) const{
+    kScale(MC, size, Q, pt, eta, phi, k, s, m);
+    const auto& rr=RC[s][m].RR;
+    for(int i=0; i<size; ++i){
+	if(gt[i]>0) k[i] *= rr.kSpread(gt[i], k[i]*pt[i], eta[i]);
+	else k[i] *= rr.kExtra(k[i]*pt[i], eta[i], n[i], u[i]);
+    }
+}
+
 
 double RoccoR::kScaleFromGenMC(int Q, double pt, double eta, double phi, int n, double gt, double w, int s, int m) const{
     const auto& rc=RC[s][m];
@@ -0,0 +1,14 @@
+#include "allocationCounter.hpp"
+
+namespace
+{
+    thread_local long long numAllocations{0};
+} // namespace
+
+long long AllocationCounter::count() {
+    return numAllocations;
+}
+
+void AllocationCounter::record() noexcept {
+    numAllocations++;
+}
@@ -6,22 +6,37 @@
 #include "TH1I.h"
 #include "TH2D.h"
 #include "TMVA/Config.h"
+#include "TEnv.h"
+#include "TFile.h"
 #include "TMVA/Timer.h"
 #include "TPad.h"
+#include "TROOT.h"
 #include "TTree.h"
+#include "allocationCounter.hpp"
 #include "analysisAlgo.hpp"
+#include "conditions.hpp"
 #include "config_parser.hpp"
+#include "histogramBuffer.hpp"
 
 #include <LHAPDF/LHAPDF.h>
 #include <boost/filesystem.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <boost/program_options.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <exception>
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 
 AnalysisAlgo::AnalysisAlgo()
     : plots{false}
@@ -41,6 +56,16 @@ AnalysisAlgo::AnalysisAlgo()
     , doZplusCR_{false}
     , noData_ {true}
     , unblind_ {false}
+    , useBranchManifest_ {false}
+    , lazyLoading_ {false}
+    , countAllocations_ {false}
+    , validatePileup_ {false}
+    , numThreads_ {1}
+    , plotProcesses_ {1}
+    , readCache_ {}
+    , systematicsConf_ {"configs/systematicVariations.yaml"}
+    , conditionsSnapshot_ {}
+    , systematics_ {}
 {}
 
 AnalysisAlgo::~AnalysisAlgo() {}
@@ -48,6 +73,10 @@ AnalysisAlgo::~AnalysisAlgo() {}
 void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
     std::stringstream events;
     std::stringstream jetRegion;
+    long long cacheSizeMB{0};
+    int cacheLearnEntries{0};
+    std::vector<std::string> cacheBranches;
+    bool asyncPrefetch{false};
 
     gErrorIgnoreLevel = kInfo;
     // Set up environment a little.
@@ -121,7 +150,9 @@ void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
         "Produce trees after event selection for multivariate analysis.")(
         "syst,v",
         po::value<int>(&systToRun)->default_value(0),
-        "Mask for systematics to be run. 65535 enables all systematics.")(
+        "Mask for systematics to be run. Each variation in the systematics "
+        "config takes one bit, up before down, in the order listed. 1048575 "
+        "enables all systematics in the default config.")(
         "channels,k",
         po::value<int>(&channelsToRun)->default_value(2),
         "Mask describing the channels to be run over. The mask "
@@ -158,7 +189,49 @@ void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
         "Remove blinding criteria! DO NOT USE UNLESS EXPRESS PERMISSION GRANTED")(
         "mwCut",
         po::value<float>(&mwCut)->default_value(20.),
-        "Apply an mW cut. Dilepton only.");
+        "Apply an mW cut. Dilepton only.")(
+        "branchManifest",
+        po::bool_switch(&useBranchManifest_),
+        "Only read the ntuple branches declared by the selection, plots and "
+        "event weights. Cannot be used with -g or --makeMVATree.")(
+        "lazyLoad",
+        po::bool_switch(&lazyLoading_),
+        "Only read the trigger, filter and muon branches for every event, and "
+        "read the other collections when the selection first needs them. "
+        "Cannot be used with -g or --makeMVATree.")(
+        "allocStats",
+        po::bool_switch(&countAllocations_),
+        "Count the heap allocations made by the event selection once each "
+        "thread has seen its first event, and print the total.")(
+        "validatePileup",
+        po::bool_switch(&validatePileup_),
+        "Check the precomputed pileup weights of every MC event against the "
+        "pileup histograms.")(
+        "threads,j",
+        po::value<unsigned>(&numThreads_)->default_value(1),
+        "Number of threads to split each dataset's event loop over. Cannot be "
+        "used with -g or --makeMVATree.")(
+        "plotProcesses",
+        po::value<unsigned>(&plotProcesses_)->default_value(1),
+        "Number of processes to draw the plots in with -p.")(
+        "cacheSize",
+        po::value<long long>(&cacheSizeMB),
+        "TTreeCache size in MB for the dataset chains. 0 disables the cache. "
+        "Overrides readCache in the config.")(
+        "cacheLearnEntries",
+        po::value<int>(&cacheLearnEntries),
+        "Number of entries the TTreeCache learns which branches to cache "
+        "over. 0 caches only the branches given to --cacheBranches.")(
+        "cacheBranches",
+        po::value<std::vector<std::string>>(&cacheBranches)->multitoken(),
+        "Branches (ROOT wildcards allowed) to add to the TTreeCache up front.")(
+        "asyncPrefetch",
+        po::bool_switch(&asyncPrefetch),
+        "Prefetch the next cache block asynchronously.")(
+        "conditions",
+        po::value<std::string>(&conditionsSnapshot_),
+        "Read the scale factors and pileup weights from a snapshot made by "
+        "makeConditionsSnapshot for the same era.");
     po::variables_map vm;
 
     try {
@@ -202,11 +275,50 @@ void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
                       << jetRegVars[1] << "-" << jetRegVars[3] << " b-jets"
                       << std::endl;
         }
+        if (useBranchManifest_ && (makePostLepTree || makeMVATree)) {
+            throw std::logic_error(
+                "--branchManifest cannot be used when cloning the input "
+                "tree (-g or --makeMVATree).");
+        }
+        if (lazyLoading_ && (makePostLepTree || makeMVATree)) {
+            throw std::logic_error(
+                "--lazyLoad cannot be used when cloning the input tree (-g or "
+                "--makeMVATree).");
+        }
+        if (numThreads_ == 0) {
+            throw std::logic_error("--threads must be at least 1.");
+        }
+        if (plotProcesses_ == 0) {
+            throw std::logic_error("--plotProcesses must be at least 1.");
+        }
+        if (numThreads_ > 1 && (makePostLepTree || makeMVATree)) {
+            throw std::logic_error(
+                "--threads cannot be used when writing output trees (-g or "
+                "--makeMVATree).");
+        }
+        if (numThreads_ > 1) {
+            ROOT::EnableThreadSafety();
+            std::cout << "Running event loop over " << numThreads_ << " threads" << std::endl;
+        }
         if (usebTagWeight && !usePostLepTree) {
             throw std::logic_error(
                 "Currently bTag weights can only be retrieved "
                 "from post lepton selection trees. Please set -u.");
         }
+
+        // Read cache settings from the config, overridden by the command
+        // line
+        if (vm.count("cacheSize") && cacheSizeMB < 0) {
+            throw std::logic_error("--cacheSize cannot be negative.");
+        }
+        Parser::parse_read_cache(config, readCache_);
+        if (vm.count("cacheSize")) readCache_.size = cacheSizeMB * 1024 * 1024;
+        if (vm.count("cacheLearnEntries")) readCache_.learnEntries = cacheLearnEntries;
+        if (vm.count("cacheBranches")) readCache_.branches = cacheBranches;
+        if (asyncPrefetch) readCache_.asyncPrefetch = true;
+        if (readCache_.learnEntries < 0) {
+            throw std::logic_error("Cache learn entries cannot be negative.");
+        }
     }
     catch (const std::logic_error& e) {
         std::cerr << "ERROR: " << e.what() << std::endl;
@@ -232,6 +344,15 @@ void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
         throw;
     }
 
+    // Has to be set before any file is opened
+    if (readCache_.asyncPrefetch) gEnv->SetValue("TFile.AsyncPrefetching", 1);
+
+    Parser::parse_systematics(config, systematicsConf_);
+
+    if (!conditionsSnapshot_.empty()) {
+        Conditions::useSnapshot(conditionsSnapshot_, Conditions::era(is2016_, is2016APV_, is2018_));
+    }
+
     if (channelsToRun)  {
         std::cout << "Running over the channels: " << std::endl;
         for (unsigned channelInd = 1; channelInd != 32; channelInd = channelInd << 1) {
@@ -253,91 +374,247 @@ void AnalysisAlgo::parseCommandLineArguements(int argc, char* argv[]){
     }
 }
 
-void AnalysisAlgo::setupSystematics()
+namespace
 {
-    systNames.emplace_back("");
-    systNames.emplace_back("__trig__plus");
-    systNames.emplace_back("__trig__minus");
-    systNames.emplace_back("__jer__plus");
-    systNames.emplace_back("__jer__minus");
-    systNames.emplace_back("__jes__plus");
-    systNames.emplace_back("__jes__minus");
-    systNames.emplace_back("__pileup__plus");
-    systNames.emplace_back("__pileup__minus");
-    systNames.emplace_back("__bTag__plus");
-    systNames.emplace_back("__bTag__minus");
-    systNames.emplace_back("__pdf__plus");
-    systNames.emplace_back("__pdf__minus");
-    systNames.emplace_back("__ME__plus");
-    systNames.emplace_back("__ME__minus");
-    systNames.emplace_back("__alphaS__plus");
-    systNames.emplace_back("__alphaS__minus");
-    systNames.emplace_back("__isr__plus");
-    systNames.emplace_back("__isr__minus");
-    systNames.emplace_back("__fsr__plus");
-    systNames.emplace_back("__fsr__minus");
-
-    if (is2016_ || is2016APV_) { // If 2016 mode, get 2016 PU
-        // Make pileupReweighting stuff here
-        dataPileupFile = new TFile{"pileup/2016/truePileupTest.root", "READ"};
-        dataPU = dynamic_cast<TH1D*>(dataPileupFile->Get("pileup")->Clone());
-        mcPileupFile = new TFile{"pileup/2016/pileupMC.root", "READ"};
-        mcPU = dynamic_cast<TH1D*>(mcPileupFile->Get("pileup")->Clone());
-
-        // Get systematic files too.
-        systUpFile = new TFile{"pileup/2016/truePileupUp.root", "READ"};
-        pileupUpHist = dynamic_cast<TH1D*>(systUpFile->Get("pileup")->Clone());
-        systDownFile = new TFile{"pileup/2016/truePileupDown.root", "READ"};
-        pileupDownHist = dynamic_cast<TH1D*>(systDownFile->Get("pileup")->Clone());
+    std::string pileupDir(const bool is2016, const bool is2016APV, const bool is2018) {
+        // 2016 APV shares the 2016 pileup
+        return (is2016 || is2016APV) ? "pileup/2016/" : is2018 ? "pileup/2018/" : "pileup/2017/";
+    }
+
+    // Data over MC pileup, each normalised to unit area, for the nominal, up
+    // and down data pileup
+    std::array<std::unique_ptr<TH1D>, 3> pileupHistograms(const std::string& dir) {
+        const auto read{[&dir](const std::string& name) {
+            TFile file{(dir + name).c_str(), "READ"};
+            const TH1D* hist{dynamic_cast<TH1D*>(file.Get("pileup"))};
+            if (!hist) {
+                throw std::runtime_error("Unable to read pileup from " + dir + name);
+            }
+            std::unique_ptr<TH1D> copy{dynamic_cast<TH1D*>(hist->Clone())};
+            copy->SetDirectory(nullptr);
+            copy->Scale(1.0 / copy->Integral());
+            return copy;
+        }};
+
+        const std::unique_ptr<TH1D> mcPU{read("pileupMC.root")};
+        std::array<std::unique_ptr<TH1D>, 3> histos{read("truePileupTest.root"), read("truePileupUp.root"), read("truePileupDown.root")};
+        for (const auto& hist : histos) {
+            hist->Divide(mcPU.get());
+        }
+        return histos;
+    }
+
+    // Entries in each block of the event loop
+    constexpr long long MERGE_BLOCK_ENTRIES{10000};
+
+    using PlotMap = std::map<std::string, std::shared_ptr<Plots>>;
+
+    // What a block of entries fills: buffered copies of the plots and cut
+    // flow of every systematic, and the count of selected events
+    struct BlockResults
+    {
+        BlockResults(const std::vector<PlotMap*>& systPlots, const std::vector<TH1D*>& systCutFlows)
+            : plotMaps(systPlots.size())
+            , plots(systPlots.size(), nullptr)
+            , cutFlowBuffers(systCutFlows.size())
+            , cutFlows(systCutFlows.size(), nullptr)
+            , found{0}
+            , foundNorm{0.0}
+        {
+            for (size_t systInd{0}; systInd < systPlots.size(); systInd++) {
+                if (!systPlots[systInd])
+                    continue;
+                for (const auto& stage : *systPlots[systInd]) {
+                    plotMaps[systInd][stage.first] = stage.second->cloneBuffered();
+                }
+                plots[systInd] = &plotMaps[systInd];
+                if (systCutFlows[systInd]) {
+                    cutFlowBuffers[systInd].reset(new HistogramBuffer{*systCutFlows[systInd]});
+                    cutFlows[systInd] = cutFlowBuffers[systInd].get();
+                }
+            }
+        }
+
+        void add(const BlockResults& other) {
+            for (size_t systInd{0}; systInd < plots.size(); systInd++) {
+                if (!plots[systInd])
+                    continue;
+                for (auto& stage : plotMaps[systInd]) {
+                    stage.second->addPlots(*other.plotMaps[systInd].at(stage.first));
+                }
+                if (cutFlows[systInd])
+                    cutFlows[systInd]->add(*other.cutFlows[systInd]);
+            }
+            found += other.found;
+            foundNorm += other.foundNorm;
+        }
+
+        void addTo(const std::vector<PlotMap*>& systPlots, const std::vector<TH1D*>& systCutFlows) const {
+            for (size_t systInd{0}; systInd < plots.size(); systInd++) {
+                if (!plots[systInd])
+                    continue;
+                for (auto& stage : *systPlots[systInd]) {
+                    stage.second->addPlots(*plotMaps[systInd].at(stage.first));
+                }
+                if (cutFlows[systInd])
+                    cutFlows[systInd]->addTo(*systCutFlows[systInd]);
+            }
+        }
+
+        void reset() {
+            for (auto& plotMap : plotMaps) {
+                for (auto& stage : plotMap) {
+                    stage.second->resetBuffers();
+                }
+            }
+            for (auto cutFlow : cutFlows) {
+                if (cutFlow)
+                    cutFlow->reset();
+            }
+            found = 0;
+            foundNorm = 0.0;
+        }
+
+        std::vector<PlotMap> plotMaps;
+        std::vector<PlotMap*> plots;
+        std::vector<std::unique_ptr<HistogramBuffer>> cutFlowBuffers;
+        std::vector<HistogramBuffer*> cutFlows;
+        int found;
+        double foundNorm;
+    };
+
+    // Adds up the results of the blocks in block order, whichever order
+    // they finish in, so the sums come out the same however many threads
+    // ran them. Finished blocks wait here until the ones before them are
+    // in, and their results are then reused for later blocks.
+    class BlockMerger
+    {
+        public:
+        // At most maxOutstanding sets of results are handed out and not yet
+        // merged, besides the one for the next block to merge
+        BlockMerger(const std::vector<PlotMap*>& systPlots, const std::vector<TH1D*>& systCutFlows, const size_t maxOutstanding)
+            : systPlots_{systPlots}
+            , systCutFlows_{systCutFlows}
+            , maxOutstanding_{maxOutstanding}
+            , outstanding_{0}
+            , failed_{false}
+            , nextBlock_{0}
+            , merged_{systPlots, systCutFlows}
+        {
+        }
+
+        // Empty results to fill block into. Blocks past the next one to merge
+        // wait while too many sets are out, so one slow block can't leave the
+        // rest piling up unmerged. Null once a block has failed.
+        std::unique_ptr<BlockResults> take(const long long block) {
+            std::unique_lock<std::mutex> lock{mutex_};
+            canTake_.wait(lock, [this, block]() {
+                return failed_ || block == nextBlock_ || outstanding_ < maxOutstanding_;
+            });
+            if (failed_) {
+                return nullptr;
+            }
+            outstanding_++;
+            if (!free_.empty()) {
+                std::unique_ptr<BlockResults> results{std::move(free_.back())};
+                free_.pop_back();
+                return results;
+            }
+            lock.unlock();
+            return std::unique_ptr<BlockResults>{new BlockResults{systPlots_, systCutFlows_}};
+        }
+
+        void finish(const long long block, std::unique_ptr<BlockResults> results) {
+            {
+                const std::lock_guard<std::mutex> lock{mutex_};
+                pending_[block] = std::move(results);
+                for (auto next{pending_.find(nextBlock_)}; next != pending_.end(); next = pending_.find(++nextBlock_)) {
+                    merged_.add(*next->second);
+                    next->second->reset();
+                    free_.emplace_back(std::move(next->second));
+                    pending_.erase(next);
+                    outstanding_--;
+                }
+            }
+            canTake_.notify_all();
+        }
+
+        // A block won't be finished, so wake everything waiting for it
+        void fail() {
+            {
+                const std::lock_guard<std::mutex> lock{mutex_};
+                failed_ = true;
+            }
+            canTake_.notify_all();
+        }
+
+        // Once every block is finished
+        const BlockResults& merged() const {
+            return merged_;
+        }
+
+        private:
+        const std::vector<PlotMap*>& systPlots_;
+        const std::vector<TH1D*>& systCutFlows_;
+        const size_t maxOutstanding_;
+        std::mutex mutex_;
+        std::condition_variable canTake_;
+        size_t outstanding_;
+        bool failed_;
+        std::map<long long, std::unique_ptr<BlockResults>> pending_;
+        std::vector<std::unique_ptr<BlockResults>> free_;
+        long long nextBlock_;
+        BlockResults merged_;
+    };
+} // namespace
+
+const ScaleFactorTable& AnalysisAlgo::loadPileupWeights(const bool is2016, const bool is2016APV, const bool is2018) {
+    const std::string dir{pileupDir(is2016, is2016APV, is2018)};
+    return Conditions::table(Conditions::era(is2016, is2016APV, is2018) + "/pileupWeights", [&dir]() {
+        const std::array<std::unique_ptr<TH1D>, 3> histos{pileupHistograms(dir)};
+        return ScaleFactorTable{*histos[0], *histos[1], *histos[2]};
+    });
+}
 
+void AnalysisAlgo::setupSystematics()
+{
+    systematics_ = SystematicsRegistry{systematicsConf_};
+    for (size_t systInd{0}; systInd < systematics_.size(); systInd++) {
+        systNames.emplace_back(systematics_[systInd].postfix);
     }
-    else if (is2018_) {
-        // Make pileupReweighting stuff here
-        dataPileupFile = new TFile{"pileup/2018/truePileupTest.root", "READ"};
-        dataPU = dynamic_cast<TH1D*>(dataPileupFile->Get("pileup")->Clone());
-        mcPileupFile = new TFile{"pileup/2018/pileupMC.root", "READ"};
-        mcPU = dynamic_cast<TH1D*>(mcPileupFile->Get("pileup")->Clone());
-
-        // Get systematic files too.
-        systUpFile = new TFile{"pileup/2018/truePileupUp.root", "READ"};
-        pileupUpHist = dynamic_cast<TH1D*>(systUpFile->Get("pileup")->Clone());
-        systDownFile = new TFile{"pileup/2018/truePileupDown.root", "READ"};
-        pileupDownHist = dynamic_cast<TH1D*>(systDownFile->Get("pileup")->Clone());
+
+    pileupWeights_ = loadPileupWeights(is2016_, is2016APV_, is2018_);
+    // Every numVert above the last edge takes the last bin
+    const int maxNumVert{static_cast<int>(std::floor(pileupWeights_.xMax())) + 1};
+    pileupWeightsByNumVert_.clear();
+    for (int numVert{0}; numVert <= maxNumVert; numVert++) {
+        pileupWeightsByNumVert_.emplace_back(pileupWeights_.at(numVert));
     }
-    else { // If 2017 mode, get 2017 PU
-        // Make pileupReweighting stuff here
-        dataPileupFile = new TFile{"pileup/2017/truePileupTest.root", "READ"};
-        dataPU = dynamic_cast<TH1D*>(dataPileupFile->Get("pileup")->Clone());
-        mcPileupFile = new TFile{"pileup/2017/pileupMC.root", "READ"};
-        mcPU = dynamic_cast<TH1D*>(mcPileupFile->Get("pileup")->Clone());
-
-        // Get systematic files too.
-        systUpFile = new TFile{"pileup/2017/truePileupUp.root", "READ"};
-        pileupUpHist = dynamic_cast<TH1D*>(systUpFile->Get("pileup")->Clone());
-        systDownFile = new TFile{"pileup/2017/truePileupDown.root", "READ"};
-        pileupDownHist = dynamic_cast<TH1D*>(systDownFile->Get("pileup")->Clone());
+
+    if (validatePileup_) {
+        pileupHistos_ = pileupHistograms(pileupDir(is2016_, is2016APV_, is2018_));
     }
+}
 
-    puReweight = dynamic_cast<TH1D*>(dataPU->Clone());
-    puReweight->Scale(1.0 / puReweight->Integral());
-    mcPU->Scale(1.0 / mcPU->Integral());
-    puReweight->Divide(mcPU);
-    puReweight->SetDirectory(nullptr);
-
-    /// And do the same for systematic sampl
-    puSystUp = dynamic_cast<TH1D*>(pileupUpHist->Clone());
-    puSystUp->Scale(1.0 / puSystUp->Integral());
-    puSystUp->Divide(mcPU);
-    puSystUp->SetDirectory(nullptr);
-    puSystDown = dynamic_cast<TH1D*>(pileupDownHist->Clone());
-    puSystDown->Scale(1.0 / puSystDown->Integral());
-    puSystDown->Divide(mcPU);
-    puSystDown->SetDirectory(nullptr);
-
-    dataPileupFile->Close();
-    mcPileupFile->Close();
-    systUpFile->Close();
-    systDownFile->Close();
+void AnalysisAlgo::checkPileupWeights(const int numVert, const ScaleFactorTable::entry& weights) const {
+    const double values[3]{weights.nominal, weights.up, weights.down};
+    for (size_t i{0}; i < pileupHistos_.size(); i++) {
+        const TH1D& hist{*pileupHistos_[i]};
+        // FindFixBin, as FindBin may extend the axis and isn't safe to call
+        // from the worker threads. Outside the axis the table clamps to the
+        // edge bins, which the histogram has nothing to say about.
+        const int bin{hist.GetXaxis()->FindFixBin(numVert)};
+        if (bin < 1 || bin > hist.GetNbinsX()) {
+            continue;
+        }
+        const double expected{hist.GetBinContent(bin)};
+        // The table copies the bin contents, so they must match bit for bit
+        if (std::memcmp(&values[i], &expected, sizeof(double)) != 0) {
+            std::ostringstream error;
+            error << "Pileup weight " << i << " for numVert " << numVert << " is " << values[i] << " but the histogram gives " << expected;
+            throw std::logic_error(error.str());
+        }
+    }
 }
 
 void AnalysisAlgo::setupCuts()
@@ -449,12 +726,10 @@ void AnalysisAlgo::runMainAnalysis() {
                     plotType{dataset->getPlotType()};
                 int plotColour{dataset->getColour()};
 
-                int systMask{1};
                 for (unsigned systInd{0}; systInd < systNames.size(); systInd++)
                 {
-                    if (systInd > 0 && !(systToRun & systMask))
+                    if (!systematics_.runs(systInd, systToRun, true))
                     {
-                        systMask = systMask << 1;
                         continue;
                     }
                     if (cutFlowMap.find(histoName + systNames[systInd])
@@ -492,8 +767,6 @@ void AnalysisAlgo::runMainAnalysis() {
                             }
                         }
                     } // end cutFlow find loop
-                    if (systInd > 0)
-                        systMask = systMask << 1;
                 } // end systematic loop
 
             } // end plots if statement
@@ -654,6 +927,26 @@ void AnalysisAlgo::runMainAnalysis() {
             
             AnalysisEvent event{dataset->isMC(), datasetChain, (is2016_ || is2016APV_), is2018_};
 
+            // Only read the branches that the selection, plots and weights use
+            std::vector<std::string> branchManifest;
+            if (useBranchManifest_) {
+                branchManifest = cutObj->getBranchManifest();
+                branchManifest.insert(branchManifest.end(), {"numVert", "origWeightForNorm", "topPtReweight"});
+                const std::vector<std::string> systBranches{systematics_.weightBranches(systToRun)};
+                branchManifest.insert(branchManifest.end(), systBranches.begin(), systBranches.end());
+                if (plots) {
+                    for (const auto& stage : plotsMap[channel][dataset->getFillHisto()]) {
+                        const auto& plotBranches{stage.second->getBranchManifest()};
+                        branchManifest.insert(branchManifest.end(), plotBranches.begin(), plotBranches.end());
+                    }
+                }
+                event.setBranchManifest(branchManifest);
+            }
+            if (lazyLoading_) {
+                event.setLazyLoading();
+            }
+            setupReadCache(datasetChain);
+
             // Adding in some stuff here to make a skim file out of post lep sel
             // stuff
             TFile* outFile1{nullptr};
@@ -709,19 +1002,11 @@ void AnalysisAlgo::runMainAnalysis() {
                     throw std::runtime_error(
                         "MVA Tree TFile could not be opened!");
                 }
-                int systMask{1};
                 // std::cout << "Making systematic trees for " <<
                 // dataset->name() << ": ";
                 for (unsigned systIn{0}; systIn < systNames.size(); systIn++)
                 {
                     // std::cout << systNames[systIn] << " ";
-                    //  	std::cout << "Making systs: " << systMask << " " <<
-                    //  systToRun << " " << systIn << " " << (systMask &
-                    //  systToRun) << std::endl;
-                    /*  	if (systIn > 0 && !(systMask & systToRun)){
-                      if (systIn > 0) systMask = systMask << 1;
-                      continue;
-                      }*/
                     mvaTree.emplace_back(datasetChain->CloneTree(0));
                     mvaTree[systIn]->SetDirectory(mvaOutFile);
                     mvaTree[systIn]->SetName(
@@ -744,10 +1029,6 @@ void AnalysisAlgo::runMainAnalysis() {
                     mvaTree[systIn]->Branch(
                         "bJetInd", &bJetInd, "bJetInd[10]/I");
                     mvaTree[systIn]->Branch("isMC", &isMC, "isMC/I");
-                    if (systIn > 0)
-                    {
-                        systMask = systMask << 1;
-                    }
                 }
                 std::cout << std::endl;
             }
@@ -800,180 +1081,312 @@ void AnalysisAlgo::runMainAnalysis() {
               || dataset->name() == "QCD_Pt-80to120_MuEnrichedPt5") {
                hasLHE = false;
             }
+            const std::string histoName{dataset->getFillHisto()};
+
+            // Resolve the plots and cut flow each systematic fills once per
+            // dataset rather than looking them up for every event.
+            std::vector<std::map<std::string, std::shared_ptr<Plots>>*> systPlots(systNames.size(), nullptr);
+            std::vector<TH1D*> systCutFlows(systNames.size(), nullptr);
+            for (unsigned systInd{0}; systInd < systNames.size(); systInd++) {
+                if (!systematics_.runs(systInd, systToRun, dataset->isMC()))
+                    continue;
+                systPlots[systInd] = &plotsMap[systNames[systInd] + channel][histoName];
+                systCutFlows[systInd] = cutFlowMap[histoName + systNames[systInd]];
+            }
+
             TMVA::Timer* lEventTimer{new TMVA::Timer{boost::numeric_cast<int>(numberOfEvents), "Running over dataset ...", false}};
             lEventTimer->DrawProgressBar(0, "");
             std::cout << "Numnber of events: " << numberOfEvents << std::endl;
-            for (int i{0}; i < numberOfEvents; i++) {
-                std::stringstream lSStrFoundEvents;
-                lSStrFoundEvents << foundEvents;
-                lEventTimer->DrawProgressBar(i, ("Found " + lSStrFoundEvents.str() + " events."));
-                event.GetEntry(i);
-                // Do the systematics indicated by the systematic flag, oooor
-                // just do data if that's your thing. Whatevs.
-                int systMask{1};
-                for (unsigned systInd{0}; systInd < systNames.size(); systInd++)
-                {
-                    if (!dataset->isMC() && systInd > 0)
-                        break;
-                    //	std::cout << systInd << " " << systMask << std::endl;
-                    if (systInd > 0 && !(systMask & systToRun)) {
-                        if (systInd > 0)
-                            systMask = systMask << 1;
-                        continue;
-                    }
 
-                    eventWeight = 1;
-
-                    // apply generator weights here.
-                    double generatorWeight{1.0};
-                    if (dataset->isMC() && hasLHE) {
-                        if (systMask == 4096)
-                            generatorWeight = (sumPositiveWeights_) / (sumNegativeWeightsScaleDown_) * (event.weight_muF0p5muR0p5 / std::abs(event.origWeightForNorm));
-                        else if (systMask == 8192)
-                            generatorWeight = (sumPositiveWeights_) / (sumNegativeWeightsScaleUp_) * (event.weight_muF2muR2 / std::abs(event.origWeightForNorm));
-                        else
-                            generatorWeight = (sumPositiveWeights_) / (sumNegativeWeights_) * (event.origWeightForNorm / std::abs(event.origWeightForNorm));
-
-                        //	    	      std::cout << std::setprecision(5) <<
-                        // std::fixed; 	                std::cout <<
-                        // sumPositiveWeights_ << "/" << sumNegativeWeights_ <<
-                        // "*" << event.origWeightForNorm
-                        //<< "/" << std::abs(event.origWeightForNorm) <<
-                        // std::endl; 	                std::cout << "generator
-                        // level SF = " << generatorWeight << std::endl;
-                        // std::cout << "NB. This should only not be 1.0 for
-                        // aMC@NLO." << std::endl;
+            // Runs the selection over entries [firstEntry, lastEntry),
+            // filling the buffered plots and cut flows of one block. When
+            // threaded, each worker passes in its own event and cuts so
+            // nothing in here is shared between threads.
+            std::atomic<long long> processedEvents{0};
+            // Events found in the blocks done so far, for the progress bar
+            std::atomic<int> foundSoFar{0};
+            // Heap allocations in the selection, not counting the first
+            // event of each thread, which sizes the reused buffers
+            std::atomic<long long> selectionAllocations{0};
+            std::atomic<long long> steadyStateEvents{0};
+            // Events whose pileup weights were checked against the histograms
+            std::atomic<long long> pileupChecks{0};
+            const Long64_t bytesReadBefore{TFile::GetFileBytesRead()};
+            const Int_t readCallsBefore{TFile::GetFileReadCalls()};
+            auto processEvents = [&](AnalysisEvent& evt,
+                                     Cuts& cuts,
+                                     const std::vector<std::map<std::string, std::shared_ptr<Plots>>*>& evtPlots,
+                                     const std::vector<HistogramBuffer*>& evtCutFlows,
+                                     const long long firstEntry,
+                                     const long long lastEntry,
+                                     const bool drawProgress,
+                                     bool& firstEvent,
+                                     int& found,
+                                     double& foundNorm,
+                                     double& evtWeight) {
+                std::vector<Cuts::SystVariation> variations;
+                variations.reserve(systNames.size());
+                for (long long entry{firstEntry}; entry < lastEntry; entry++) {
+                    const long long processed{processedEvents++};
+                    if (drawProgress) {
+                        std::stringstream lSStrFoundEvents;
+                        lSStrFoundEvents << foundSoFar + found;
+                        lEventTimer->DrawProgressBar(boost::numeric_cast<int>(processed), ("Found " + lSStrFoundEvents.str() + " events."));
+                    }
+                    evt.GetEntry(entry);
+                    const bool countAllocations{countAllocations_ && !firstEvent};
+                    firstEvent = false;
+                    if (countAllocations) steadyStateEvents++;
+                    // Do the systematics indicated by the systematic flag, oooor
+                    // just do data if that's your thing. Whatevs.
+                    // The weights of every requested systematic are worked out
+                    // first, then the selection runs once for all of them.
+                    // The jet selection is rerun only for the systematics that
+                    // change it; weight-only ones share the nominal jets.
+                    variations.clear();
+                    if (dataset->isMC() && validatePileup_) {
+                        checkPileupWeights(evt.numVert, pileupWeights(evt.numVert));
+                        pileupChecks++;
                     }
+                    for (unsigned systInd{0}; systInd < systNames.size(); systInd++)
+                    {
+                        if (!systematics_.runs(systInd, systToRun, dataset->isMC()))
+                            continue;
+                        const Systematic& systematic{systematics_[systInd]};
+
+                        evtWeight = 1;
+
+                        // apply generator weights here.
+                        double generatorWeight{1.0};
+                        if (dataset->isMC() && hasLHE) {
+                            // Only the ME scale variations reweight the generator
+                            // weight, normalised to their own sums of weights
+                            if (systematic.generatorWeight)
+                                generatorWeight = (sumPositiveWeights_) / (systematic.up ? sumNegativeWeightsScaleDown_ : sumNegativeWeightsScaleUp_) * (evt.*systematic.generatorWeight / std::abs(evt.origWeightForNorm));
+                            else
+                                generatorWeight = (sumPositiveWeights_) / (sumNegativeWeights_) * (evt.origWeightForNorm / std::abs(evt.origWeightForNorm));
+
+                            //	    	      std::cout << std::setprecision(5) <<
+                            // std::fixed; 	                std::cout <<
+                            // sumPositiveWeights_ << "/" << sumNegativeWeights_ <<
+                            // "*" << evt.origWeightForNorm
+                            //<< "/" << std::abs(evt.origWeightForNorm) <<
+                            // std::endl; 	                std::cout << "generator
+                            // level SF = " << generatorWeight << std::endl;
+                            // std::cout << "NB. This should only not be 1.0 for
+                            // aMC@NLO." << std::endl;
+                        }
 
-                    eventWeight *= generatorWeight;
+                        evtWeight *= generatorWeight;
 
-                    // apply pileup weights here.
-                    if (dataset->isMC())
-                    { // no weights applied for synchronisation
-                        double pileupWeight{puReweight->GetBinContent(
-                            puReweight->GetXaxis()->FindBin(event.numVert))};
-                        if (systMask == 64)
+                        // No pileup weights applied for synchronisation
+    //                    if (dataset->isMC()) evtWeight *= pileupWeights(evt.numVert).nominal;
+
+                        // Scale according to lumi
+                        evtWeight *= datasetWeight;
+
+                        // apply negative weighting for SameSign MC lepton samples
+                        // so that further downstream
+                        if (dataset->isMC() && invertLepCut && !plots)
                         {
-                            pileupWeight = puSystUp->GetBinContent(
-                                puSystUp->GetXaxis()->FindBin(event.numVert));
+                            evtWeight *= -1.0; // Should NOT be done when plotting non-prompts - separate code for that
                         }
-                        if (systMask == 128)
+
+                        // Apply in cutClass, as the RATIO weight of OS/SS
+                        // non-prompts cannot be applied before charge cuts (Z cand
+                        // cuts) are applied If NPLs shape (for plotting purposes)
+                        // apply OS/SS ratio SF
+                        // if ( plots && doNpls_ && dataset->getPlotLabel() == "NPL"
+                        // && !trileptonChannel_ ) { if ( channel == "ee" )
+                        // evtWeight *= 1.24806; if ( channel == "mumu" )
+                        // evtWeight *= 1.03226; if ( dataset->isMC() )
+                        // evtWeight
+                        // *= -1.0;
+                        //}
+
+                        // If ttbar, do reweight
+                        //          std::cout << "evtWeight: " << evtWeight <<
+                        //          std::endl;
+                        if (dataset->name() == "ttbarInclusivePowerheg"
+                            || dataset->name()
+                                   == "ttbarInclusivePowerheg_colourFlip"
+                            || dataset->name() == "ttbarInclusivePowerheg_hdampUP"
+                            || dataset->name() == "ttbarInclusivePowerheg_hdampDown"
+                            || dataset->name() == "ttbarInclusivePowerheg_fsrup"
+                            || dataset->name() == "ttbarInclusivePowerheg_fsrdown"
+                            || dataset->name() == "ttbarInclusivePowerheg_isrup"
+                            || dataset->name() == "ttbarInclusivePowerheg_isrdown"
+                            || dataset->name() == "ttbar_2l2v"
+                            || dataset->name() == "ttbar_hadronic"
+                            || dataset->name() == "ttbar_semileptonic")
                         {
-                            pileupWeight = puSystDown->GetBinContent(
-                                puSystDown->GetXaxis()->FindBin(event.numVert));
+                            evtWeight *= evt.topPtReweight;
                         }
-//                        eventWeight *= pileupWeight;
-                        // std::cout << "pileupWeight: " <<  pileupWeight <<
-                        // std::endl;
-                    }
+                        //	  std::cout << "evt.topPtReweight: " <<
+                        // evt.topPtReweight << std::endl;
+                        //          std::cout << "evtWeight: " << evtWeight <<
+                        //          std::endl;
 
-                    // Scale according to lumi
-                    eventWeight *= datasetWeight;
-
-                    // apply negative weighting for SameSign MC lepton samples
-                    // so that further downstream
-                    if (dataset->isMC() && invertLepCut && !plots)
-                    {
-                        eventWeight *= -1.0; // Should NOT be done when plotting non-prompts - separate code for that
+                        //	  std::cout << "channel: " << channel << std::endl;
+                        variations.push_back({&systematic, evtWeight, evtPlots[systInd], evtCutFlows[systInd], systInd});
                     }
 
-                    // Apply in cutClass, as the RATIO weight of OS/SS
-                    // non-prompts cannot be applied before charge cuts (Z cand
-                    // cuts) are applied If NPLs shape (for plotting purposes)
-                    // apply OS/SS ratio SF
-                    // if ( plots && doNpls_ && dataset->getPlotLabel() == "NPL"
-                    // && !trileptonChannel_ ) { if ( channel == "ee" )
-                    // eventWeight *= 1.24806; if ( channel == "mumu" )
-                    // eventWeight *= 1.03226; if ( dataset->isMC() )
-                    // eventWeight
-                    // *= -1.0;
-                    //}
-
-                    // If ttbar, do reweight
-                    //          std::cout << "eventWeight: " << eventWeight <<
-                    //          std::endl;
-                    if (dataset->name() == "ttbarInclusivePowerheg"
-                        || dataset->name()
-                               == "ttbarInclusivePowerheg_colourFlip"
-                        || dataset->name() == "ttbarInclusivePowerheg_hdampUP"
-                        || dataset->name() == "ttbarInclusivePowerheg_hdampDown"
-                        || dataset->name() == "ttbarInclusivePowerheg_fsrup"
-                        || dataset->name() == "ttbarInclusivePowerheg_fsrdown"
-                        || dataset->name() == "ttbarInclusivePowerheg_isrup"
-                        || dataset->name() == "ttbarInclusivePowerheg_isrdown"
-                        || dataset->name() == "ttbar_2l2v"
-                        || dataset->name() == "ttbar_hadronic"
-                        || dataset->name() == "ttbar_semileptonic")
-                    {
-                        eventWeight *= event.topPtReweight;
-                    }
-                    //	  std::cout << "event.topPtReweight: " <<
-                    // event.topPtReweight << std::endl;
-                    //          std::cout << "eventWeight: " << eventWeight <<
-                    //          std::endl;
-
-                    //	  std::cout << "channel: " << channel << std::endl;
-                    std::string histoName{dataset->getFillHisto()};
-
-                    if (!cutObj->makeCuts(
-                            event,
-                            eventWeight,
-                            plotsMap[systNames[systInd] + channel][histoName],
-                            *cutFlowMap[histoName + systNames[systInd]],
-                            systInd ? systMask : systInd))
-                    {
-                        if (systInd)
-                        {
-                            systMask = systMask << 1;
+                    long long allocationsBefore{AllocationCounter::count()};
+                    const bool passedSharedCuts{cuts.makeSharedCuts(evt, variations)};
+                    if (countAllocations) selectionAllocations += AllocationCounter::count() - allocationsBefore;
+                    if (!passedSharedCuts) continue;
+
+                    for (size_t selected{0}; selected < variations.size(); selected++) {
+                        if (variations[selected].systematic->weightOnly()) continue;
+                        allocationsBefore = AllocationCounter::count();
+                        const bool passedSystCuts{cuts.makeSystCuts(evt, variations, selected)};
+                        if (countAllocations) selectionAllocations += AllocationCounter::count() - allocationsBefore;
+                        if (!passedSystCuts) continue;
+
+                        // Every variation that shares this jet selection
+                        for (auto& variation : variations) {
+                            if (!Cuts::sharesSelection(variations[selected], variation)) continue;
+
+                            const unsigned systInd{variation.index};
+                            evtWeight = variation.weight;
+
+                            // PDF, alpha_s and PS weights
+                            if (variation.systematic->weight) evtWeight *= evt.*variation.systematic->weight;
+
+                            // Do the Zpt reweighting here
+                            if (makeMVATree) {
+                                zLep1Index = evt.zPairIndex.first;
+                                zLep2Index = evt.zPairIndex.second;
+                                wQuark1Index = evt.wPairIndex.first;
+                                wQuark2Index = evt.wPairIndex.second;
+                                for (unsigned i{0}; i < 15; i++) {
+                                    if (i < evt.jetIndex.size()) {
+                                        jetInd[i] = evt.jetIndex[i];
+                                        jetSmearValue[i] =  evt.jetSmearValue.at(jetInd[i]);
+                                    }
+                                    else {
+                                        jetInd[i] = -1;
+                                        jetSmearValue[i] = 0.0;
+                                    }
+                                }
+                                for (unsigned bJetIt{0}; bJetIt < 10; bJetIt++) {
+                                    if (bJetIt < evt.bTagIndex.size()) bJetInd[bJetIt] = evt.bTagIndex[bJetIt];
+                                    else bJetInd[bJetIt] = -1;
+                                }
+                                for (size_t i{0}; i < evt.muonMomentumSF.size(); ++i)  muonMomentumSF[i] = evt.muonMomentumSF[i];
+                                mvaTree[systInd]->Fill();
+                            }
+
+                            found++;
+                            foundNorm += evtWeight;
                         }
-                        continue;
+                    } // End systematics loop.
+                } // end event loop
+            };
+
+            // The entries are run in fixed blocks, each filling its own
+            // buffered plots and cut flows without locks. The blocks are
+            // merged in entry order and the sum added to the histograms once
+            // the dataset is done, so the plots are the same to the last bit
+            // for any number of threads. Two sets of results per thread
+            // leave room for the blocks to finish out of order.
+            BlockMerger merger{systPlots, systCutFlows, 2 * size_t{numThreads_}};
+            const long long numBlocks{(numberOfEvents + MERGE_BLOCK_ENTRIES - 1) / MERGE_BLOCK_ENTRIES};
+            std::atomic<long long> nextBlock{0};
+            auto runBlocks = [&](AnalysisEvent& evt, Cuts& cuts, const bool drawProgress, double& evtWeight) {
+                bool firstEvent{true};
+                for (long long block{nextBlock++}; block < numBlocks; block = nextBlock++) {
+                    std::unique_ptr<BlockResults> results{merger.take(block)};
+                    if (!results) {
+                        break;
                     }
-
-                    if (systMask == 1024 || systMask == 2048) {
-                        if (systMask == 1024) eventWeight *= event.weight_pdfMax; // Max
-                        if (systMask == 2048) eventWeight *= event.weight_pdfMin; // Min
+                    const long long firstEntry{block * MERGE_BLOCK_ENTRIES};
+                    const long long lastEntry{std::min(firstEntry + MERGE_BLOCK_ENTRIES, numberOfEvents)};
+                    processEvents(evt, cuts, results->plots, results->cutFlows, firstEntry, lastEntry, drawProgress, firstEvent, results->found, results->foundNorm, evtWeight);
+                    foundSoFar += results->found;
+                    merger.finish(block, std::move(results));
+                }
+            };
+
+            Long64_t lazyBytesRead{0};
+            long long jecLookups{0};
+            if (numThreads_ < 2 || numBlocks < 2) {
+                const long long jecLookupsBefore{cutObj->jecLookups()};
+                runBlocks(event, *cutObj, true, eventWeight);
+                lazyBytesRead = event.lazyBytesRead();
+                jecLookups = cutObj->jecLookups() - jecLookupsBefore;
+            }
+            else {
+                // Each worker takes the next block to run until there are
+                // none left, reading through its own chain with its own copy
+                // of the cuts.
+                const size_t nWorkerSlots{boost::numeric_cast<size_t>(std::min<long long>(numThreads_, numBlocks))};
+                std::vector<TChain*> workerChains;
+                std::vector<std::unique_ptr<AnalysisEvent>> workerEvents;
+                std::vector<std::unique_ptr<Cuts>> workerCuts;
+                std::vector<double> workerWeights(nWorkerSlots, 0.0);
+                std::vector<std::exception_ptr> workerErrors(nWorkerSlots);
+
+                for (size_t w{0}; w < nWorkerSlots; w++) {
+                    TChain* chain{new TChain{dataset->treeName().c_str()}};
+                    chain->Add(datasetChain);
+                    workerChains.emplace_back(chain);
+                    workerEvents.emplace_back(new AnalysisEvent{dataset->isMC(), chain, (is2016_ || is2016APV_), is2018_});
+                    if (useBranchManifest_) {
+                        workerEvents.back()->setBranchManifest(branchManifest);
                     }
-                    if (systMask == 16384 || systMask == 32768) {
-                        if (systMask == 16384) eventWeight *= event.weight_alphaMin; // Max, but incorrectly named branch
-                        if (systMask == 32768) eventWeight *= event.weight_alphaMax; // Min, but incorrectly named branch
+                    if (lazyLoading_) {
+                        workerEvents.back()->setLazyLoading();
                     }
+                    setupReadCache(chain);
+                    workerCuts.emplace_back(cutObj->clone());
+                }
 
-                    // PSWeights
-                    if (systMask == 65536)  eventWeight *= event.isrDefLo;
-                    if (systMask == 131072) eventWeight *= event.isrDefHi;
-                    if (systMask == 262144) eventWeight *= event.fsrDefLo;
-                    if (systMask == 524288) eventWeight *= event.fsrDefHi;
-
-                    // Do the Zpt reweighting here
-                    if (makeMVATree) {
-                        zLep1Index = event.zPairIndex.first;
-                        zLep2Index = event.zPairIndex.second;
-                        wQuark1Index = event.wPairIndex.first;
-                        wQuark2Index = event.wPairIndex.second;
-                        for (unsigned i{0}; i < 15; i++) {
-                            if (i < event.jetIndex.size()) {
-                                jetInd[i] = event.jetIndex[i];
-                                jetSmearValue[i] =  event.jetSmearValue.at(jetInd[i]);
-                            }
-                            else {
-                                jetInd[i] = -1;
-                                jetSmearValue[i] = 0.0;
-                            }
+                std::vector<std::thread> workers;
+                for (size_t w{0}; w < nWorkerSlots; w++) {
+                    workers.emplace_back([&, w]() {
+                        try {
+                            runBlocks(*workerEvents[w], *workerCuts[w], w == 0, workerWeights[w]);
                         }
-                        for (unsigned bJetIt{0}; bJetIt < 10; bJetIt++) {
-                            if (bJetIt < event.bTagIndex.size()) bJetInd[bJetIt] = event.bTagIndex[bJetIt];
-                            else bJetInd[bJetIt] = -1;
+                        catch (...) {
+                            workerErrors[w] = std::current_exception();
+                            merger.fail();
                         }
-                        for (size_t i{0}; i < event.muonMomentumSF.size(); ++i)  muonMomentumSF[i] = event.muonMomentumSF[i];
-                        mvaTree[systInd]->Fill();
-                    }
-
-                    foundEvents++;
-                    foundEventsNorm += eventWeight;
-                    if (systInd > 0) systMask = systMask << 1;
+                    });
+                }
+                for (auto& worker : workers) {
+                    worker.join();
+                }
+                for (const auto& error : workerErrors) {
+                    if (error)
+                        std::rethrow_exception(error);
+                }
+                for (const auto& workerEvent : workerEvents) {
+                    lazyBytesRead += workerEvent->lazyBytesRead();
+                }
+                for (const auto& cuts : workerCuts) {
+                    jecLookups += cuts->jecLookups();
+                }
 
-                } // End systematics loop.
-            } // end event loop
+                // The events hold on to their chains, so they go first.
+                workerEvents.clear();
+                for (auto chain : workerChains) {
+                    delete chain;
+                }
+            }
+            merger.merged().addTo(systPlots, systCutFlows);
+            foundEvents += merger.merged().found;
+            foundEventsNorm += merger.merged().foundNorm;
+            if (lazyLoading_) {
+                std::cout << "\nLazily loaded collections read " << lazyBytesRead << " bytes" << std::endl;
+            }
+            if (countAllocations_) {
+                std::cout << "\nSelection made " << selectionAllocations << " heap allocations in " << steadyStateEvents << " events after each thread's first" << std::endl;
+            }
+            if (validatePileup_) {
+                std::cout << "\nPileup weights of " << pileupChecks << " events checked against the histograms" << std::endl;
+            }
+            std::cout << "\nJEC uncertainty lookups: " << jecLookups << std::endl;
 
             // If we're making post lepSel skims save the tree here
             if (makePostLepTree) {
@@ -1004,21 +1417,13 @@ void AnalysisAlgo::runMainAnalysis() {
                 std::cout << (mvaDir + dataset->name() + postfix + (invertLepCut ? invPostFix : "") + "mvaOut.root") << std::endl;
                 mvaOutFile->cd();
                 std::cout << std::endl;
-                int systMask{1};
                 std::cout << "Saving Systematics: ";
                 for (unsigned systInd{0}; systInd < systNames.size(); systInd++) {
-                    if (systInd > 0 && !(systToRun & systMask)) {
-                        systMask = systMask << 1;
+                    if (!systematics_.runs(systInd, systToRun, dataset->isMC())) {
                         continue;
                     }
                     std::cout << systNames[systInd] << ": "  << mvaTree[systInd]->GetEntriesFast() << " " << std::flush;
                     mvaTree[systInd]->FlushBaskets();
-                    if (systInd > 0) {
-                        systMask = systMask << 1;
-                    }
-                    if (!dataset->isMC()) {
-                        break;
-                    }
                 }
                 std::cout << std::endl;
                 // Save the efficiency plots for b-tagging here if we're doing
@@ -1032,6 +1437,7 @@ void AnalysisAlgo::runMainAnalysis() {
             }
             std::cerr << "\nFound " << foundEvents << " in " << dataset->name() << std::endl;
             std::cerr << "Found " << foundEventsNorm << " after normalisation in " << dataset->name() << std::endl;
+            std::cerr << "Read " << (TFile::GetFileBytesRead() - bytesReadBefore) << " bytes in " << (TFile::GetFileReadCalls() - readCallsBefore) << " read calls for " << dataset->name() << std::endl;
             std::cerr << "\n\n";
             // Delete generator level plot. Avoid memory leaks, kids.
             delete generatorWeightPlot;
@@ -1047,6 +1453,18 @@ void AnalysisAlgo::runMainAnalysis() {
     } // end dataset loop
 }
 
+void AnalysisAlgo::setupReadCache(TChain* chain) const {
+    if (readCache_.size >= 0) chain->SetCacheSize(readCache_.size);
+    if (readCache_.size == 0) return;
+
+    chain->SetCacheLearnEntries(readCache_.learnEntries);
+    for (const auto& branch : readCache_.branches) {
+        chain->AddBranchToCache(branch.c_str(), true);
+    }
+    // With no learning phase only the listed branches are cached
+    if (readCache_.learnEntries == 0) chain->StopCacheLearningPhase();
+}
+
 void AnalysisAlgo::savePlots() {
     // Save all plot objects. For testing purposes.
 
@@ -1080,6 +1498,7 @@ std::cout << is2018_ << std::endl;
             plotObj.setLabelTwo("Some amount of lumi");
             plotObj.setPostfix("");
             plotObj.setOutputFolder(outFolder);
+            plotObj.setPlotProcesses(plotProcesses_);
 
             for (unsigned i{0}; i < plotsVec.size(); i++) {
                 std::cout << plotsVec[i] << std::endl;
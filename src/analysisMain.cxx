@@ -1,4 +1,5 @@
 #include "TTree.h"
+#include "allocationCounterHooks.hpp"
 #include "analysisAlgo.hpp"
 
 #include <iomanip>
@@ -0,0 +1,554 @@
+#include "binnedFormula.hpp"
+
+#include "conditions.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    // Binning variables a table may have
+    constexpr size_t MAX_BIN_VARIABLES{4};
+
+    std::string trim(const std::string& str) {
+        const size_t first{str.find_first_not_of(" \t\r\"")};
+        if (first == std::string::npos) {
+            return {};
+        }
+        const size_t last{str.find_last_not_of(" \t\r\"")};
+        return str.substr(first, last - first + 1);
+    }
+
+    // Recursive descent over + - * / unary minus, brackets, numbers, x, [i]
+    // and a few functions, emitting postfix code through the callbacks
+    template <typename Op>
+    class FormulaParser
+    {
+        public:
+        FormulaParser(const std::string& formula, Op& emit) : formula_{formula}, pos_{0}, emit_{emit} {}
+
+        void parse() {
+            expression();
+            if (pos_ != formula_.size()) {
+                fail("unexpected '" + std::string{formula_[pos_]} + "'");
+            }
+        }
+
+        private:
+        char peek() {
+            while (pos_ < formula_.size() && std::isspace(static_cast<unsigned char>(formula_[pos_]))) {
+                pos_++;
+            }
+            return pos_ < formula_.size() ? formula_[pos_] : '\0';
+        }
+        void expect(const char c) {
+            if (peek() != c) {
+                fail(std::string{"expected '"} + c + "'");
+            }
+            pos_++;
+        }
+        [[noreturn]] void fail(const std::string& what) const {
+            throw std::logic_error("Formula \"" + formula_ + "\": " + what + " at " + std::to_string(pos_));
+        }
+
+        void expression() {
+            term();
+            for (char c{peek()}; c == '+' || c == '-'; c = peek()) {
+                pos_++;
+                term();
+                emit_.binary(c);
+            }
+        }
+        void term() {
+            unary();
+            for (char c{peek()}; c == '*' || c == '/'; c = peek()) {
+                pos_++;
+                unary();
+                emit_.binary(c);
+            }
+        }
+        void unary() {
+            const char c{peek()};
+            if (c == '-') {
+                pos_++;
+                unary();
+                emit_.binary('~');
+            }
+            else if (c == '+') {
+                pos_++;
+                unary();
+            }
+            else {
+                primary();
+            }
+        }
+        void primary() {
+            const char c{peek()};
+            if (c == '(') {
+                pos_++;
+                expression();
+                expect(')');
+            }
+            else if (c == '[') {
+                pos_++;
+                const size_t start{pos_};
+                while (pos_ < formula_.size() && std::isdigit(static_cast<unsigned char>(formula_[pos_]))) {
+                    pos_++;
+                }
+                if (pos_ == start) {
+                    fail("expected a parameter index");
+                }
+                emit_.parameter(std::stoul(formula_.substr(start, pos_ - start)));
+                expect(']');
+            }
+            else if (std::isdigit(static_cast<unsigned char>(c)) || c == '.') {
+                size_t length{0};
+                const double value{std::stod(formula_.substr(pos_), &length)};
+                pos_ += length;
+                emit_.constant(value);
+            }
+            else if (std::isalpha(static_cast<unsigned char>(c))) {
+                const size_t start{pos_};
+                while (pos_ < formula_.size() && (std::isalnum(static_cast<unsigned char>(formula_[pos_])) || formula_[pos_] == ':')) {
+                    pos_++;
+                }
+                std::string name{formula_.substr(start, pos_ - start)};
+                if (name.rfind("TMath::", 0) == 0) {
+                    name = name.substr(7);
+                }
+                if (name == "x") {
+                    emit_.x();
+                    return;
+                }
+                expect('(');
+                expression();
+                size_t numArgs{1};
+                while (peek() == ',') {
+                    pos_++;
+                    expression();
+                    numArgs++;
+                }
+                expect(')');
+                if (!emit_.function(name, numArgs)) {
+                    fail("unknown function " + name + " of " + std::to_string(numArgs) + " arguments");
+                }
+            }
+            else {
+                fail("unexpected '" + std::string{c} + "'");
+            }
+        }
+
+        const std::string& formula_;
+        size_t pos_;
+        Op& emit_;
+    };
+} // namespace
+
+BinnedFormula::BinnedFormula()
+    : program_{}
+    , numParameters_{0}
+    , edges_{}
+    , absolute_{}
+    , strides_{}
+    , parameters_{}
+    , xMin_{}
+    , xMax_{}
+{}
+
+std::vector<BinnedFormula::op> BinnedFormula::compile(const std::string& formula, const bool extractConstants, std::vector<double>& constants) {
+    struct emitter
+    {
+        std::vector<op> program;
+        bool extractConstants;
+        std::vector<double>& constants;
+
+        void x() {
+            program.push_back({Code::x, 0, 0.});
+        }
+        void constant(const double value) {
+            if (extractConstants) {
+                program.push_back({Code::parameter, constants.size(), 0.});
+                constants.emplace_back(value);
+            }
+            else {
+                program.push_back({Code::constant, 0, value});
+            }
+        }
+        void parameter(const size_t index) {
+            program.push_back({Code::parameter, index, 0.});
+        }
+        void binary(const char c) {
+            switch (c) {
+                case '+': program.push_back({Code::add, 0, 0.}); break;
+                case '-': program.push_back({Code::subtract, 0, 0.}); break;
+                case '*': program.push_back({Code::multiply, 0, 0.}); break;
+                case '/': program.push_back({Code::divide, 0, 0.}); break;
+                default: program.push_back({Code::negate, 0, 0.}); break;
+            }
+        }
+        bool function(const std::string& name, const size_t numArgs) {
+            if (numArgs == 1) {
+                if (name == "log") program.push_back({Code::log, 0, 0.});
+                else if (name == "exp") program.push_back({Code::exp, 0, 0.});
+                else if (name == "sqrt") program.push_back({Code::sqrt, 0, 0.});
+                else if (name == "abs" || name == "fabs" || name == "Abs") program.push_back({Code::abs, 0, 0.});
+                else return false;
+                return true;
+            }
+            if (numArgs == 2) {
+                if (name == "pow" || name == "Power") program.push_back({Code::pow, 0, 0.});
+                else if (name == "min" || name == "Min") program.push_back({Code::min, 0, 0.});
+                else if (name == "max" || name == "Max") program.push_back({Code::max, 0, 0.});
+                else return false;
+                return true;
+            }
+            return false;
+        }
+    };
+
+    emitter emit{{}, extractConstants, constants};
+    FormulaParser<emitter>{formula, emit}.parse();
+
+    // Check the stack depth once here rather than on every evaluation
+    size_t depth{0};
+    for (const op& o : emit.program) {
+        depth += static_cast<size_t>(stackChange(o.code));
+        if (depth > MAX_STACK) {
+            throw std::logic_error("Formula \"" + formula + "\" is too deeply nested");
+        }
+    }
+    return emit.program;
+}
+
+int BinnedFormula::stackChange(const Code code) {
+    switch (code) {
+        case Code::x:
+        case Code::constant:
+        case Code::parameter:
+            return 1;
+        case Code::negate:
+        case Code::log:
+        case Code::exp:
+        case Code::sqrt:
+        case Code::abs:
+            return 0;
+        case Code::add:
+        case Code::subtract:
+        case Code::multiply:
+        case Code::divide:
+        case Code::pow:
+        case Code::min:
+        case Code::max:
+            return -1;
+        default:
+            throw std::logic_error("Unknown formula operation");
+    }
+}
+
+bool BinnedFormula::sameForm(const std::vector<op>& a, const std::vector<op>& b) {
+    return std::equal(a.begin(), a.end(), b.begin(), b.end(), [](const op& l, const op& r) {
+        return l.code == r.code && l.index == r.index;
+    });
+}
+
+BinnedFormula BinnedFormula::fromJRDatabase(const std::string& fileName) {
+    const std::unique_ptr<std::istream> file{Conditions::open(fileName)};
+    if (!*file) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+
+    std::string line;
+    std::getline(*file, line);
+    const size_t open{line.find('{')};
+    const size_t close{line.rfind('}')};
+    if (open == std::string::npos || close == std::string::npos) {
+        throw std::logic_error(fileName + " has no JRDatabase header");
+    }
+    std::istringstream header{line.substr(open + 1, close - open - 1)};
+    size_t numBinVars{0};
+    header >> numBinVars;
+    std::string name;
+    for (size_t v{0}; v < numBinVars; v++) {
+        header >> name;
+    }
+    size_t numFormulaVars{0};
+    header >> numFormulaVars;
+    if (numFormulaVars > 1) {
+        throw std::logic_error(fileName + " has more than one formula variable");
+    }
+    for (size_t v{0}; v < numFormulaVars; v++) {
+        header >> name;
+    }
+    std::string formula;
+    header >> formula;
+
+    BinnedFormula table;
+    std::vector<double> unused;
+    if (formula != "None") {
+        table.program_ = compile(formula, false, unused);
+    }
+
+    std::vector<record> records;
+    while (std::getline(*file, line)) {
+        std::istringstream values{line};
+        record rec{std::vector<double>(numBinVars), std::vector<double>(numBinVars), 0., 0., {}};
+        for (size_t v{0}; v < numBinVars; v++) {
+            values >> rec.binMin[v] >> rec.binMax[v];
+        }
+        size_t numValues{0};
+        if (!(values >> numValues)) {
+            continue;
+        }
+        if (numFormulaVars == 1) {
+            values >> rec.xMin >> rec.xMax;
+            numValues -= 2;
+        }
+        rec.parameters.resize(numValues);
+        for (double& parameter : rec.parameters) {
+            values >> parameter;
+        }
+        if (!values) {
+            throw std::logic_error(fileName + ": bad record \"" + line + "\"");
+        }
+        records.emplace_back(std::move(rec));
+    }
+
+    table.build(records, fileName);
+    return table;
+}
+
+BinnedFormula BinnedFormula::fromBTagCSV(const std::string& fileName, const int operatingPoint, const std::string& measurement, const std::string& sysType, const int flavour) {
+    const std::unique_ptr<std::istream> file{Conditions::open(fileName)};
+    if (!*file) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+
+    constexpr size_t NFIELDS{10};
+    BinnedFormula table;
+    std::vector<record> records;
+    std::string line;
+    while (std::getline(*file, line)) {
+        // The header names the tagger and the columns
+        if (line.find(';') != std::string::npos || trim(line).empty()) {
+            continue;
+        }
+        std::vector<std::string> fields;
+        size_t start{0};
+        for (size_t f{0}; f < NFIELDS; f++) {
+            const size_t comma{line.find(',', start)};
+            if (comma == std::string::npos) {
+                throw std::logic_error(fileName + ": bad record \"" + line + "\"");
+            }
+            fields.emplace_back(trim(line.substr(start, comma - start)));
+            start = comma + 1;
+        }
+        if (std::stoi(fields[0]) != operatingPoint || fields[1] != measurement || fields[2] != sysType || std::stoi(fields[3]) != flavour) {
+            continue;
+        }
+
+        record rec{{std::stod(fields[4]), std::stod(fields[6])}, {std::stod(fields[5]), std::stod(fields[7])}, std::stod(fields[6]), std::stod(fields[7]), {}};
+        const std::vector<op> program{compile(trim(line.substr(start)), true, rec.parameters)};
+        if (records.empty()) {
+            table.program_ = program;
+        }
+        else if (!sameForm(program, table.program_)) {
+            throw std::logic_error(fileName + ": " + measurement + " " + sysType + " formulas for flavour " + std::to_string(flavour) + " differ in form");
+        }
+        records.emplace_back(std::move(rec));
+    }
+
+    table.build(records, fileName + " (" + measurement + " " + sysType + " flavour " + std::to_string(flavour) + ")");
+    return table;
+}
+
+void BinnedFormula::build(const std::vector<record>& records, const std::string& source) {
+    if (records.empty()) {
+        throw std::logic_error(source + " has no records");
+    }
+    const size_t numVars{records.front().binMin.size()};
+    if (numVars > MAX_BIN_VARIABLES) {
+        throw std::logic_error(source + " has too many binning variables");
+    }
+    numParameters_ = records.front().parameters.size();
+
+    edges_.assign(numVars, {});
+    for (const record& rec : records) {
+        if (rec.parameters.size() != numParameters_) {
+            throw std::logic_error(source + " has records with different numbers of parameters");
+        }
+        for (size_t v{0}; v < numVars; v++) {
+            edges_[v].emplace_back(rec.binMin[v]);
+            edges_[v].emplace_back(rec.binMax[v]);
+        }
+    }
+    size_t numBins{1};
+    strides_.assign(numVars, 0);
+    absolute_.assign(numVars, false);
+    for (size_t v{numVars}; v-- > 0;) {
+        std::sort(edges_[v].begin(), edges_[v].end());
+        edges_[v].erase(std::unique(edges_[v].begin(), edges_[v].end()), edges_[v].end());
+        absolute_[v] = std::fpclassify(edges_[v].front()) == FP_ZERO;
+        strides_[v] = numBins;
+        numBins *= edges_[v].size() - 1;
+    }
+
+    // The records must tile the grid of edges, once each
+    parameters_.assign(numBins * numParameters_, 0.);
+    xMin_.assign(numBins, 0.);
+    xMax_.assign(numBins, 0.);
+    std::vector<bool> filled(numBins, false);
+    for (const record& rec : records) {
+        size_t bin{0};
+        for (size_t v{0}; v < numVars; v++) {
+            // Both ends are among the edges, so a record on the grid
+            // spans exactly one step between them
+            const auto low{std::lower_bound(edges_[v].begin(), edges_[v].end(), rec.binMin[v])};
+            const auto high{std::lower_bound(edges_[v].begin(), edges_[v].end(), rec.binMax[v])};
+            if (high - low != 1) {
+                throw std::logic_error(source + " is not binned on a grid");
+            }
+            bin += static_cast<size_t>(low - edges_[v].begin()) * strides_[v];
+        }
+        if (filled[bin]) {
+            throw std::logic_error(source + " has overlapping records");
+        }
+        filled[bin] = true;
+        std::copy(rec.parameters.begin(), rec.parameters.end(), parameters_.begin() + static_cast<std::ptrdiff_t>(bin * numParameters_));
+        xMin_[bin] = rec.xMin;
+        xMax_[bin] = rec.xMax;
+    }
+    if (std::find(filled.begin(), filled.end(), false) != filled.end()) {
+        throw std::logic_error(source + " has gaps between its records");
+    }
+}
+
+size_t BinnedFormula::bin(const double* vars) const {
+    size_t bin{0};
+    for (size_t v{0}; v < edges_.size(); v++) {
+        const double value{absolute_[v] ? std::abs(vars[v]) : vars[v]};
+        // Counting only the inner edges clamps to the outer bins
+        const std::vector<double>& edges{edges_[v]};
+        size_t cell{0};
+        for (size_t k{1}; k + 1 < edges.size(); k++) {
+            cell += value >= edges[k];
+        }
+        bin += cell * strides_[v];
+    }
+    return bin;
+}
+
+double BinnedFormula::evaluate(const double* vars, const double x) const {
+    const size_t bins{bin(vars)};
+    double result;
+    evaluateChunk(&bins, &x, 1, &result);
+    return result;
+}
+
+void BinnedFormula::evaluate(const double* const* vars, const double* x, const size_t n, double* result) const {
+    size_t bins[CHUNK];
+    double point[MAX_BIN_VARIABLES];
+    for (size_t start{0}; start < n; start += CHUNK) {
+        const size_t size{std::min(CHUNK, n - start)};
+        for (size_t i{0}; i < size; i++) {
+            for (size_t v{0}; v < edges_.size(); v++) {
+                point[v] = vars[v][start + i];
+            }
+            bins[i] = bin(point);
+        }
+        evaluateChunk(bins, x + start, size, result + start);
+    }
+}
+
+void BinnedFormula::evaluateChunk(const size_t* bins, const double* x, const size_t n, double* result) const {
+    if (program_.empty()) {
+        throw std::logic_error("Table has no formula to evaluate");
+    }
+
+    // One pass over the program for the whole chunk, so the inner loops are
+    // over the points and vectorise
+    double stack[MAX_STACK][CHUNK];
+    double xs[CHUNK];
+    for (size_t i{0}; i < n; i++) {
+        xs[i] = std::min(std::max(x[i], xMin_[bins[i]]), xMax_[bins[i]]);
+    }
+
+    size_t top{0};
+    for (const op& o : program_) {
+        double* a{top > 0 ? stack[top - 1] : nullptr};
+        const double* b{nullptr};
+        if (stackChange(o.code) < 0) {
+            // Binary: the top of the stack is the right hand side
+            b = stack[--top];
+            a = stack[top - 1];
+        }
+        switch (o.code) {
+            case Code::x:
+                std::copy(xs, xs + n, stack[top++]);
+                break;
+            case Code::constant:
+                std::fill(stack[top], stack[top] + n, o.value);
+                top++;
+                break;
+            case Code::parameter:
+                for (size_t i{0}; i < n; i++) {
+                    stack[top][i] = parameters_[bins[i] * numParameters_ + o.index];
+                }
+                top++;
+                break;
+            case Code::negate:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = -a[i];
+                break;
+            case Code::log:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::log(a[i]);
+                break;
+            case Code::exp:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::exp(a[i]);
+                break;
+            case Code::sqrt:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::sqrt(a[i]);
+                break;
+            case Code::abs:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::abs(a[i]);
+                break;
+            case Code::add:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] += b[i];
+                break;
+            case Code::subtract:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] -= b[i];
+                break;
+            case Code::multiply:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] *= b[i];
+                break;
+            case Code::divide:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] /= b[i];
+                break;
+            case Code::pow:
+                for (size_t i{0}; i < n; i++) a[i] = std::pow(a[i], b[i]);
+                break;
+            case Code::min:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::min(a[i], b[i]);
+                break;
+            case Code::max:
+#pragma omp simd
+                for (size_t i = 0; i < n; i++) a[i] = std::max(a[i], b[i]);
+                break;
+            default:
+                throw std::logic_error("Unknown formula operation");
+        }
+    }
+    std::copy(stack[0], stack[0] + n, result);
+}
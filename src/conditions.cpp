@@ -0,0 +1,194 @@
+#include "conditions.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    // Magic, then the era, then records of a kind, a name and the contents
+    constexpr char MAGIC[8]{'H', 'T', 'S', 'S', 'C', 'N', 'D', '1'};
+    enum class Kind : uint8_t { table, file };
+
+    struct region
+    {
+        const char* data;
+        size_t size;
+    };
+
+    // Reads the records of a mapped snapshot, throwing if it runs short
+    class SnapshotReader
+    {
+        public:
+        SnapshotReader(const char* data, const size_t size, const std::string& fileName) : pos_{data}, end_{data + size}, fileName_{fileName} {}
+
+        bool done() const {
+            return pos_ == end_;
+        }
+        region bytes(const size_t size) {
+            if (static_cast<size_t>(end_ - pos_) < size) {
+                throw std::runtime_error("Conditions snapshot " + fileName_ + " is truncated");
+            }
+            const region r{pos_, size};
+            pos_ += size;
+            return r;
+        }
+        template <typename T>
+        T value() {
+            T v;
+            std::memcpy(&v, bytes(sizeof(T)).data, sizeof(T));
+            return v;
+        }
+        std::string string() {
+            const region r{bytes(value<uint64_t>())};
+            return {r.data, r.size};
+        }
+
+        private:
+        const char* pos_;
+        const char* end_;
+        const std::string& fileName_;
+    };
+
+    // An istream over mapped memory, which it doesn't copy
+    class MemoryBuffer : public std::streambuf
+    {
+        public:
+        explicit MemoryBuffer(const region r) {
+            char* begin{const_cast<char*>(r.data)};
+            setg(begin, begin, begin + r.size);
+        }
+    };
+
+    class MemoryStream : public std::istream
+    {
+        public:
+        explicit MemoryStream(const region r) : std::istream{nullptr}, buffer_{r} {
+            rdbuf(&buffer_);
+        }
+
+        private:
+        MemoryBuffer buffer_;
+    };
+
+    std::mutex conditionsMutex;
+    // The mapping is kept for the life of the process
+    std::map<std::string, region> snapshotTables;
+    std::map<std::string, region> snapshotFiles;
+    // std::map, so references to the tables stay valid as more are added
+    std::map<std::string, ScaleFactorTable> tables;
+    std::set<std::string> filesOpened;
+
+    void writeString(std::ostream& out, const std::string& str) {
+        const uint64_t size{str.size()};
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(str.data(), static_cast<std::streamsize>(size));
+    }
+} // namespace
+
+void Conditions::useSnapshot(const std::string& fileName, const std::string& era) {
+    const std::lock_guard<std::mutex> lock{conditionsMutex};
+    if (!snapshotTables.empty() || !snapshotFiles.empty()) {
+        throw std::logic_error("A conditions snapshot is already in use");
+    }
+
+    const int fd{::open(fileName.c_str(), O_RDONLY)};
+    if (fd < 0) {
+        throw std::runtime_error("Unable to open conditions snapshot " + fileName);
+    }
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size == 0) {
+        ::close(fd);
+        throw std::runtime_error("Unable to read conditions snapshot " + fileName);
+    }
+    const size_t size{static_cast<size_t>(info.st_size)};
+    void* mapping{::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0)};
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+        throw std::runtime_error("Unable to map conditions snapshot " + fileName);
+    }
+
+    SnapshotReader reader{static_cast<const char*>(mapping), size, fileName};
+    if (std::memcmp(reader.bytes(sizeof(MAGIC)).data, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error(fileName + " is not a conditions snapshot");
+    }
+    const std::string snapshotEra{reader.string()};
+    if (snapshotEra != era) {
+        throw std::runtime_error("Conditions snapshot " + fileName + " is for " + snapshotEra + ", not " + era);
+    }
+    while (!reader.done()) {
+        const Kind kind{reader.value<Kind>()};
+        const std::string name{reader.string()};
+        const region contents{reader.bytes(reader.value<uint64_t>())};
+        (kind == Kind::table ? snapshotTables : snapshotFiles)[name] = contents;
+    }
+    std::cout << "Using conditions snapshot " << fileName << " with " << snapshotTables.size() << " tables and " << snapshotFiles.size() << " files" << std::endl;
+}
+
+const ScaleFactorTable& Conditions::table(const std::string& name, const std::function<ScaleFactorTable()>& build) {
+    const std::lock_guard<std::mutex> lock{conditionsMutex};
+    const auto found{tables.find(name)};
+    if (found != tables.end()) {
+        return found->second;
+    }
+    const auto mapped{snapshotTables.find(name)};
+    if (mapped != snapshotTables.end()) {
+        return tables.emplace(name, ScaleFactorTable::read(mapped->second.data, mapped->second.size)).first->second;
+    }
+    return tables.emplace(name, build()).first->second;
+}
+
+std::unique_ptr<std::istream> Conditions::open(const std::string& fileName) {
+    const std::lock_guard<std::mutex> lock{conditionsMutex};
+    const auto mapped{snapshotFiles.find(fileName)};
+    if (mapped != snapshotFiles.end()) {
+        return std::unique_ptr<std::istream>{new MemoryStream{mapped->second}};
+    }
+    filesOpened.insert(fileName);
+    return std::unique_ptr<std::istream>{new std::ifstream{fileName}};
+}
+
+void Conditions::writeSnapshot(const std::string& fileName, const std::string& era) {
+    const std::lock_guard<std::mutex> lock{conditionsMutex};
+    std::ofstream out{fileName, std::ios::binary};
+    if (!out.is_open()) {
+        throw std::runtime_error("Unable to open " + fileName);
+    }
+    out.write(MAGIC, sizeof(MAGIC));
+    writeString(out, era);
+
+    for (const auto& table : tables) {
+        std::ostringstream contents;
+        table.second.write(contents);
+        out.put(static_cast<char>(Kind::table));
+        writeString(out, table.first);
+        writeString(out, contents.str());
+    }
+    for (const std::string& name : filesOpened) {
+        std::ifstream file{name, std::ios::binary};
+        if (!file.is_open()) {
+            throw std::runtime_error("Unable to open " + name);
+        }
+        std::ostringstream contents;
+        contents << file.rdbuf();
+        out.put(static_cast<char>(Kind::file));
+        writeString(out, name);
+        writeString(out, contents.str());
+    }
+
+    if (!out) {
+        throw std::runtime_error("Unable to write " + fileName);
+    }
+    std::cout << "Wrote " << tables.size() << " tables and " << filesOpened.size() << " files to " << fileName << std::endl;
+}
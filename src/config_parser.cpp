@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -93,6 +94,35 @@ void Parser::parse_config(const std::string conf,
     }
 }
 
+// Optional block of the main config, e.g.
+// readCache:
+//   sizeMB: 100
+//   learnEntries: 100
+//   branches: ["muon*", "packedCands*"]
+//   asyncPrefetch: true
+void Parser::parse_read_cache(const std::string conf, readCacheSettings& cache) {
+    const YAML::Node root{YAML::LoadFile(conf)};
+    const YAML::Node cacheConf{root["readCache"]};
+    if (!cacheConf) return;
+
+    if (cacheConf["sizeMB"]) {
+        const long long sizeMB{cacheConf["sizeMB"].as<long long>()};
+        if (sizeMB < 0) {
+            throw std::logic_error("readCache sizeMB cannot be negative.");
+        }
+        cache.size = sizeMB * 1024 * 1024;
+    }
+    if (cacheConf["learnEntries"]) cache.learnEntries = cacheConf["learnEntries"].as<int>();
+    if (cacheConf["branches"]) cache.branches = cacheConf["branches"].as<std::vector<std::string>>();
+    if (cacheConf["asyncPrefetch"]) cache.asyncPrefetch = cacheConf["asyncPrefetch"].as<bool>();
+}
+
+// Optional path to the systematic variations config
+void Parser::parse_systematics(const std::string conf, std::string& systematicsConf) {
+    const YAML::Node root{YAML::LoadFile(conf)};
+    if (root["systematics"]) systematicsConf = root["systematics"].as<std::string>();
+}
+
 // For reading the file config.
 void Parser::parse_files(const std::vector<std::string> files,
                          std::vector<Dataset>& datasets,
@@ -1,11 +1,13 @@
+#include "TFile.h"
 #include "TGraphAsymmErrors.h"
 #include "TH1F.h"
 #include "TH2D.h"
 #include "TH2F.h"
 #include "TH3D.h"
-#include "TLorentzVector.h"
 #include "TRandom.h"
 #include "cutClass.hpp"
+#include "conditions.hpp"
+#include "philox.hpp"
 
 #include <boost/functional/hash.hpp>
 #include <cmath>
@@ -15,8 +17,35 @@
 #include <limits>
 #include <random>
 #include <sstream>
+#include <tuple>
 #include <yaml-cpp/yaml.h>
 
+static_assert(JetCorrectionCache::MAXJETS == AnalysisEvent::NJETSMAX, "JetCorrectionCache must hold every jet");
+
+namespace
+{
+    // A scale factor table from a 2D histogram, its up and down uncertainties
+    // the quadrature sum of the errors of the histograms whose names are the
+    // nominal one plus the suffixes
+    ScaleFactorTable histogramTable(const std::string& fileName, const std::string& name, const std::vector<std::string>& uncertaintySuffixes) {
+        TFile file{fileName.c_str()};
+        const auto get{[&file, &fileName](const std::string& histName) {
+            const TH2F* hist{dynamic_cast<TH2F*>(file.Get(histName.c_str()))};
+            if (!hist) {
+                throw std::runtime_error("Unable to read " + histName + " from " + fileName);
+            }
+            return hist;
+        }};
+        std::vector<const TH1*> uncertainties;
+        for (const std::string& suffix : uncertaintySuffixes) {
+            uncertainties.emplace_back(get(name + suffix));
+        }
+        ScaleFactorTable table{*get(name), uncertainties};
+        file.Close();
+        return table;
+    }
+} // namespace
+
 Cuts::Cuts(const bool doPlots,
            const bool fillCutFlows,
            const bool invertLepCut,
@@ -84,6 +113,8 @@ Cuts::Cuts(const bool doPlots,
 
     , rc_{is2016 ? "scaleFactors/2016/RoccoR2016.txt"
                  : "scaleFactors/2017/RoccoR2017.txt"}
+    , jecUncertainties_{}
+    , jecLookups_{0}
 
     , isMC_{true}
 
@@ -91,6 +122,7 @@ Cuts::Cuts(const bool doPlots,
     , isZplusCR_{false}
 
     , postLepSelTree_{nullptr}
+    , passesHadronMassCuts_{false}
 
     // Skips running trigger stuff
     , skipTrigger_{false}
@@ -104,11 +136,25 @@ Cuts::Cuts(const bool doPlots,
     // MET and mTW cuts go here.
     , metDileptonCut_{50.0}
 
+    , stageVariations_{}
+    , stagePlots_{}
+    , stageWeights_{}
+
 {
+    // Room for every systematic, so that filling the stages never allocates
+    constexpr size_t maxVariations{32};
+    stageVariations_.reserve(maxVariations);
+    stagePlots_.reserve(maxVariations);
+    stageWeights_.reserve(maxVariations);
+
     std::cout << "\nInitialises fine" << std::endl;
     initialiseJECCors();
+    initialiseJetSFs();
     std::cout << "Gets past JEC Cors" << std::endl;
 
+    // Muon ID and iso files, less their _ID.root and _ISO.root
+    std::string muonSFFiles;
+
     if (is2016_) { // 2016 G-H
 /*
         std::cout << "\nLoad 2016 (G-H) electron SFs from root file ... " << std::endl;
@@ -132,35 +178,8 @@ Cuts::Cuts(const bool doPlots,
 
         std::cout << "Got 2016 (G-H) electron SFs!\n" << std::endl;
 */
-        std::cout << "Load 2016 (G-H) muon SFs from root file ... " << std::endl;
-
-        muonHltFile = new TFile{"scaleFactors/2016/HLT_Mu24_EfficienciesAndSF_RunGtoH.root"};
-        muonIdFile  = new TFile{"scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL_ID.root"};
-        muonIsoFile = new TFile{"scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL_ISO.root"};
-
-        // Single Muon HLT SF
-        muonHltFile->cd("IsoMu24_OR_IsoTkMu24_PtEtaBins");
-        h_muonHlt = dynamic_cast<TH2F*>(muonHltFile->Get("IsoMu24_OR_IsoTkMu24_PtEtaBins/abseta_pt_ratio"));
-
-        // Loose ID
-        h_muonId     = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt"));
-        h_muonIdSyst = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_syst"));
-        h_muonIdStat = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_stat"));
-
-        // Loose Iso
-        h_muonIso     = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt"));
-        h_muonIsoSyst = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_syst"));
-        h_muonIsoStat = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_stat"));
-
-        maxMuonIdPt_  = {h_muonId->GetXaxis()->GetXmax() - 0.1};
-        maxMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmax() - 0.1};
-        maxMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmax() - 0.1};
-
-        minMuonIdPt_  = {h_muonId->GetXaxis()->GetXmin() + 0.1};
-        minMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmin() + 0.1};
-        minMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmin() +  0.1};
-
-        std::cout << "Got 2016 (G-H) muon SFs!\n" << std::endl;
+        std::cout << "Load 2016 (G-H) muon SFs ... " << std::endl;
+        muonSFFiles = "scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL";
     }
 
     else if (is2016APV_) { // 2016 B-F
@@ -186,35 +205,8 @@ Cuts::Cuts(const bool doPlots,
 
         std::cout << "Got 2016 (B-F) electron SFs!\n" << std::endl;
 */
-        std::cout << "Load 2016 (B-F) muon SFs from root file ... " << std::endl;
-
-//        muonHltFile = new TFile{"scaleFactors/2016/HLT_Mu24_EfficienciesAndSF_RunBtoF.root"};
-        muonIdFile  = new TFile{"scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL_HIPM_ID.root"};
-        muonIsoFile = new TFile{"scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL_HIPM_ISO.root"};
-
-        // Single Muon HLT SF
-//        muonHltFile->cd("IsoMu24_OR_IsoTkMu24_PtEtaBins");
-//        h_muonHlt = dynamic_cast<TH2F*>(muonHltFile->Get("IsoMu24_OR_IsoTkMu24_PtEtaBins/abseta_pt_ratio"));
-
-        // Loose ID
-        h_muonId     = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt"));
-        h_muonIdSyst = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_syst"));
-        h_muonIdStat = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_stat"));
-
-        // Loose Iso
-        h_muonIso     = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt"));
-        h_muonIsoSyst = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_syst"));
-        h_muonIsoStat = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_stat"));
-
-        maxMuonIdPt_  = {h_muonId->GetXaxis()->GetXmax() - 0.1};
-        maxMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmax() - 0.1};
-//        maxMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmax() - 0.1};
-
-        minMuonIdPt_  = {h_muonId->GetXaxis()->GetXmin() + 0.1};
-        minMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmin() + 0.1};
-//        minMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmin() +  0.1};
-
-        std::cout << "Got 2016 (B-F) muon SFs!\n" << std::endl;
+        std::cout << "Load 2016 (B-F) muon SFs ... " << std::endl;
+        muonSFFiles = "scaleFactors/2016/Efficiencies_muon_generalTracks_Z_Run2016_UL_HIPM";
     }
 
     else if (!is2016_ && !is2016APV_ && !is2018_) { // 2017
@@ -241,35 +233,8 @@ Cuts::Cuts(const bool doPlots,
         std::cout << "Got 2017 electron SFs!\n" << std::endl;
 */
 
-        std::cout << "Load 2017 muon SFs from root file ... " << std::endl;
-
-//        muonHltFile = new TFile{"scaleFactors/2017/EfficienciesAndSF_RunBtoF_Nov17Nov2017.root"};
-        muonIdFile  = new TFile{"scaleFactors/2017/Efficiencies_muon_generalTracks_Z_Run2017_UL_ID.root"};
-        muonIsoFile = new TFile{"scaleFactors/2017/Efficiencies_muon_generalTracks_Z_Run2017_UL_ISO.root"};
-
-        // Single Muon HLT SF
-//        muonHltFile->cd("IsoMu27_PtEtaBins");
-//        h_muonHlt = dynamic_cast<TH2F*>(muonHltFile->Get("IsoMu27_PtEtaBins/abseta_pt_ratio"));
-
-        // Loose ID
-        h_muonId     = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt"));
-        h_muonIdSyst = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_syst"));
-        h_muonIdStat = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_stat"));
-
-        // Loose Iso
-        h_muonIso     = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt"));
-        h_muonIsoSyst = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_syst"));
-        h_muonIsoStat = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_stat"));
-
-        maxMuonIdPt_  = h_muonId->GetXaxis()->GetXmax() - 0.1;
-        maxMuonIsoPt_ = h_muonIso->GetXaxis()->GetXmax() - 0.1;
-//	    maxMuonHltPt_ = h_muonHlt->GetYaxis()->GetXmax() - 0.1;
-
-        minMuonIdPt_  = h_muonId->GetXaxis()->GetXmin() + 0.1;
-        minMuonIsoPt_ = h_muonIso->GetXaxis()->GetXmin() + 0.1;
-//        minMuonHltPt_ = h_muonHlt->GetYaxis()->GetXmin() +  0.1;
-
-        std::cout << "Got 2017 muon SFs!\n" << std::endl;
+        std::cout << "Load 2017 muon SFs ... " << std::endl;
+        muonSFFiles = "scaleFactors/2017/Efficiencies_muon_generalTracks_Z_Run2017_UL";
     }
     else { // 2018
 /*
@@ -295,44 +260,34 @@ Cuts::Cuts(const bool doPlots,
         std::cout << "Got 2017 electron SFs!\n" << std::endl;
 */
 
-        std::cout << "Load 2018 muon SFs from root file ... " << std::endl;
-//        muonHltFile = new TFile{"scaleFactors/2017/EfficienciesAndSF_RunBtoF_Nov17Nov2017.root"};
-        muonIdFile  = new TFile{"scaleFactors/2018/Efficiencies_muon_generalTracks_Z_Run2018_UL_ID.root"};
-        muonIsoFile = new TFile{"scaleFactors/2018/Efficiencies_muon_generalTracks_Z_Run2018_UL_ISO.root"};
-
-        // Single Muon HLT SF
-//        muonHltFile->cd("IsoMu27_PtEtaBins");
-//        h_muonHlt = dynamic_cast<TH2F*>(muonHltFile->Get("IsoMu27_PtEtaBins/abseta_pt_ratio"));
-
-        // Loose ID
-        h_muonId     = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt"));
-        h_muonIdSyst = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_syst"));
-        h_muonIdStat = dynamic_cast<TH2F*>(muonIdFile->Get("NUM_LooseID_DEN_TrackerMuons_abseta_pt_stat"));
-
-        // Loose Iso
-        h_muonIso     = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt"));
-        h_muonIsoSyst = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_syst"));
-        h_muonIsoStat = dynamic_cast<TH2F*>(muonIsoFile->Get("NUM_LooseRelIso_DEN_LooseID_abseta_pt_stat"));
-
-        maxMuonIdPt_  = {h_muonId->GetXaxis()->GetXmax() - 0.1};
-        maxMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmax() - 0.1};
-//        maxMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmax() - 0.1};
-
-        minMuonIdPt_  = {h_muonId->GetXaxis()->GetXmin() + 0.1};
-        minMuonIsoPt_ = {h_muonIso->GetXaxis()->GetXmin() + 0.1};
-//        minMuonHltPt_ = {h_muonHlt->GetYaxis()->GetXmin() +  0.1};
-
-        std::cout << "Got 2018 muon SFs!\n" << std::endl;
-    }
+        std::cout << "Load 2018 muon SFs ... " << std::endl;
+        muonSFFiles = "scaleFactors/2018/Efficiencies_muon_generalTracks_Z_Run2018_UL";
+    }
+
+    // The uncertainties are the stat and syst errors in quadrature
+    const std::string era{Conditions::era(is2016_, is2016APV_, is2018_)};
+    muonIdSFs_ = Conditions::table(era + "/muonIdSFs", [&muonSFFiles]() {
+        return histogramTable(muonSFFiles + "_ID.root", "NUM_LooseID_DEN_TrackerMuons_abseta_pt", {"_stat", "_syst"});
+    });
+    muonIsoSFs_ = Conditions::table(era + "/muonIsoSFs", [&muonSFFiles]() {
+        return histogramTable(muonSFFiles + "_ISO.root", "NUM_LooseRelIso_DEN_LooseID_abseta_pt", {"", "_syst"});
+    });
+    maxMuonIdPt_ = muonIdSFs_.xMax() - 0.1;
+    maxMuonIsoPt_ = muonIsoSFs_.xMax() - 0.1;
+    minMuonIdPt_ = muonIdSFs_.xMin() + 0.1;
+    minMuonIsoPt_ = muonIsoSFs_.xMin() + 0.1;
 }
 
 Cuts::~Cuts()
 {
 //    electronSFsFile->Close();
 //    electronRecoFile->Close();
-    muonHltFile->Close();
-    muonIdFile->Close();
-    muonIsoFile->Close();
+}
+
+std::unique_ptr<Cuts> Cuts::clone() const {
+    std::unique_ptr<Cuts> copy{new Cuts{*this}};
+    copy->jecLookups_ = 0;
+    return copy;
 }
 
 void Cuts::parse_config(const std::string confName)
@@ -395,78 +350,95 @@ void Cuts::parse_config(const std::string confName)
               << numTightEle_ << " electrons" << std::endl;
 }
 
-bool Cuts::makeCuts(AnalysisEvent& event, double& eventWeight, std::map<std::string, std::shared_ptr<Plots>>& plotMap, TH1D& cutFlow, const int systToRun) {
+bool Cuts::makeSharedCuts(AnalysisEvent& event, std::vector<SystVariation>& variations) {
 
-    if (doPlots_) plotMap["noSel"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(0.5, eventWeight);
+    stageVariations_.clear();
+    for (auto& variation : variations) {
+        stageVariations_.emplace_back(&variation);
+    }
+
+    fillStage(event, "noSel", 0.5);
 
     if (!skipTrigger_) {
-        if (!triggerCuts(event, eventWeight, systToRun))  return false; // Do trigger cuts
+        if (!triggerCuts(event))  return false; // Do trigger cuts
     }
 
     if ( !event.metFilters() ) return false;
 
-    if (doPlots_) plotMap["trigSel"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(1.5, eventWeight);
+    fillStage(event, "trigSel", 1.5);
 
     // Make lepton cuts. If the trigLabel contains d, we are in the ttbar CR so the Z mass cut is skipped
     ////  Do this outside original function because this is simpler for HToSS unlike in tZq
     ////  if (!makeLeptonCuts(event, eventWeight, plotMap, cutFlow, systToRun)) return false;
 
-    event.muonIndexTight = getLooseMuons(event);
+    getLooseMuons(event, event.muonIndexTight);
     if (event.muonIndexTight.size() < numTightMu_) return false;
 
-    if (doPlots_) plotMap["lepSel"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(2.5, eventWeight);
+    fillStage(event, "lepSel", 2.5);
 
     const bool validDileptonCand = getDileptonCand(event, event.muonIndexTight);
     if ( !validDileptonCand ) return false;
 
-    if (doPlots_) plotMap["zCand"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(3.5, eventWeight);
+    fillStage(event, "zCand", 3.5);
 
     const double dileptonMass {(event.zPairLeptons.first + event.zPairLeptons.second).M()};
 
     // This is to make some skims for faster running. Do lepSel and save some files. If flag is true, scalar mass cuts are applied, and dilepton mass <= threshold, fill tree
-    if (postLepSelTree_ && dileptonMass <= scalarMassCut_ && !skipScalarMassCut_) postLepSelTree_->Fill();
+    // Filled once per variation, as when each systematic was selected separately
+    if (postLepSelTree_ && dileptonMass <= scalarMassCut_ && !skipScalarMassCut_) {
+        for (size_t i{0}; i < variations.size(); i++) postLepSelTree_->Fill();
+    }
 
 ////    eventWeight *= getLeptonWeight(event, systToRun);
 //    event.muonMomentumSF = getRochesterSFs(event);
 
     // Get CHS
-    event.chsIndex = getChargedHadronTracks(event);
+    getChargedHadronTracks(event, event.chsIndex);
     if ( event.chsIndex.size() < 2 ) return false;
 
-    if (doPlots_) plotMap["trackSel"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(4.5, eventWeight);
+    fillStage(event, "trackSel", 4.5);
 
     const bool validDihadronCand = getDihadronCand(event, event.chsIndex);
 
-    if (doPlots_ || fillCutFlow_) std::tie(event.jetIndex, event.jetSmearValue) = makeJetCuts(event, systToRun, eventWeight, false);
-
     // If dilepton mass is greater than threshold value, return false
     if ( dileptonMass > scalarMassCut_ && !skipScalarMassCut_ ) return false;
 
-    if (doPlots_ || fillCutFlow_) std::tie(event.jetIndex, event.jetSmearValue) = makeJetCuts(event, systToRun, eventWeight, false);
-
-/////
-
-    std::tie(event.jetIndex, event.jetSmearValue) =  makeJetCuts(event, systToRun, eventWeight, true);
-    event.bTagIndex = makeBCuts(event, event.jetIndex, systToRun);
-
+    // The jets don't enter the selection, so an event without a hadron pair
+    // fails for every variation
     if (!validDihadronCand) return false;
-    if (doPlots_) plotMap["hadCand"]->fillAllPlots(event, eventWeight);
-    if (doPlots_ || fillCutFlow_) cutFlow.Fill(5.5, eventWeight);
 
-    if ( (event.chsPairVec.first + event.chsPairVec.second).M() > scalarMassCut_ && !skipScalarMassCut_ ) return false;
+    passesHadronMassCuts_ = true;
+    if ( (event.chsPairVec.first + event.chsPairVec.second).M() > scalarMassCut_ && !skipScalarMassCut_ ) passesHadronMassCuts_ = false;
 
     //// Apply side band cut for data
     if (!isMC_ && !unblind_) {
         float muScalarMass ( (event.zPairLeptons.first + event.zPairLeptons.second).M() ), hadScalarMass ( (event.chsPairTrkVec.first + event.chsPairTrkVec.second).M() );
-        if ( muScalarMass  < hadScalarMass*1.05 && muScalarMass  >= hadScalarMass*0.95 ) return false;
-        else if ( hadScalarMass < muScalarMass*1.05  && hadScalarMass >= muScalarMass*0.83  ) return false;
+        if ( muScalarMass  < hadScalarMass*1.05 && muScalarMass  >= hadScalarMass*0.95 ) passesHadronMassCuts_ = false;
+        else if ( hadScalarMass < muScalarMass*1.05  && hadScalarMass >= muScalarMass*0.83  ) passesHadronMassCuts_ = false;
     }
 
+    return true;
+}
+
+bool Cuts::makeSystCuts(AnalysisEvent& event, std::vector<SystVariation>& variations, const size_t selected) {
+
+    // The b-tag weight goes to every variation sharing the selection
+    double selectionWeight{1.0};
+    const Systematic& syst{*variations[selected].systematic};
+    makeJetCuts(event, syst, selectionWeight, event.jetIndex, event.jetSmearValue, true);
+    makeBCuts(event, event.jetIndex, event.bTagIndex, syst);
+
+    stageVariations_.clear();
+    for (auto& variation : variations) {
+        if (!sharesSelection(variations[selected], variation)) continue;
+        variation.weight *= selectionWeight;
+        stageVariations_.emplace_back(&variation);
+    }
+
+    fillStage(event, "hadCand", 5.5);
+
+    if (!passesHadronMassCuts_) return false;
+
 //    if (event.jetIndex.size() < numJets_) return false;
 //    if (event.jetIndex.size() > maxJets_) return false;
 //    if (event.bTagIndex.size() < numbJets_) return false;
@@ -483,56 +455,105 @@ bool Cuts::makeCuts(AnalysisEvent& event, double& eventWeight, std::map<std::str
     return true;
 }
 
-std::vector<double> Cuts::getRochesterSFs(const AnalysisEvent& event) const {
-    std::vector<double> SFs{};
-
-    for (auto muonIt = event.muonIndexTight.begin(); muonIt != event.muonIndexTight.end(); muonIt++) {
-        double tempSF{1.0};
-        if (isMC_) {
-            if (event.genMuonPF2PATPT[*muonIt] > 0) { // matched gen muon
-                tempSF = rc_.kSpreadMC(event.muonPF2PATCharge[*muonIt], event.muonPF2PATPt[*muonIt], event.muonPF2PATEta[*muonIt], event.muonPF2PATPhi[*muonIt], event.genMuonPF2PATPT[*muonIt]);
-            }
-            else {
-                static std::uniform_real_distribution<> u{0, 1};
-
-                // We need a uniformly distributed "random" number, but this
-                // should be the same every time, e.g. when we are looking at
-                // systematics. So we will seed the random number generator
-                // with a hash combining the properties of the muon (and make
-                // the hopefully safe assumption no two muons have EXACTLY
-                // the same properties within the same event)
-                size_t seed{0};
-                boost::hash_combine(seed, event.muonPF2PATCharge[*muonIt]);
-                boost::hash_combine(seed, event.muonPF2PATPt[*muonIt]);
-                boost::hash_combine(seed, event.muonPF2PATEta[*muonIt]);
-                boost::hash_combine(seed, event.muonPF2PATPhi[*muonIt]);
-                boost::hash_combine(seed, event.muonPF2PATTkLysWithMeasurements[*muonIt]);
-                boost::hash_combine(seed, event.eventNum);
-
-                std::mt19937 gen(seed);
-
-                tempSF = rc_.kSmearMC(event.muonPF2PATCharge[*muonIt], event.muonPF2PATPt[*muonIt], event.muonPF2PATEta[*muonIt], event.muonPF2PATPhi[*muonIt], event.muonPF2PATTkLysWithMeasurements[*muonIt], u(gen));
-            }
+void Cuts::fillStage(const AnalysisEvent& event, const std::string& stage, const double cutFlowBin) {
+    if (doPlots_) {
+        stagePlots_.clear();
+        stageWeights_.clear();
+        for (const SystVariation* variation : stageVariations_) {
+            stagePlots_.emplace_back((*variation->plots)[stage].get());
+            stageWeights_.emplace_back(variation->weight);
         }
-        else {
-            tempSF = rc_.kScaleDT(event.muonPF2PATCharge[*muonIt], event.muonPF2PATPt[*muonIt], event.muonPF2PATEta[*muonIt], event.muonPF2PATPhi[*muonIt]);
+        Plots::fillAllPlots(event, stagePlots_, stageWeights_);
+    }
+    if (doPlots_ || fillCutFlow_) {
+        for (const SystVariation* variation : stageVariations_) {
+            variation->cutFlow->fill(cutFlowBin, variation->weight);
         }
-        SFs.emplace_back(tempSF);
+    }
+}
+
+std::vector<std::string> Cuts::getBranchManifest() const {
+    // Every ntuple branch read by the selection. Trigger and MET filter
+    // branches are looked after by AnalysisEvent itself.
+    std::vector<std::string> branches{
+        "eventNum", "fixedGridRhoFastjetAll",
+        // Electrons
+        "numElePF2PAT", "elePF2PATPT", "elePF2PATSCEta", "elePF2PATCutIdVeto", "elePF2PATCutIdTight", "elePF2PATIsGsf", "elePF2PATRhoIso", "elePF2PATD0PV", "elePF2PATDZPV",
+        // Muons
+        "numMuonPF2PAT", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ", "muonPF2PATPt", "muonPF2PATEta", "muonPF2PATPhi", "muonPF2PATCharge",
+        "muonPF2PATLooseCutId", "muonPF2PATTightCutId", "muonPF2PATIsPFMuon", "muonPF2PATGlobalID", "muonPF2PATTrackID", "muonPF2PATPfIsoVeryLoose", "muonPF2PATComRelIsodBeta",
+        "muonPF2PATGlbTkNormChi2", "muonPF2PATMatchedStations", "muonPF2PATMuonNHits", "muonPF2PATVldPixHits", "muonPF2PATTkLysWithMeasurements", "muonPF2PATDBPV", "muonPF2PATDZPV",
+        "muonPF2PATPackedCandIndex",
+        // Refitted muon track pairs
+        "numMuonTrackPairsPF2PAT", "muonTkPairPF2PATIndex1", "muonTkPairPF2PATIndex2",
+        "muonTkPairPF2PATTk1Px", "muonTkPairPF2PATTk1Py", "muonTkPairPF2PATTk1Pz", "muonTkPairPF2PATTk1P2",
+        "muonTkPairPF2PATTk2Px", "muonTkPairPF2PATTk2Py", "muonTkPairPF2PATTk2Pz", "muonTkPairPF2PATTk2P2",
+        // Packed PF candidates
+        "numPackedCands", "packedCandsPx", "packedCandsPy", "packedCandsPz", "packedCandsE", "packedCandsCharge", "packedCandsPdgId", "packedCandsFromPV",
+        "packedCandsMuonIndex", "packedCandsHasTrackDetails", "packedCandsPseudoTrkPt", "packedCandsPseudoTrkEta", "packedCandsPseudoTrkPhi",
+        // Refitted charged hadron track pairs
+        "numChsTrackPairs", "chsTkPairIndex1", "chsTkPairIndex2",
+        "chsTkPairTk1Pt", "chsTkPairTk1Eta", "chsTkPairTk1Phi", "chsTkPairTk1P2",
+        "chsTkPairTk2Pt", "chsTkPairTk2Eta", "chsTkPairTk2Phi", "chsTkPairTk2P2",
+        // Jets
+        "numJetPF2PAT", "jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPtRaw", "jetPF2PATPID", "jetPF2PATdRClosestLepton",
+        "jetPF2PATNConstituents", "jetPF2PATChargedMultiplicity", "jetPF2PATNeutralMultiplicity", "jetPF2PATMuonFraction",
+        "jetPF2PATChargedEmEnergyFraction", "jetPF2PATChargedHadronEnergyFraction", "jetPF2PATNeutralEmEnergyFraction", "jetPF2PATNeutralHadronEnergyFraction",
+        "jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"};
+
+    if (isMC_) {
+        branches.insert(branches.end(), {"genJetPF2PATPT", "genJetPF2PATEta", "genJetPF2PATPhi", "genMuonPF2PATPT"});
+    }
+
+    return branches;
+}
+
+std::vector<double> Cuts::getRochesterSFs(const AnalysisEvent& event) const {
+    constexpr size_t MAXMUONS{AnalysisEvent::NMUONSMAX};
+    const size_t numMuons{std::min(event.muonIndexTight.size(), MAXMUONS)};
+    std::array<int, MAXMUONS> charge;
+    std::array<double, MAXMUONS> pt;
+    std::array<double, MAXMUONS> eta;
+    std::array<double, MAXMUONS> phi;
+    std::array<int, MAXMUONS> nTrkLayers;
+    std::array<double, MAXMUONS> genPt;
+    std::array<double, MAXMUONS> u;
+    for (size_t i{0}; i < numMuons; i++) {
+        const int index{event.muonIndexTight[i]};
+        charge[i] = event.muonPF2PATCharge[index];
+        pt[i] = event.muonPF2PATPt[index];
+        eta[i] = event.muonPF2PATEta[index];
+        phi[i] = event.muonPF2PATPhi[index];
+        nTrkLayers[i] = event.muonPF2PATTkLysWithMeasurements[index];
+        genPt[i] = isMC_ ? event.genMuonPF2PATPT[index] : 0.;
+        // We need a uniformly distributed "random" number for unmatched
+        // muons, but this should be the same every time, e.g. when we are
+        // looking at systematics. Keying a counter based generator on the
+        // event and counting over the muons gives just that.
+        u[i] = Philox::uniform(static_cast<uint64_t>(event.eventNum), static_cast<uint64_t>(index));
+    }
+
+    std::vector<double> SFs(numMuons, 1.0);
+    if (isMC_) {
+        rc_.kCorrectMC(static_cast<int>(numMuons), charge.data(), pt.data(), eta.data(), phi.data(), nTrkLayers.data(), genPt.data(), u.data(), SFs.data());
+    }
+    else {
+        rc_.kScaleDT(static_cast<int>(numMuons), charge.data(), pt.data(), eta.data(), phi.data(), SFs.data());
     }
 
     return SFs;
 }
 
 // Make lepton cuts. Will become customisable in a config later on.
-bool Cuts::makeLeptonCuts( AnalysisEvent& event, double& eventWeight, std::map<std::string, std::shared_ptr<Plots>>& plotMap, TH1D& cutFlow, const int& syst ) {
+bool Cuts::makeLeptonCuts( AnalysisEvent& event, double& eventWeight, std::map<std::string, std::shared_ptr<Plots>>& plotMap, TH1D& cutFlow, const Systematic& syst ) {
 
     ////Do lepton selection.
 
-//    event.muonIndexTight = getTightMuons(event);
-    event.muonIndexTight = getLooseMuons(event);
+//    getTightMuons(event, event.muonIndexTight);
+    getLooseMuons(event, event.muonIndexTight);
     if (event.muonIndexTight.size() < numTightMu_) return false;
 
-    event.muonIndexLoose = getLooseMuons(event);
+    getLooseMuons(event, event.muonIndexLoose);
     if (event.muonIndexLoose.size() < numLooseMu_) return false;
 
     // This is to make some skims for faster running. Do lepSel and save some
@@ -544,7 +565,7 @@ bool Cuts::makeLeptonCuts( AnalysisEvent& event, double& eventWeight, std::map<s
     if ( !getDileptonCand(event, event.muonIndexTight) ) return false;
 
     // Get CHS
-    event.chsIndex = getChargedHadronTracks(event);
+    getChargedHadronTracks(event, event.chsIndex);
     if ( event.chsIndex.size() < 2 ) return false;
 
     getDihadronCand(event, event.chsIndex);
@@ -559,7 +580,7 @@ bool Cuts::makeLeptonCuts( AnalysisEvent& event, double& eventWeight, std::map<s
 
 //    eventWeight *= getLeptonWeight(event, syst);
 
-    if (doPlots_ || fillCutFlow_) std::tie(event.jetIndex, event.jetSmearValue) = makeJetCuts(event, syst, eventWeight, false);
+    if (doPlots_ || fillCutFlow_) makeJetCuts(event, syst, eventWeight, event.jetIndex, event.jetSmearValue, false);
     if (doPlots_) plotMap["lepSel"]->fillAllPlots(event, eventWeight);
     if (doPlots_ || fillCutFlow_) cutFlow.Fill(1.5, eventWeight);
 
@@ -582,15 +603,15 @@ bool Cuts::makeLeptonCuts( AnalysisEvent& event, double& eventWeight, std::map<s
 
     if ( (event.zPairLeptons.first + event.zPairLeptons.second).M() > scalarMassCut_ && !skipScalarMassCut_ ) return false;
 
-    if (doPlots_ || fillCutFlow_) std::tie(event.jetIndex, event.jetSmearValue) = makeJetCuts(event, syst, eventWeight, false);
+    if (doPlots_ || fillCutFlow_) makeJetCuts(event, syst, eventWeight, event.jetIndex, event.jetSmearValue, false);
     if (doPlots_) plotMap["zCand"]->fillAllPlots(event, eventWeight);
     if (doPlots_ || fillCutFlow_) cutFlow.Fill(2.5, eventWeight);
 
     return true;
 }
 
-std::vector<int> Cuts::getTightEles(const AnalysisEvent& event) const {
-    std::vector<int> electrons;
+void Cuts::getTightEles(const AnalysisEvent& event, std::vector<int>& electrons) const {
+    electrons.clear();
 
     for (int i{0}; i < event.numElePF2PAT; i++) {
         if (!event.elePF2PATIsGsf[i]) continue;
@@ -619,11 +640,10 @@ std::vector<int> Cuts::getTightEles(const AnalysisEvent& event) const {
         }
         electrons.emplace_back(i);
     }
-    return electrons;
 }
 
-std::vector<int> Cuts::getLooseEles(const AnalysisEvent& event) const {
-    std::vector<int> electrons;
+void Cuts::getLooseEles(const AnalysisEvent& event, std::vector<int>& electrons) const {
+    electrons.clear();
     for (int i{0}; i < event.numElePF2PAT; i++) {
 
         if (electrons.size() < 1 && event.elePF2PATPT[i] <= looseElePtLeading_) continue;
@@ -649,11 +669,10 @@ std::vector<int> Cuts::getLooseEles(const AnalysisEvent& event) const {
         }
         electrons.emplace_back(i);
     }
-    return electrons;
 }
 
-std::vector<int> Cuts::getTightMuons(const AnalysisEvent& event) const {
-    std::vector<int> muons;
+void Cuts::getTightMuons(const AnalysisEvent& event, std::vector<int>& muons) const {
+    muons.clear();
     if (is2016_ || is2016APV_) {
         for (int i{0}; i < event.numMuonPF2PAT; i++) {
             if (!event.muonPF2PATIsPFMuon[i])
@@ -694,11 +713,10 @@ std::vector<int> Cuts::getTightMuons(const AnalysisEvent& event) const {
             }
         }
     }
-    return muons;
 }
 
-std::vector<int> Cuts::getLooseMuons(const AnalysisEvent& event) const {
-    std::vector<int> muons;
+void Cuts::getLooseMuons(const AnalysisEvent& event, std::vector<int>& muons) const {
+    muons.clear();
     if (is2016_ || is2016APV_) {
         for (int i{0}; i < event.numMuonPF2PAT; i++) {
             if (!event.muonPF2PATIsPFMuon[i]) continue;
@@ -727,36 +745,37 @@ std::vector<int> Cuts::getLooseMuons(const AnalysisEvent& event) const {
             }
         }
     }
-    return muons;
 }
 
-std::vector<int> Cuts::getChargedHadronTracks(const AnalysisEvent& event) const {
-    std::vector<int> chs;
+void Cuts::getChargedHadronTracks(const AnalysisEvent& event, std::vector<int>& chs) const {
+    const PackedCandKinematics& packedCands{event.packedCandKinematics()};
+    chs.clear();
     for (Int_t k = 0; k < event.numPackedCands; k++) {
         if (std::abs(event.packedCandsPdgId[k]) != 211) continue;
         if (event.packedCandsCharge[k] == 0 ) continue;
         if (event.packedCandsHasTrackDetails[k] != 1 ) continue;
-        TLorentzVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
-        if (lVec.Pt() < 1.0) continue;
+        if (packedCands.pt[k] < 1.0f) continue;
 
         chs.emplace_back(k);
     }
-    return chs;
 }
 
 bool Cuts::getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons) const {    // Check if there are at least two electrons first. Otherwise use muons.
 
+    event.loadCollection(AnalysisEvent::Collection::packedCands);
+    event.loadCollection(AnalysisEvent::Collection::muonTracks);
     for ( unsigned int i{0}; i < muons.size(); i++ ) {
         for ( unsigned int j{i+1}; j < muons.size(); j++ ) {
 
             if (event.muonPF2PATCharge[muons[i]] * event.muonPF2PATCharge[muons[j]] >= 0) continue;
 
-            TLorentzVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
-            TLorentzVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
+            FourVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
+            FourVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
             const double delR { lepton1.DeltaR(lepton2) };
             if ( delR < maxDileptonDeltaR_  ) {
                 event.zPairLeptons.first  = lepton1.Pt() > lepton2.Pt() ? lepton1 : lepton2;
                 event.zPairLeptons.second = lepton1.Pt() > lepton2.Pt() ? lepton2 : lepton1;
+                event.pairsChanged();
                 event.zPairIndex.first = lepton1.Pt() > lepton2.Pt() ? muons[i] : muons[j];
                 event.zPairIndex.second  = lepton1.Pt() > lepton2.Pt() ? muons[j] : muons[i];
                 event.zPairRelIso.first  = event.muonPF2PATComRelIsodBeta[muons[i]];
@@ -765,60 +784,36 @@ bool Cuts::getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons)
                 if (!event.muonPF2PATPfIsoVeryLoose[event.zPairIndex.first]) continue;
                 if (event.muonPF2PATComRelIsodBeta[event.zPairIndex.second] > 1.0) continue;
 
+                // pf and trk isolation sums around each lepton and the pair
+                using Iso = PackedCandIsolation;
+                PackedCandIsolation& packedCandIso{event.packedCandIsolation()};
+                const int excludeCand1{event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
+                const int excludeCand2{event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
+                const Iso::pairSums pfIso{packedCandIso.pairIsolation(Iso::Pair::muons, event.zPairIndex.first, event.zPairIndex.second, Iso::Vec::pf, event.zPairLeptons.first, event.zPairLeptons.second, excludeCand1, excludeCand2)};
+                const Iso::pairSums trkIso{packedCandIso.pairIsolation(Iso::Pair::muons, event.zPairIndex.first, event.zPairIndex.second, Iso::Vec::pseudoTrack, event.zPairLeptons.first, event.zPairLeptons.second, excludeCand1, excludeCand2)};
+                const size_t cone{Iso::CONE_0P4};
+
                 // pf quantities
-                float neutral_iso {0.0}, neutral_iso1 {0.0}, neutral_iso2 {0.0};
-                float ch_iso {0.0}, ch_iso1 {0.0}, ch_iso2 {0.0};
-                float pu_iso {0.0}, pu_iso1 {0.0}, pu_iso2 {0.0};
+                const float neutral_iso1 {pfIso[Iso::FIRST][cone].neutral};
+                const float neutral_iso2 {pfIso[Iso::SECOND][cone].neutral};
+                const float neutral_iso {pfIso[Iso::SUM][cone].neutral};
+                const float ch_iso1 {pfIso[Iso::FIRST][cone].charged};
+                const float ch_iso2 {pfIso[Iso::SECOND][cone].charged};
+                const float ch_iso {pfIso[Iso::SUM][cone].charged};
+                const float pu_iso1 {pfIso[Iso::FIRST][cone].pu};
+                const float pu_iso2 {pfIso[Iso::SECOND][cone].pu};
+                const float pu_iso {pfIso[Iso::SUM][cone].pu};
 
                 // trk quantities
-                float neutral_trkiso {0.0}, neutral_trkiso1 {0.0}, neutral_trkiso2 {0.0};
-                float ch_trkiso {0.0}, ch_trkiso1 {0.0}, ch_trkiso2 {0.0};
-                float pu_trkiso {0.0}, pu_trkiso1 {0.0}, pu_trkiso2 {0.0};
-   
-                for (int k = 0; k < event.numPackedCands; k++) {
-                    if ( k == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] || k == event.muonPF2PATPackedCandIndex[event.zPairIndex.second] ) continue;
-
-                    TLorentzVector packedCandVec, packedCandTrkVec;
-                    packedCandVec.SetPxPyPzE      (event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);
-                    packedCandTrkVec.SetPtEtaPhiE (event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
-
-                    // Charge hadron contributions have to have pT > 0.5
-                    if ( event.packedCandsCharge[k] == 0 ) {
-                        if ( packedCandVec.Pt() >= 0.5 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  neutral_iso1 += packedCandVec.Et();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  neutral_iso2 += packedCandVec.Et();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) neutral_iso += packedCandVec.Et();
-                        }
-                        if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  neutral_trkiso1 += packedCandTrkVec.Et();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  neutral_trkiso2 += packedCandTrkVec.Et();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) neutral_trkiso += packedCandTrkVec.Et();
-                        }
-                    }
-                    else {
-                        if ( event.packedCandsFromPV[k] >= 2 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  ch_iso1 += packedCandVec.Pt();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  ch_iso2 += packedCandVec.Pt();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) ch_iso += packedCandVec.Pt();
-
-                            if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  ch_trkiso1 += packedCandTrkVec.Pt();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  ch_trkiso2 += packedCandTrkVec.Pt();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) ch_trkiso += packedCandTrkVec.Pt();
-                        }
-                        else {
-                            if ( packedCandVec.Pt() >= 0.5 ) {
-                                if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  pu_iso1 += packedCandVec.Pt();
-                                if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  pu_iso2 += packedCandVec.Pt();
-                                if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) pu_iso += packedCandVec.Pt();
-                            }
-       	                    if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                                if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  pu_trkiso1 += packedCandTrkVec.Pt();
-                                if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  pu_trkiso2 += packedCandTrkVec.Pt();
-                                if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) pu_trkiso += packedCandTrkVec.Pt();
-                            }
-                        }
-                    }
-                }
+                const float neutral_trkiso1 {trkIso[Iso::FIRST][cone].neutral};
+                const float neutral_trkiso2 {trkIso[Iso::SECOND][cone].neutral};
+                const float neutral_trkiso {trkIso[Iso::SUM][cone].neutral};
+                const float ch_trkiso1 {trkIso[Iso::FIRST][cone].charged};
+                const float ch_trkiso2 {trkIso[Iso::SECOND][cone].charged};
+                const float ch_trkiso {trkIso[Iso::SUM][cone].charged};
+                const float pu_trkiso1 {trkIso[Iso::FIRST][cone].pu};
+                const float pu_trkiso2 {trkIso[Iso::SECOND][cone].pu};
+                const float pu_trkiso {trkIso[Iso::SUM][cone].pu};
 
                 const float iso1 = ch_iso1 + std::max( float(0.0), neutral_iso1 - float(0.5*pu_iso1) );
                 const float iso2 = ch_iso2 + std::max( float(0.0), neutral_iso2 - float(0.5*pu_iso2) );
@@ -842,8 +837,9 @@ bool Cuts::getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons)
 
 //                if ( (event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06) > 10. ) continue;
 
-                event.zPairLeptonsRefitted.first  = TLorentzVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
-                event.zPairLeptonsRefitted.second = TLorentzVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.first  = FourVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.second = FourVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.pairsChanged();
 
                 return true;
             }
@@ -854,6 +850,8 @@ bool Cuts::getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons)
 
 bool Cuts::getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) const {
 
+    event.loadCollection(AnalysisEvent::Collection::packedCands);
+    event.loadCollection(AnalysisEvent::Collection::chsTracks);
     for ( unsigned int i{0}; i < chs.size(); i++ ) {
 
         if ( event.packedCandsMuonIndex[chs[i]] == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] ) continue;
@@ -866,8 +864,8 @@ bool Cuts::getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) co
 
             if (event.packedCandsCharge[chs[i]] * event.packedCandsCharge[chs[j]] >= 0) continue;
 
-            TLorentzVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
-            TLorentzVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
+            FourVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
+            FourVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
 
             double pT { (chs1+chs2).Pt() };
             double delR { chs1.DeltaR(chs2) };
@@ -876,66 +874,52 @@ bool Cuts::getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) co
             if ( delR < maxChsDeltaR_ ) {
                 event.chsPairVec.first  = chs1.Pt() > chs2.Pt() ? chs1 : chs2;
                 event.chsPairVec.second = chs1.Pt() > chs2.Pt() ? chs2 : chs1;
+                event.pairsChanged();
                 event.chsPairIndex.first = chs1.Pt() > chs2.Pt() ? chs[i] : chs[j];
                 event.chsPairIndex.second = chs1.Pt() > chs2.Pt() ? chs[j] : chs[i];
 
-                TLorentzVector chsTrk1, chsTrk2;
+                FourVector chsTrk1, chsTrk2;
                 chsTrk1.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.first], event.packedCandsPseudoTrkEta[event.chsPairIndex.first], event.packedCandsPseudoTrkPhi[event.chsPairIndex.first], event.packedCandsE[event.chsPairIndex.first]);
                 chsTrk2.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.second], event.packedCandsPseudoTrkEta[event.chsPairIndex.second], event.packedCandsPseudoTrkPhi[event.chsPairIndex.second], event.packedCandsE[event.chsPairIndex.second]);
 
                 event.chsPairTrkVec.first  = chsTrk1;
                 event.chsPairTrkVec.second = chsTrk2;
-
-                float neutral_iso {0.0}, neutral_iso1 {0.0}, neutral_iso2 {0.0};
-                float ch_iso {0.0}, ch_iso1 {0.0}, ch_iso2 {0.0};
-                float pu_iso {0.0}, pu_iso1 {0.0}, pu_iso2 {0.0};
-
-                float neutral_trkiso {0.0}, neutral_trkiso1 {0.0}, neutral_trkiso2 {0.0};
-                float ch_trkiso {0.0}, ch_trkiso1 {0.0}, ch_trkiso2 {0.0};
-                float pu_trkiso {0.0}, pu_trkiso1 {0.0}, pu_trkiso2 {0.0};
-
-                for (int k = 0; k < event.numPackedCands; k++) {
-                    if ( k == event.chsPairIndex.first || k == event.chsPairIndex.second ) continue;
-
-                    TLorentzVector packedCandVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
-                    TLorentzVector packedCandTrkVec;
-                    packedCandTrkVec.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
-
-                    if ( event.packedCandsCharge[k] == 0 ) {
-                        if ( packedCandVec.Pt() >= 0.5 ) {
-                            if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  neutral_iso1 += packedCandVec.Et();
-                            if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  neutral_iso2 += packedCandVec.Et();
-                            if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) neutral_iso += packedCandVec.Et();
-                        }
-                        if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                            if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)  < 0.3 ) neutral_trkiso1 += packedCandTrkVec.Et();
-                            if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec) < 0.3 ) neutral_trkiso2 += packedCandTrkVec.Et();
-                            if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec) ) neutral_trkiso += packedCandVec.Et();
-                        }
-                    }
-                    else {
-                        if ( event.packedCandsFromPV[k] >= 2 ) {
-                            if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  ch_iso1 += packedCandVec.Pt();
-                            if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  ch_iso2 += packedCandVec.Pt();
-                            if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) ch_iso += packedCandVec.Pt();
-
-                            if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)   < 0.3 )  ch_trkiso1 += packedCandTrkVec.Pt();
-                            if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec)  < 0.3 )  ch_trkiso2 += packedCandTrkVec.Pt();
-                            if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec)  < 0.3 ) ch_trkiso += packedCandTrkVec.Pt();
-                        }
-                        else {
-                            if ( packedCandVec.Pt() >= 0.5 ) {
-                                if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  pu_iso1 += packedCandVec.Pt();
-                                if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  pu_iso2 += packedCandVec.Pt();
-                                if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) pu_iso += packedCandVec.Pt();
-                            }
-                            if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                                if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)   < 0.3 )  pu_trkiso1 += packedCandTrkVec.Pt();
-                                if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec)  < 0.3 )  pu_trkiso2 += packedCandTrkVec.Pt();
-                                if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec)  < 0.3 ) pu_trkiso += packedCandTrkVec.Pt();
-                            }
-                        }
-                    }
+                event.pairsChanged();
+
+                using Iso = PackedCandIsolation;
+                const PackedCandKinematics& packedCands{event.packedCandKinematics()};
+                PackedCandIsolation& packedCandIso{event.packedCandIsolation()};
+                const int excludeCand1{event.chsPairIndex.first};
+                const int excludeCand2{event.chsPairIndex.second};
+                const Iso::pairSums pfIso{packedCandIso.pairIsolation(Iso::Pair::chargedHadrons, event.chsPairIndex.first, event.chsPairIndex.second, Iso::Vec::pf, event.chsPairVec.first, event.chsPairVec.second, excludeCand1, excludeCand2)};
+                const Iso::pairSums trkIso{packedCandIso.pairIsolation(Iso::Pair::chargedHadrons, event.chsPairIndex.first, event.chsPairIndex.second, Iso::Vec::pseudoTrack, event.chsPairTrkVec.first, event.chsPairTrkVec.second, excludeCand1, excludeCand2)};
+                const size_t cone{Iso::CONE_0P3};
+
+                const float neutral_iso1 {pfIso[Iso::FIRST][cone].neutral};
+                const float neutral_iso2 {pfIso[Iso::SECOND][cone].neutral};
+                const float neutral_iso {pfIso[Iso::SUM][cone].neutral};
+                const float ch_iso1 {pfIso[Iso::FIRST][cone].charged};
+                const float ch_iso2 {pfIso[Iso::SECOND][cone].charged};
+                const float ch_iso {pfIso[Iso::SUM][cone].charged};
+                const float pu_iso1 {pfIso[Iso::FIRST][cone].pu};
+                const float pu_iso2 {pfIso[Iso::SECOND][cone].pu};
+                const float pu_iso {pfIso[Iso::SUM][cone].pu};
+
+                const float neutral_trkiso1 {trkIso[Iso::FIRST][cone].neutral};
+                const float neutral_trkiso2 {trkIso[Iso::SECOND][cone].neutral};
+                const float ch_trkiso1 {trkIso[Iso::FIRST][cone].charged};
+                const float ch_trkiso2 {trkIso[Iso::SECOND][cone].charged};
+                const float ch_trkiso {trkIso[Iso::SUM][cone].charged};
+                const float pu_trkiso1 {trkIso[Iso::FIRST][cone].pu};
+                const float pu_trkiso2 {trkIso[Iso::SECOND][cone].pu};
+                const float pu_trkiso {trkIso[Iso::SUM][cone].pu};
+
+                // As before, the neutral sum around the track pair has no
+                // cone cut and takes the PF Et
+                float neutral_trkiso {0.0};
+                for (int k = 0; k < packedCands.size; k++) {
+                    if ( k == excludeCand1 || k == excludeCand2 ) continue;
+                    if ( packedCands.neutralTrkEt[k] > 0.f ) neutral_trkiso += packedCands.et[k];
                 }
 
                 const float iso1 = ch_iso1 + std::max( float(0.0), neutral_iso1 - float(0.5*pu_iso1) );
@@ -963,12 +947,13 @@ bool Cuts::getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) co
                 if ( std::isnan(event.chsTkPairTk1P2[event.chsPairTrkIndex])  || std::isnan(event.chsTkPairTk2P2[event.chsPairTrkIndex]) ) return false;
                 if ( std::isnan(event.chsTkPairTk1Phi[event.chsPairTrkIndex]) || std::isnan(event.chsTkPairTk2Phi[event.chsPairTrkIndex]) ) return false;
 
-                TLorentzVector chsTrk1Refitted, chsTrk2Refitted;
+                FourVector chsTrk1Refitted, chsTrk2Refitted;
                 chsTrk1Refitted.SetPtEtaPhiE(event.chsTkPairTk1Pt[event.chsPairTrkIndex], event.chsTkPairTk1Eta[event.chsPairTrkIndex], event.chsTkPairTk1Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk1P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 chsTrk2Refitted.SetPtEtaPhiE(event.chsTkPairTk2Pt[event.chsPairTrkIndex], event.chsTkPairTk2Eta[event.chsPairTrkIndex], event.chsTkPairTk2Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk2P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));	
 
                 event.chsPairTrkVecRefitted.first  = chsTrk1Refitted;
                 event.chsPairTrkVecRefitted.second = chsTrk2Refitted;
+                event.pairsChanged();
 
                 return true;
             }
@@ -978,8 +963,9 @@ bool Cuts::getDihadronCand(AnalysisEvent& event, const std::vector<int>& chs) co
     return false;
 }
 
-double Cuts::getWbosonQuarksCand(AnalysisEvent& event, const std::vector<int>& jets,  const int& syst) const {
+double Cuts::getWbosonQuarksCand(AnalysisEvent& event, const std::vector<int>& jets,  const Systematic& syst) const {
     auto closestWmass{std::numeric_limits<double>::infinity()};
+    const JetCorrectionCache::jets& corrected{correctedJets(event, syst)};
     if (jets.size() > 2) {
         for (unsigned k{0}; k < jets.size(); k++) {
             for (unsigned l{k + 1}; l < jets.size(); l++) {
@@ -994,8 +980,8 @@ double Cuts::getWbosonQuarksCand(AnalysisEvent& event, const std::vector<int>& j
                             if (event.jetIndex[event.bTagIndex[0]] == jets[l]) continue;
                     }
                 }
-                const TLorentzVector jetVec1{getJetLVec(event, jets[k], syst, false).first};
-                const TLorentzVector jetVec2{getJetLVec(event, jets[l], syst, false).first};
+                const FourVector& jetVec1{corrected.rescaled[jets[k]]};
+                const FourVector& jetVec2{corrected.rescaled[jets[l]]};
 
                 double invWbosonMass{(jetVec1 + jetVec2).M() - 80.385};
 
@@ -1014,21 +1000,25 @@ double Cuts::getWbosonQuarksCand(AnalysisEvent& event, const std::vector<int>& j
 
 double Cuts::getTopMass(const AnalysisEvent& event) const
 {
-    TLorentzVector bVec(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]],
+    FourVector bVec(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]],
                         event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]],
                         event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]],
                         event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
     return (bVec + event.wPairQuarks.first + event.wPairQuarks.second).M();
 }
 
-std::pair<std::vector<int>, std::vector<double>>
-    Cuts::makeJetCuts(const AnalysisEvent& event,
-                      const int syst,
-                      double& eventWeight,
-                      const bool isProper) const
+void Cuts::makeJetCuts(const AnalysisEvent& event,
+                       const Systematic& syst,
+                       double& eventWeight,
+                       std::vector<int>& jets,
+                       std::vector<double>& smears,
+                       const bool isProper) const
 {
-    std::vector<int> jets;
-    std::vector<double> smears;
+    // The 2016 rho comes from the electron branches
+    event.loadCollection(AnalysisEvent::Collection::jets);
+    event.loadCollection(AnalysisEvent::Collection::electrons);
+    jets.clear();
+    smears.clear();
 
     double mcTag{1.};
     double mcNoTag{1.};
@@ -1040,10 +1030,11 @@ std::pair<std::vector<int>, std::vector<double>>
     double err3{0.};
     double err4{0.};
 
+    const JetCorrectionCache::jets& corrected{correctedJets(event, syst)};
     for (int i{0}; i < event.numJetPF2PAT; i++)
     {
-        auto [jetVec, smear] = getJetLVec(event, i, syst, true);
-        smears.emplace_back(smear);
+        const FourVector& jetVec{corrected.selected[i]};
+        smears.emplace_back(corrected.smear[i]);
 
         if (jetVec.Pt() <= jetPt_ || jetVec.Eta() >= jetEta_)
         {
@@ -1255,12 +1246,25 @@ std::pair<std::vector<int>, std::vector<double>>
         }
 
         jets.emplace_back(i);
+    }
 
-        if (getBTagWeight_)
-        {
+    if (getBTagWeight_)
+    {
+        // Look up the efficiency bins of all the selected jets at once
+        std::array<double, AnalysisEvent::NJETSMAX> effPt;
+        std::array<double, AnalysisEvent::NJETSMAX> effEta;
+        std::array<int, AnalysisEvent::NJETSMAX> effBins;
+        for (size_t j{0}; j < jets.size(); j++) {
+            effPt[j] = corrected.selected[jets[j]].Pt();
+            effEta[j] = std::abs(corrected.selected[jets[j]].Eta());
+        }
+        bTagEffs_[0].bins(effPt.data(), effEta.data(), jets.size(), effBins.data());
+
+        for (size_t j{0}; j < jets.size(); j++) {
             getBWeight(event,
-                       jetVec,
-                       i,
+                       corrected.selected[jets[j]],
+                       jets[j],
+                       effBins[j],
                        mcTag,
                        mcNoTag,
                        dataTag,
@@ -1283,25 +1287,24 @@ std::pair<std::vector<int>, std::vector<double>>
         }
         const double bWeightErr{
             std::sqrt(pow(err1 + err2, 2) + pow(err3 + err4, 2)) * bWeight};
-        if (syst == 256)
+        if (syst.varies(Systematic::Target::bTag) && syst.up)
         {
             bWeight += bWeightErr;
         }
-        if (syst == 512)
+        if (syst.varies(Systematic::Target::bTag) && !syst.up)
         {
             bWeight -= bWeightErr;
         }
 
         eventWeight *= bWeight;
     }
-
-    return {jets, smears};
 }
 
-std::vector<int> Cuts::makeBCuts(const AnalysisEvent& event, const std::vector<int> jets, const int syst) const {
-    std::vector<int> bJets;
+void Cuts::makeBCuts(const AnalysisEvent& event, const std::vector<int>& jets, std::vector<int>& bJets, const Systematic& syst) const {
+    bJets.clear();
+    const JetCorrectionCache::jets& corrected{correctedJets(event, syst)};
     for (unsigned int i = 0; i < jets.size(); i++) {
-        const TLorentzVector jetVec{getJetLVec(event, jets[i], syst, false).first};
+        const FourVector& jetVec{corrected.rescaled[jets[i]]};
         const float bDisc{event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[jets[i]]};
 
         if (bDisc <= bDiscCut_)
@@ -1310,10 +1313,9 @@ std::vector<int> Cuts::makeBCuts(const AnalysisEvent& event, const std::vector<i
             continue;
         bJets.emplace_back(i);
     }
-    return bJets;
 }
 
-bool Cuts::triggerCuts(const AnalysisEvent& event, double& eventWeight, const int& syst) const {
+bool Cuts::triggerCuts(const AnalysisEvent& event) const {
     if (skipTrigger_) {
         return true;
     }
@@ -1380,7 +1382,7 @@ double Cuts::deltaR(const double& eta1, const double& phi1, const double& eta2,
     return std::sqrt(std::pow(eta1 - eta2, 2) + std::pow(deltaPhi(phi1, phi2), 2));
 }
 
-double Cuts::getLeptonWeight(const AnalysisEvent& event, const int& syst) const {
+double Cuts::getLeptonWeight(const AnalysisEvent& event, const Systematic& syst) const {
     // If number of electrons is > 1  then both z pair are electrons, so get
     // their weight
     if (!isMC_) {
@@ -1405,7 +1407,7 @@ double Cuts::getLeptonWeight(const AnalysisEvent& event, const int& syst) const
     return leptonWeight;
 }
 
-double Cuts::eleSF(const double& pt, const double& eta, const int& syst) const {
+double Cuts::eleSF(const double& pt, const double& eta, const Systematic& syst) const {
     return 1.0;
 /*
     int binId{0};
@@ -1422,7 +1424,7 @@ double Cuts::eleSF(const double& pt, const double& eta, const int& syst) const {
     double eleIdSF{h_eleSFs->GetBinContent(binId)};
     double eleRecoSF{h_eleReco->GetBinContent(binReco)};
 
-    if (syst == 1) {
+    if (syst.varies(Systematic::Target::leptonSF) && syst.up) {
         eleIdSF += h_eleSFs->GetBinError(binId);
         eleRecoSF += h_eleReco->GetBinError(binReco);
         if (pt > 80.0 || pt <= 20.0) {
@@ -1430,7 +1432,7 @@ double Cuts::eleSF(const double& pt, const double& eta, const int& syst) const {
         }
     }
 
-    if (syst == 2) {
+    if (syst.varies(Systematic::Target::leptonSF) && !syst.up) {
         eleIdSF -= h_eleSFs->GetBinError(binId);
         eleRecoSF -= h_eleReco->GetBinError(binReco);
         if (pt > 80.0 || pt <= 20.0) {
@@ -1442,52 +1444,36 @@ double Cuts::eleSF(const double& pt, const double& eta, const int& syst) const {
 */
 }
 
-double Cuts::muonSF(const double& pt, const double& eta, const int& syst, const bool& leadingMuon) const {
+double Cuts::muonSF(const double& pt, const double& eta, const Systematic& syst, const bool& leadingMuon) const {
 
-    int binId{0}, binIso{0}, binHlt{0};
     double muonIdSF{1.0}, muonIsoSF{1.0}, muonHltSF {1.0};
 
-    if (pt > maxMuonIdPt_) binId = h_muonId->FindBin(std::abs(eta), maxMuonIdPt_);
-    else if (pt < minMuonIdPt_) binId = h_muonId->FindBin(std::abs(eta), minMuonIdPt_);
-    else binId = h_muonId->FindBin(std::abs(eta), pt);
-
-    if (pt > maxMuonIsoPt_) binIso = h_muonIso->FindBin(std::abs(eta), maxMuonIsoPt_);
-    else if (pt < minMuonIsoPt_) binIso = h_muonIso->FindBin(std::abs(eta), minMuonIsoPt_);
-    else binIso = h_muonIso->FindBin(std::abs(eta), pt);
+    const double idPt{pt > maxMuonIdPt_ ? maxMuonIdPt_ : pt < minMuonIdPt_ ? minMuonIdPt_ : pt};
+    const double isoPt{pt > maxMuonIsoPt_ ? maxMuonIsoPt_ : pt < minMuonIsoPt_ ? minMuonIsoPt_ : pt};
+    const ScaleFactorTable::entry& idSFs{muonIdSFs_.at(std::abs(eta), idPt)};
+    const ScaleFactorTable::entry& isoSFs{muonIsoSFs_.at(std::abs(eta), isoPt)};
 
 //    if (pt > maxMuonHltPt_) binHlt = h_muonHlt->FindBin(std::abs(eta), maxMuonHltPt_);
 //    else if (pt < minMuonHltPt_) binHlt = h_muonHlt->FindBin(std::abs(eta), minMuonHltPt_);
 //    else binHlt = h_muonHlt->FindBin(std::abs(eta), pt);
 
-    muonIdSF  = h_muonId->GetBinContent(binId);
-    if (leadingMuon) muonIsoSF = h_muonIso->GetBinContent(binIso);
+    muonIdSF  = idSFs.nominal;
+    if (leadingMuon) muonIsoSF = isoSFs.nominal;
 //    if (leadingMuon) muonHltSF   = h_muonHlt->GetBinContent(binHlt);
 
-    if (syst == 1 || syst == 2) {
-
-        double idSystUncert = h_muonIdSyst->GetBinError(binId);
-        double idStatUncert = h_muonIdStat->GetBinError(binId);
-        double idUncert = std::sqrt(idStatUncert*idStatUncert + idSystUncert*idSystUncert);
-
-        double isoSystUncert = h_muonIsoSyst->GetBinError(binId);
-        double isoStatUncert = h_muonIso->GetBinError(binId);
-        double isoUncert = std::sqrt(isoStatUncert*isoStatUncert + isoSystUncert*isoSystUncert);
-
-        if (syst == 1) {
-            muonIdSF += idUncert;
-            if (leadingMuon) muonIsoSF += isoUncert;
+    if (syst.varies(Systematic::Target::leptonSF)) {
+        if (syst.up) {
+            muonIdSF = idSFs.up;
+            if (leadingMuon) muonIsoSF = isoSFs.up;
 //            if (leadingMuon) muonHltSF += h_muonHlt->GetBinError(binHlt);
         }
-        else if (syst == 2) {
-            muonIdSF -= idUncert;
-            if (leadingMuon) muonIsoSF -= isoUncert;
+        else {
+            muonIdSF = idSFs.down;
+            if (leadingMuon) muonIsoSF = isoSFs.down;
 //            if (leadingMuon) muonHltSF   -= h_muonHlt->GetBinError(binHlt);
         }
-        return muonIdSF * muonIsoSF * muonHltSF;
-    }
-    else {
-        return muonIdSF * muonIsoSF * muonHltSF;
     }
+    return muonIdSF * muonIsoSF * muonHltSF;
 }
 
 int Cuts::getMuonTrackPairIndex(const AnalysisEvent& event) const { 
@@ -1504,547 +1490,199 @@ int Cuts::getChsTrackPairIndex(const AnalysisEvent& event) const {
     return -1;
 }
 
-void Cuts::initialiseJECCors() {
-    std::ifstream jecFile;
-    if (!is2016_) {
-        jecFile.open("scaleFactors/2017/Fall17_17Nov2017_V32_MC_Uncertainty_AK4PFchs.txt", std::ifstream::in);
-    }
-    else {
-        jecFile.open("scaleFactors/2016/Summer16_23Sep2016V4_MC_Uncertainty_AK4PFchs.txt", std::ifstream::in);
-    }
-    std::string line;
-    bool first{true};
-
-    if (!jecFile.is_open()) {
-        std::cout << "Unable to open jecFile." << std::endl;
-        std::exit(0);
+void Cuts::setBTagPlots(std::vector<TH2D*> vec, bool makePlotsOrRead) {
+    makeBTagEffPlots_ = makePlotsOrRead;
+    bTagEffPlots_ = vec;
+    getBTagWeight_ = !makePlotsOrRead;
+    if (!getBTagWeight_) {
+        return;
     }
 
-    while (getline(jecFile, line)) {
-        std::vector<std::string> tempVec;
-        std::stringstream lineStream{line};
-        std::string item;
-        while (std::getline(lineStream, item, ' ')) {
-            tempVec.emplace_back(item);
+    // Tagged over all jets of each flavour. getBWeight looks up every jet's
+    // bin once, so the plots must all be binned the same way.
+    for (size_t flavour{0}; flavour < bTagEffs_.size(); flavour++) {
+        bTagEffs_[flavour] = ScaleFactorTable::ratio(*bTagEffPlots_[flavour + bTagEffs_.size()], *bTagEffPlots_[flavour]);
+        if (!bTagEffs_[flavour].sameBinning(bTagEffs_[0])) {
+            throw std::logic_error("b-tag efficiency plots have different binnings");
         }
-        std::vector<double> tempUp;
-        std::vector<double> tempDown;
-
-        etaMinJEC_.emplace_back(std::stof(tempVec[0]));
-        etaMaxJEC_.emplace_back(std::stof(tempVec[1]));
-        for (unsigned i{1}; i < tempVec.size() / 3; i++) {
-            unsigned ind{i * 3};
-            if (first) {
-                ptMinJEC_.emplace_back(std::stof(tempVec[ind]));
-                ptMaxJEC_.emplace_back((ind + 3 >= tempVec.size()
-                                            ? 10000.
-                                            : std::stof(tempVec[ind + 3])));
-            }
-            tempUp.emplace_back(std::stof(tempVec[ind + 1]));
-            tempDown.emplace_back(std::stof(tempVec[ind + 2]));
-        }
-        jecSFUp_.emplace_back(tempUp);
-        jecSFDown_.emplace_back(tempDown);
-        first = false;
     }
 }
 
-double Cuts::getJECUncertainty(const double& pt, const double& eta, const int& syst) const {
-    if (!(syst == 4 || syst == 8)) {
-        return 0.;
-    }
-    unsigned ptBin{0};
-    unsigned etaBin{0};
-    for (unsigned i{0}; i < ptMinJEC_.size(); i++) {
-        if (pt > ptMinJEC_[i] && pt < ptMaxJEC_[i]) {
-            ptBin = i;
-            break;
-        }
-    }
-    for (unsigned i{0}; i < etaMinJEC_.size(); i++) {
-        if (eta > etaMinJEC_[i] && eta < etaMaxJEC_[i]) {
-            etaBin = i;
-            break;
-        }
-    }
-
-    const double lowFact{syst == 4 ? jecSFUp_[etaBin][ptBin] : jecSFDown_[etaBin][ptBin]};
-    const double hiFact{syst == 4 ? jecSFUp_[etaBin][ptBin + 1] : jecSFDown_[etaBin][ptBin + 1]};
-
-    // Now do some interpolation
-    const double a{(hiFact - lowFact) / (ptMaxJEC_[ptBin] - ptMinJEC_[ptBin])};
-    const double b{(lowFact * (ptMaxJEC_[ptBin]) - hiFact * ptMinJEC_[ptBin]) / (ptMaxJEC_[ptBin] - ptMinJEC_[ptBin])};
-    return (syst == 4 ? a * pt + b : -(a * pt + b));
+void Cuts::initialiseJECCors() {
+    jecUncertainties_ = JECUncertaintyTable::load(!is2016_ ? "scaleFactors/2017/Fall17_17Nov2017_V32_MC_Uncertainty_AK4PFchs.txt"
+                                                           : "scaleFactors/2016/Summer16_23Sep2016V4_MC_Uncertainty_AK4PFchs.txt");
 }
 
-std::pair<TLorentzVector, double> Cuts::getJetLVec(const AnalysisEvent& event, const int& index, const int& syst, const bool& initialRun) const {
-    static constexpr double MIN_JET_ENERGY{1e-2};
-    TLorentzVector returnJet;
-    double newSmearValue{1.0};
-
-    if (!initialRun) {
-        newSmearValue = event.jetSmearValue.at(index);
-        returnJet.SetPxPyPzE(event.jetPF2PATPx[index], event.jetPF2PATPy[index], event.jetPF2PATPz[index], event.jetPF2PATE[index]);
-        returnJet *= newSmearValue;
-
-        if (isMC_) {
-            double jerUncer{
-                getJECUncertainty(returnJet.Pt(), returnJet.Eta(), syst)};
-            returnJet *= 1 + jerUncer;
-        }
-
-        return {returnJet, newSmearValue};
-    }
+double Cuts::getJECUncertainty(const double& pt, const double& eta, const bool up) const {
+    jecLookups_++;
+    const double uncertainty{jecUncertainties_->uncertainty(pt, eta, up)};
+    return up ? uncertainty : -uncertainty;
+}
 
-    if (!isMC_) {
-        returnJet.SetPxPyPzE(event.jetPF2PATPx[index], event.jetPF2PATPy[index], event.jetPF2PATPz[index], event.jetPF2PATE[index]);
-        return {returnJet, newSmearValue};
+JetCorrectionCache::Variation Cuts::jetVariation(const Systematic& syst) {
+    using Variation = JetCorrectionCache::Variation;
+    if (syst.varies(Systematic::Target::jes)) {
+        return syst.up ? Variation::jesUp : Variation::jesDown;
     }
-
-    // Not initial run, smear must be calculated
-
-    // TODO: Check this is correct
-    // For now, just leave jets of too large/small pT, large rho, or large η
-    // untouched
-    const double rho{(is2016_ || is2016APV_) ? event.elePF2PATRhoIso[0]
-                             : event.fixedGridRhoFastjetAll};
-    if (event.jetPF2PATPtRaw[index] < 15 || event.jetPF2PATPtRaw[index] > 3000 || rho > ((is2016_||is2016APV_) ? 40.9 : 42.52) || std::abs(event.jetPF2PATEta[index]) > 4.7) {
-        returnJet.SetPxPyPzE(event.jetPF2PATPx[index],
-                             event.jetPF2PATPy[index],
-                             event.jetPF2PATPz[index],
-                             event.jetPF2PATE[index]);
-        return {returnJet, newSmearValue};
+    if (syst.varies(Systematic::Target::jer)) {
+        return syst.up ? Variation::jerUp : Variation::jerDown;
     }
+    return Variation::nominal;
+}
 
-    // TODO: Should this be gen or reco level?
-    // I think reco because gen might not exist? (does not exist when
-    // smearing)
-    const double ptRes{(is2016_ || is2016APV_) ? jet2016PtSimRes(event.jetPF2PATPtRaw[index], event.jetPF2PATEta[index], rho)
-                               : jet2017PtSimRes(event.jetPF2PATPtRaw[index], event.jetPF2PATEta[index], rho)};
-
-    auto [jerSF, jerSigma] = (is2016_ || is2016APV_) ? jet2016SFs(std::abs(event.jetPF2PATEta[index])) : jet2017SFs(std::abs(event.jetPF2PATEta[index]));
-
-    if (syst == 16) jerSF += jerSigma;
-    else if (syst == 32) jerSF -= jerSigma;
-
-    std::optional<size_t> matchingGenIndex{std::nullopt};
-    for (size_t genIndex{0}; genIndex < event.NJETSMAX; ++genIndex) {
-        const double dR{deltaR(event.genJetPF2PATEta[genIndex], event.genJetPF2PATPhi[genIndex], event.jetPF2PATEta[index], event.jetPF2PATPhi[index])};
-        const double dPt{event.jetPF2PATPtRaw[index] - event.genJetPF2PATPT[genIndex]};
-
-        if (event.genJetPF2PATPT[genIndex] > 0 && dR < (0.4 / 2.0) && std::abs(dPt) < 3.0 * ptRes * event.jetPF2PATPtRaw[index]) {
-            matchingGenIndex = genIndex;
-            break;
+void Cuts::initialiseJetSFs() {
+    // 2018 has no files of its own yet, so uses 2017's
+    const bool is2016{is2016_ || is2016APV_};
+    const std::string jerDir{is2016 ? "scaleFactors/2016/Summer16_25nsV1_MC_" : "scaleFactors/2017/Fall17_V3_MC_"};
+    jetResolutions_ = BinnedFormula::fromJRDatabase(jerDir + "PtResolution_AK4PFchs.txt");
+    jerSFs_ = BinnedFormula::fromJRDatabase(jerDir + "SF_AK4PFchs.txt");
+
+    // Medium working point; the light jet SFs come from the inclusive
+    // measurement
+    const std::string bTagFile{is2016 ? "scaleFactors/2016/CSVv2.csv" : "scaleFactors/2017/CSVv2_94XSF_V2_B_F.csv"};
+    const std::array<std::string, 3> sysTypes{"down", "central", "up"};
+    for (size_t flavour{0}; flavour < bTagSFs_.size(); flavour++) {
+        for (size_t type{0}; type < sysTypes.size(); type++) {
+            bTagSFs_[flavour][type] = BinnedFormula::fromBTagCSV(bTagFile, 1, flavour == 2 ? "incl" : "mujets", sysTypes[type], static_cast<int>(flavour));
         }
     }
+}
 
-    if (matchingGenIndex.has_value()) { // If matching from GEN to RECO using dR<Rcone/2 and dPt < 3*sigma, just scale
-        const double dPt{event.jetPF2PATPtRaw[index] - event.genJetPF2PATPT[matchingGenIndex.value()]};
-        newSmearValue =
-            std::max(1. + (jerSF - 1.) * dPt / event.jetPF2PATPtRaw[index], 0.);
-    }
-    else { // If not matched to a gen jet, randomly smear
-        std::normal_distribution<> d(0, ptRes * std::sqrt(std::max(jerSF * jerSF - 1, 0.)));
-
-        // Like with the Rochester corrections, seed the random number
-        // generator with event (jet) properties so that each jet is smeared
-        // the same way every time it is processed
-        size_t seed{0};
-        boost::hash_combine(seed, event.jetPF2PATPtRaw[index]);
-        boost::hash_combine(seed, event.jetPF2PATEta[index]);
-        boost::hash_combine(seed, event.jetPF2PATPhi[index]);
-        boost::hash_combine(seed, event.eventNum);
-        std::mt19937 gen(seed);
+const JetCorrectionCache::jets& Cuts::correctedJets(const AnalysisEvent& event, const Systematic& syst) const {
+    using Variation = JetCorrectionCache::Variation;
+    static constexpr double MIN_JET_ENERGY{1e-2};
 
-        newSmearValue = 1.0 + d(gen);
+    JetCorrectionCache& cache{event.jetCorrections()};
+    const Variation variation{jetVariation(syst)};
+    if (cache.filled(variation)) {
+        return cache[variation];
     }
 
-    if (event.jetPF2PATE[index] * newSmearValue < MIN_JET_ENERGY) {
-    // Negative or too small scale factor
-        newSmearValue = MIN_JET_ENERGY / event.jetPF2PATE[index];
+    // The 2016 rho comes from the electron branches
+    event.loadCollection(AnalysisEvent::Collection::jets);
+    event.loadCollection(AnalysisEvent::Collection::electrons);
+    if (isMC_ && !cache.resolutionsFilled()) {
+        fillJetResolutions(event, cache);
     }
 
-    returnJet.SetPxPyPzE(event.jetPF2PATPx[index], event.jetPF2PATPy[index], event.jetPF2PATPz[index], event.jetPF2PATE[index]);
-    returnJet *= newSmearValue;
+    const bool jer{variation == Variation::jerUp || variation == Variation::jerDown};
+    const bool jes{variation == Variation::jesUp || variation == Variation::jesDown};
+    const bool up{variation == Variation::jerUp || variation == Variation::jesUp};
+    JetCorrectionCache::jets& corrected{cache.fill(variation)};
 
-    if (isMC_) {
-        double jerUncer{getJECUncertainty(returnJet.Pt(), returnJet.Eta(), syst)};
-        returnJet *= 1 + jerUncer;
-    }
+    for (int i{0}; i < event.numJetPF2PAT; i++) {
+        const FourVector rawJet{event.jetPF2PATPx[i], event.jetPF2PATPy[i], event.jetPF2PATPz[i], event.jetPF2PATE[i]};
+        if (!isMC_) {
+            corrected.selected[i] = rawJet;
+            corrected.rescaled[i] = rawJet;
+            corrected.smear[i] = 1.0;
+            continue;
+        }
 
-    return {returnJet, newSmearValue};
-}
+        // TODO: Check this is correct
+        // For now, just leave jets of too large/small pT, large rho, or large η
+        // unsmeared
+        const JetCorrectionCache::resolution& res{cache.resolutions()[i]};
+        double smear{1.0};
+        if (res.inRange) {
+            const double jerSF{jer ? (up ? res.jerSFUp : res.jerSFDown) : res.jerSF};
 
-double Cuts::jet2016PtSimRes(const double& pt, const double& eta, const double& rho) {
-    if (pt < 15 || pt > 3000) {
-        throw std::runtime_error("pT " + std::to_string(pt) + " out of range to assign resolution");
-    }
-
-    static constexpr std::array<double, 14> etaBinEdges{0, 0.5, 0.8, 1.1, 1.3, 1.7, 1.9, 2.1, 2.3, 2.5, 2.8, 3, 3.2, 4.7};
-    static constexpr std::array<double, 8> rhoBinEdges{0, 6.69, 12.39, 18.09, 23.79, 29.49, 35.19, 40.9};
-    const auto res = [pt](const double p0, const double p1, const double p2, const double p3) {
-        return (sqrt(p0 * abs(p0) / (pt * pt) + p1 * p1 * pow(pt, p3) + p2 * p2));
-    };
-    const auto etaBin{std::distance(etaBinEdges.begin(), std::upper_bound(etaBinEdges.begin(), etaBinEdges.end(), std::abs(eta)))};
-    const auto rhoBin{std::distance(rhoBinEdges.begin(), std::upper_bound(rhoBinEdges.begin(), rhoBinEdges.end(), rho))};
-
-    // https://github.com/cms-jet/JRDatabase/blob/master/textFiles/Summer16_25nsV1_MC/Summer16_25nsV1_MC_PtResolution_AK4PFchs.txt
-    switch (etaBin) {
-        case 1:
-            switch (rhoBin) {
-                case 1: return res(0.6172, 0.3908, 0.02003, -0.6407);
-                case 2: return res(1.775, 0.4231, 0.02199, -0.6701);
-                case 3: return res(2.457, 0.4626, 0.02416, -0.7045);
-                case 4: return res(2.996, 0.5242, 0.02689, -0.7508);
-                case 5: return res(3.623, 0.5591, 0.0288, -0.7747);
-                case 6: return res(4.167, 0.6365, 0.03045, -0.8179);
-                case 7: return res(4.795, 0.6819, 0.03145, -0.8408);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 2:
-            switch (rhoBin) {
-                case 1: return res(1.003, 0.4142, 0.02486, -0.6698);
-                case 2: return res(2.134, 0.3971, 0.02264, -0.6469);
-                case 3: return res(2.66, 0.4566, 0.02755, -0.7058);
-                case 4: return res(3.264, 0.4799, 0.02702, -0.7156);
-                case 5: return res(3.877, 0.5249, 0.02923, -0.7479);
-                case 6: return res(4.441, 0.581, 0.03045, -0.7804);
-                case 7: return res(4.742, 0.8003, 0.03613, -0.9062);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 3:
-            switch (rhoBin) {
-                case 1: return res(1.423, 0.4736, 0.03233, -0.7093);
-                case 2: return res(2.249, 0.5041, 0.03355, -0.7316);
-                case 3: return res(2.961, 0.4889, 0.03129, -0.7091);
-                case 4: return res(3.4, 0.5757, 0.03541, -0.7742);
-                case 5: return res(3.884, 0.6457, 0.03731, -0.8146);
-                case 6: return res(4.433, 0.7524, 0.03962, -0.8672);
-                case 7: return res(4.681, 0.9075, 0.04182, -0.9304);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 4:
-            switch (rhoBin) {
-                case 1: return res(-0.7275, 0.8099, 0.04885, -0.9097);
-                case 2: return res(1.829, 0.8156, 0.04991, -0.9145);
-                case 3: return res(2.72, 0.8454, 0.05036, -0.9215);
-                case 4: return res(3.07, 0.9201, 0.05067, -0.9439);
-                case 5: return res(3.991, 0.8715, 0.05041, -0.9151);
-                case 6: return res(4.001, 1.14, 0.05214, -0.9987);
-                case 7: return res(4.522, 1.22, 0.05122, -1);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 5:
-            switch (rhoBin) {
-                case 1: return res(-1.692, 1.192, 0.05049, -1.06);
-                case 2: return res(-1.804, 1.48, 0.05315, -1.145);
-                case 3: return res(1.673, 1.402, 0.0536, -1.116);
-                case 4: return res(2.906, 1.305, 0.05377, -1.076);
-                case 5: return res(2.766, 1.613, 0.05511, -1.137);
-                case 6: return res(3.409, 1.746, 0.05585, -1.143);
-                case 7: return res(3.086, 2.034, 0.05795, -1.181);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 6:
-            switch (rhoBin) {
-                case 1: return res(-0.8823, 1.092, 0.03599, -1.062);
-                case 2: return res(2.193, 0.9891, 0.03382, -1.012);
-                case 3: return res(2.9, 1.043, 0.03477, -1.019);
-                case 4: return res(2.371, 1.488, -0.04053, -1.145);
-                case 5: return res(3.75, 1.458, 0.04346, -1.122);
-                case 6: return res(3.722, 1.808, 0.04668, -1.177);
-                case 7: return res(4.836, 1.47, 0.03875, -1.047);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 7:
-            switch (rhoBin) {
-                case 1: return res(1.184, 0.8944, 0.03233, -1.005);
-                case 2: return res(1.691, 1.124, 0.03736, -1.094);
-                case 3: return res(2.837, 1.077, 0.03437, -1.046);
-                case 4: return res(2.459, 1.589, -0.04007, -1.18);
-                case 5: return res(4.058, 1.369, -0.03922, -1.087);
-                case 6: return res(4.231, 1.679, 0.0432, -1.13);
-                case 7: return res(2.635, 2.648, 0.04929, -1.28);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 8:
-            switch (rhoBin) {
-                case 1: return res(0.3022, 1.127, 0.03826, -1.134);
-                case 2: return res(2.161, 1.217, 0.03826, -1.142);
-                case 3: return res(3.218, 1.21, 0.03662, -1.112);
-                case 4: return res(3.328, 1.638, 0.04398, -1.216);
-                case 5: return res(5.506, 1.173, 0.04403, -1.054);
-                case 6: return res(-2.444, 3.613, 0.05639, -1.437);
-                case 7: return res(2.217, 3.133, 0.05032, -1.338);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 9:
-            switch (rhoBin) {
-                case 1: return res(3.125, 0.6026, 0.02576, -0.8702);
-                case 2: return res(3.935, 0.6533, 0.02587, -0.889);
-                case 3: return res(4.198, 1.024, 0.03618, -1.069);
-                case 4: return res(2.948, 2.386, 0.04771, -1.382);
-                case 5: return res(4.415, 2.086, 0.04704, -1.294);
-                case 6: return res(-3.084, 4.156, 0.05366, -1.503);
-                case 7: return res(-6.144, 5.969, 0.05633, -1.602);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 10:
-            switch (rhoBin) {
-                case 1: return res(4.244, 0.2766, -1.86e-08, -0.5068);
-                case 2: return res(4.919, 0.3193, 5.463e-06, -0.58);
-                case 3: return res(5.909, 0.2752, 4.144e-06, -0.5272);
-                case 4: return res(-47.31, 47.18, 0.05853, -1.991);
-                case 5: return res(-46.49, 46.33, 0.05698, -1.989);
-                case 6: return res(8.651, 0.2522, 6.592e-06, -0.4835);
-                case 7: return res(7.716, 2.481, 0.0531, -1.455);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        case 11:
-            switch (rhoBin) {
-                case 1: return res(4.467, 0.1997, -3.491e-06, -0.2623);
-                case 2: return res(4.17, 0.928, 0.07702, -1.063);
-                case 3: return res(-0.04491, 3.67, 0.08704, -1.641);
-                case 4: return res(5.528, 1.286, 0.07962, -1.187);
-                case 5: return res(-78.36, 78.23, 0.08448, -1.996);
-                case 6: return res(7.559, 1.147, 0.07023, -1.134);
-                case 7: return res(-59.03, 59.03, -0.08184, -1.992);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
+            if (res.genMatched) { // If matching from GEN to RECO using dR<Rcone/2 and dPt < 3*sigma, just scale
+                smear = std::max(1. + (jerSF - 1.) * res.genDPt / event.jetPF2PATPtRaw[i], 0.);
             }
-        case 12:
-            switch (rhoBin) {
-                case 1: return res(0.0002851, 3.01, 0.1382, -1.702);
-                case 2: return res(-33.01, 33.04, 0.1343, -1.991);
-                case 3: return res(-67.94, 67.8, 0.1342, -1.996);
-                case 4: return res(-47.81, 48, 0.1391, -1.996);
-                case 5: return res(7.162, 0.9211, 0.1395, -1.209);
-                case 6: return res(8.193, 0.1995, 2.822e-05, -0.132);
-                case 7: return res(8.133, 0.9983, 0.1349, -1.181);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
+            else { // If not matched to a gen jet, randomly smear
+                smear = 1.0 + res.gaus * (res.ptRes * std::sqrt(std::max(jerSF * jerSF - 1, 0.)));
             }
-        case 13:
-            switch (rhoBin) {
-                case 1: return res(2.511, 0.3167, 0.09085, -0.7407);
-                case 2: return res(3.297, 0.2091, 6.258e-05, -0.2755);
-                case 3: return res(1.85, 2.281, 0.1042, -1.635);
-                case 4: return res(3.869, 1.001, 0.09955, -1.266);
-                case 5: return res(-23.98, 24.11, 0.1057, -1.988);
-                case 6: return res(5.403, 0.2371, 1.5e-05, -0.3177);
-                case 7: return res(5.753, 0.2337, 0.0002982, -0.3108);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + "out of range");
-            }
-        default: throw std::runtime_error("Eta " + std::to_string(eta) + " out of range");
-    }
-}
 
-double Cuts::jet2017PtSimRes(const double& pt, const double& eta, const double& rho) {
-    if (pt < 15 || pt > 3000) {
-        throw std::runtime_error("pT " + std::to_string(pt) + " out of range to assign resolution");
-    }
-
-    static constexpr std::array<double, 14> etaBinEdges{0, 0.5, 0.8, 1.1, 1.3, 1.7, 1.9, 2.1, 2.3, 2.5, 2.8, 3, 3.2, 4.7};
-    static constexpr std::array<double, 8> rhoBinEdges{0, 6.37, 12.4, 18.42, 24.45, 30.47, 36.49, 42.52};
-    const auto res = [pt](const double p0, const double p1, const double p2, const double p3) {
-        return (std::sqrt(p0 * std::abs(p0) / (pt * pt) + p1 * p1 * std::pow(pt, p3) + p2 * p2));
-    };
-    const auto etaBin{std::distance(etaBinEdges.begin(), std::upper_bound(etaBinEdges.begin(), etaBinEdges.end(), std::abs(eta)))};
-    const auto rhoBin{std::distance(rhoBinEdges.begin(), std::upper_bound(rhoBinEdges.begin(), rhoBinEdges.end(), rho))};
-
-    // https://github.com/cms-jet/JRDatabase/blob/master/textFiles/Fall17_V3_MC/Fall17_V3_MC_PtResolution_AK4PFchs.txt
-    switch (etaBin) {
-        case 1:
-            switch (rhoBin) {
-                case 1: return res(-1.515, 0.5971, 0.03046, -0.7901);
-                case 2: return res(-0.7966, 0.6589, 0.03119, -0.8237);
-                case 3: return res(1.387, 0.6885, 0.03145, -0.8378);
-                case 4: return res(2.151, 0.7185, 0.03168, -0.8502);
-                case 5: return res(2.73, 0.7361, 0.03184, -0.8548);
-                case 6: return res(3.603, 0.7318, 0.03227, -0.855);
-                case 7: return res(3.897, 0.7882, 0.03282, -0.8746);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 2:
-            switch (rhoBin) {
-                case 1: return res(-0.9395, 0.4556, 0.02738, -0.6909);
-                case 2: return res(1.339, 0.4621, 0.02785, -0.6965);
-                case 3: return res(1.597, 0.5254, 0.02952, -0.7407);
-                case 4: return res(2.527, 0.5042, 0.02842, -0.723);
-                case 5: return res(2.896, 0.5428, 0.03001, -0.7476);
-                case 6: return res(3.514, 0.5437, 0.03055, -0.7486);
-                case 7: return res(3.678, 0.6372, 0.03325, -0.8053);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 3:
-            switch (rhoBin) {
-                case 1: return res(-0.8118, 0.491, 0.03583, -0.7149);
-                case 2: return res(1.289, 0.49, 0.03539, -0.7073);
-                case 3: return res(1.953, 0.5161, 0.03658, -0.7295);
-                case 4: return res(2.347, 0.5396, 0.03576, -0.7339);
-                case 5: return res(2.794, 0.5687, 0.03825, -0.7602);
-                case 6: return res(2.796, 0.7203, 0.04074, -0.8431);
-                case 7: return res(3.788, 0.6287, 0.04156, -0.7959);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 4:
-            switch (rhoBin) {
-                case 1: return res(0.6707, 0.5839, 0.04697, -0.752);
-                case 2: return res(1.395, 0.6702, 0.0496, -0.8152);
-                case 3: return res(2.43, 0.5712, 0.04572, -0.7345);
-                case 4: return res(2.439, 0.6623, 0.04496, -0.7771);
-                case 5: return res(3.353, 0.5924, 0.04617, -0.7384);
-                case 6: return res(3.465, 0.7579, 0.05328, -0.8435);
-                case 7: return res(1.982, 1.148, 0.05664, -0.9626);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 5:
-            switch (rhoBin) {
-                case 1: return res(-1.469, 0.9562, 0.05101, -0.955);
-                case 2: return res(-1.377, 1.078, 0.05427, -1.003);
-                case 3: return res(1.501, 1.072, 0.05498, -1.001);
-                case 4: return res(1.53, 1.158, 0.05396, -1.021);
-                case 5: return res(1.621, 1.358, 0.0578, -1.078);
-                case 6: return res(3.163, 1.131, 0.05725, -0.9809);
-                case 7: return res(2.818, 1.326, 0.05893, -0.9977);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 6:
-            switch (rhoBin) {
-                case 1: return res(1.227, 0.8407, -0.0232, -0.9284);
-                case 2: return res(-1.339, 1.218, -0.03479, -1.076);
-                case 3: return res(-2.011, 1.435, -0.03565, -1.124);
-                case 4: return res(3.324, 0.8102, -0.02662, -0.8923);
-                case 5: return res(2.188, 1.365, -0.0375, -1.088);
-                case 6: return res(2.884, 1.306, 0.03685, -1.038);
-                case 7: return res(4.03, 1.141, 0.03059, -0.9262);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 7:
-            switch (rhoBin) {
-                case 1: return res(-1.979, 1.193, -0.03497, -1.109);
-                case 2: return res(-2.528, 1.44, -0.03273, -1.143);
-                case 3: return res(1.95, 1.118, -0.03202, -1.054);
-                case 4: return res(2.377, 1.166, -0.03593, -1.061);
-                case 5: return res(3.122, 1.107, -0.0292, -1.005);
-                case 6: return res(-1.899, 1.944, 0.03736, -1.185);
-                case 7: return res(4.168, 1.452, 0.03836, -1.019);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 8:
-            switch (rhoBin) {
-                case 1: return res(1.947, 0.9639, -0.02799, -1.024);
-                case 2: return res(2.643, 0.9054, -0.02701, -0.9753);
-                case 3: return res(-3.209, 2.521, -0.04442, -1.385);
-                case 4: return res(-5.368, 3.81, -0.04587, -1.525);
-                case 5: return res(-2.344, 2.207, 0.03446, -1.265);
-                case 6: return res(-11.01, 8.354, 0.05639, -1.706);
-                case 7: return res(6.282, 1.064, 8.482e-06, -0.8687);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 9:
-            switch (rhoBin) {
-                case 1: return res(3.639, 0.6502, -0.01427, -0.8624);
-                case 2: return res(2.391, 1.635, -0.0378, -1.251);
-                case 3: return res(3.431, 1.985, 0.04609, -1.359);
-                case 4: return res(5.095, 0.8757, -0.02736, -0.9761);
-                case 5: return res(5.034, 1.479, -0.03479, -1.175);
-                case 6: return res(6.694, 1.325, 0.03374, -1.101);
-                case 7: return res(7.444, 1.137, 4.258e-05, -0.9531);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 10:
-            switch (rhoBin) {
-                case 1: return res(6.114, 0.2385, 1.741e-05, -0.5054);
-                case 2: return res(6.931, 0.1964, 7.465e-06, -0.4335);
-                case 3: return res(7.858, 0.2435, 6.026e-07, -0.5235);
-                case 4: return res(8.713, 0.1314, 8.441e-06, -0.3028);
-                case 5: return res(9.413, 0.2792, 1.217e-06, -0.5729);
-                case 6: return res(10.51, 0.1659, 1.277e-06, -0.4276);
-                case 7: return res(11.77, 8.547e-07, 0.05169, -1.197);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 11:
-            switch (rhoBin) {
-                case 1: return res(6.048, 0.1992, -3.559e-06, -0.2953);
-                case 2: return res(6.867, 0.2036, 1.946e-05, -0.3068);
-                case 3: return res(8.198, 0.0001314, 0.08772, -1.252);
-                case 4: return res(8.756, 0.134, -0.07197, -0.2968);
-                case 5: return res(9.615, 0.0001533, -0.08793, -1.445);
-                case 6: return res(10.01, 0.1524, 3.815e-05, -0.2422);
-                case 7: return res(10.05, 0.1932, 0.0001734, -0.2739);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        case 12:
-            switch (rhoBin) {
-                case 1: return res(-35.12, 35.21, 0.1466, -1.993);
-                case 2: return res(6.573, 0.2026, 6.573e-05, -0.1564);
-                case 3: return res(0.004144, 6.019, 0.1549, -1.854);
-                case 4: return res(8.341, 0.0001012, 0.1526, -1.689);
-                case 5: return res(9.115, 0.0002242, 0.1518, -1.362);
-                case 6: return res(9.86, -2.112e-05, 0.1438, -1.114);
-                case 7: return res(10.45, 0.0001536, 0.1398, -1.271);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
+            if (event.jetPF2PATE[i] * smear < MIN_JET_ENERGY) {
+                // Negative or too small scale factor
+                smear = MIN_JET_ENERGY / event.jetPF2PATE[i];
             }
-        case 13:
-            switch (rhoBin) {
-                case 1: return res(-29.87, 29.84, 0.1045, -1.995);
-                case 2: return res(-23.2, 23.09, 0.1051, -1.987);
-                case 3: return res(4.337, 0.2253, 0.06986, -0.4215);
-                case 4: return res(4.088, 2.746, 0.1136, -1.959);
-                case 5: return res(5.624, 0.1291, 0.002663, -0.04825);
-                case 6: return res(6.152, 6.125e-05, 0.1128, -1.319);
-                case 7: return res(6.235, 0.1408, 0.0001266, -0.08163);
-                default: throw std::runtime_error("Rho " + std::to_string(rho) + " out of range");
-            }
-        default: throw std::runtime_error("Eta " + std::to_string(eta) + " out of range");
+        }
+
+        const FourVector smearedJet{rawJet * smear};
+        const double jecUncer{jes ? getJECUncertainty(smearedJet.Pt(), smearedJet.Eta(), up) : 0.};
+        corrected.rescaled[i] = smearedJet * (1 + jecUncer);
+        // The jet selection has always taken out of range jets as they are
+        corrected.selected[i] = res.inRange ? corrected.rescaled[i] : rawJet;
+        corrected.smear[i] = smear;
     }
+
+    return corrected;
 }
 
-std::pair<double, double> Cuts::jet2016SFs(const double& eta) {
-    // https://twiki.cern.ch/twiki/bin/viewauth/CMS/JetResolution#JER_Uncertainty
-    constexpr std::array<double, 14> etaBinEdges{0, 0.522, 0.783, 1.131, 1.305, 1.740, 1.930, 2.043, 2.322, 2.5, 2.853, 2.964, 3.319, 5.191};
-
-    switch (std::distance(etaBinEdges.begin(), std::upper_bound(etaBinEdges.begin(), etaBinEdges.end(), eta))) {
-        case 1: return {1.1685, 0.0645};
-        case 2: return {1.1948, 0.0652};
-        case 3: return {1.1464, 0.0632};
-        case 4: return {1.1609, 0.1025};
-        case 5: return {1.1278, 0.0986};
-        case 6: return {1.1000, 0.1079};
-        case 7: return {1.1426, 0.1214};
-        case 8: return {1.1512, 0.1440};
-        case 9: return {1.2963, 0.2371};
-        case 10: return {1.3418, 0.2091};
-        case 11: return {1.7788, 0.2008};
-        case 12: return {1.1869, 0.1243};
-        case 13: return {1.1922, 0.1448};
-        default: throw std::runtime_error("Eta " + std::to_string(eta) + " out of range");
+void Cuts::fillJetResolutions(const AnalysisEvent& event, JetCorrectionCache& cache) const {
+    std::array<JetCorrectionCache::resolution, JetCorrectionCache::MAXJETS>& resolutions{cache.fillResolutions()};
+    const double rho{(is2016_ || is2016APV_) ? event.elePF2PATRhoIso[0]
+                             : event.fixedGridRhoFastjetAll};
+
+    // Resolutions of all the jets in range in one go
+    std::array<int, JetCorrectionCache::MAXJETS> inRange;
+    std::array<double, JetCorrectionCache::MAXJETS> etas;
+    std::array<double, JetCorrectionCache::MAXJETS> rhos;
+    std::array<double, JetCorrectionCache::MAXJETS> ptRaws;
+    std::array<double, JetCorrectionCache::MAXJETS> ptRes;
+    size_t numInRange{0};
+    for (int i{0}; i < event.numJetPF2PAT; i++) {
+        JetCorrectionCache::resolution& res{resolutions[i]};
+        const double ptRaw{event.jetPF2PATPtRaw[i]};
+        res.inRange = !(ptRaw < 15 || ptRaw > 3000 || rho > ((is2016_||is2016APV_) ? 40.9 : 42.52) || std::abs(event.jetPF2PATEta[i]) > 4.7);
+        if (res.inRange) {
+            inRange[numInRange] = i;
+            etas[numInRange] = event.jetPF2PATEta[i];
+            rhos[numInRange] = rho;
+            ptRaws[numInRange] = ptRaw;
+            numInRange++;
+        }
     }
-}
+    // TODO: Should this be gen or reco level?
+    // I think reco because gen might not exist? (does not exist when
+    // smearing)
+    const double* const resVars[]{etas.data(), rhos.data()};
+    jetResolutions_.evaluate(resVars, ptRaws.data(), numInRange, ptRes.data());
+
+    for (size_t j{0}; j < numInRange; j++) {
+        const int i{inRange[j]};
+        JetCorrectionCache::resolution& res{resolutions[i]};
+        const double ptRaw{ptRaws[j]};
+        res.ptRes = ptRes[j];
+        // Nominal, down and up
+        const double* sfs{jerSFs_.parameters(jerSFs_.bin(&etas[j]))};
+        res.jerSF = sfs[0];
+        res.jerSFDown = sfs[1];
+        res.jerSFUp = sfs[2];
+
+        // The gen jet branches run parallel to the reco jets, so only the
+        // first numJetPF2PAT entries belong to this event
+        res.genMatched = false;
+        for (int genIndex{0}; genIndex < event.numJetPF2PAT; ++genIndex) {
+            const double dR{deltaR(event.genJetPF2PATEta[genIndex], event.genJetPF2PATPhi[genIndex], event.jetPF2PATEta[i], event.jetPF2PATPhi[i])};
+            const double dPt{ptRaw - event.genJetPF2PATPT[genIndex]};
+
+            if (event.genJetPF2PATPT[genIndex] > 0 && dR < (0.4 / 2.0) && std::abs(dPt) < 3.0 * res.ptRes * ptRaw) {
+                res.genMatched = true;
+                res.genDPt = dPt;
+                break;
+            }
+        }
 
-std::pair<double, double> Cuts::jet2017SFs(const double& eta)
-{
-    // https://twiki.cern.ch/twiki/bin/viewauth/CMS/JetResolution#JER_Uncertainty
-    constexpr std::array<double, 14> etaBinEdges{0, 0.522, 0.783, 1.131, 1.305, 1.740, 1.930, 2.043, 2.322, 2.5, 2.853, 2.964, 3.319, 5.191};
-
-    switch (std::distance(etaBinEdges.begin(), std::upper_bound(etaBinEdges.begin(), etaBinEdges.end(), eta))) {
-        case 1: return {1.1432, 0.0222};
-        case 2: return {1.1815, 0.0484};
-        case 3: return {1.0989, 0.0456};
-        case 4: return {1.1137, 0.1397};
-        case 5: return {1.1307, 0.147};
-        case 6: return {1.16, 0.0976};
-        case 7: return {1.2393, 0.1909};
-        case 8: return {1.2604, 0.1501};
-        case 9: return {1.4085, 0.2020};
-        case 10: return {1.9909, 0.5684};
-        case 11: return {2.2923, 0.3743};
-        case 12: return {1.2696, 0.1089};
-        case 13: return {1.1542, 0.1524};
-        default: throw std::runtime_error("Eta " + std::to_string(eta) + " out of range");
+        if (!res.genMatched) {
+            // Like with the Rochester corrections, seed the random number
+            // generator with event (jet) properties so that each jet is smeared
+            // the same way every time it is processed. The draw is scaled by
+            // the width for each JER variation.
+            size_t seed{0};
+            boost::hash_combine(seed, event.jetPF2PATPtRaw[i]);
+            boost::hash_combine(seed, event.jetPF2PATEta[i]);
+            boost::hash_combine(seed, event.jetPF2PATPhi[i]);
+            boost::hash_combine(seed, event.eventNum);
+            std::mt19937 gen(seed);
+            res.gaus = std::normal_distribution<>{}(gen);
+        }
     }
 }
 
-void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, const int& index, double& mcTag, double& mcNoTag, double& dataTag, double& dataNoTag, double& err1, double& err2, double& err3, double& err4) const {
+void Cuts::getBWeight(const AnalysisEvent& event, const FourVector& jet, const int& index, const int effBin, double& mcTag, double& mcNoTag, double& dataTag, double& dataNoTag, double& err1, double& err2, double& err3, double& err4) const {
     // Use b-tagging efficiencies and scale factors.
     // Firstly get efficiency for pt/eta bin here.
     double eff{1.};
@@ -2053,20 +1691,16 @@ void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, con
     if (partonFlavour == 0)
         return;
     if (partonFlavour == 5) {
-        eff = bTagEffPlots_[4]->GetBinContent( bTagEffPlots_[4]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[4]->GetYaxis()->FindBin(std::abs(jet.Eta())) ) 
-            / bTagEffPlots_[0]->GetBinContent( bTagEffPlots_[0]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[0]->GetYaxis()->FindBin(std::abs(jet.Eta())) );
+        eff = bTagEffs_[0][effBin].nominal;
     }
-    if (partonFlavour == 4)
-   {    eff = bTagEffPlots_[5]->GetBinContent( bTagEffPlots_[5]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[5]->GetYaxis()->FindBin(std::abs(jet.Eta())) )
-            / bTagEffPlots_[1]->GetBinContent( bTagEffPlots_[1]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[1]->GetYaxis()->FindBin(std::abs(jet.Eta())) );
+    if (partonFlavour == 4) {
+        eff = bTagEffs_[1][effBin].nominal;
     }
     if (partonFlavour < 4) {
-        eff = bTagEffPlots_[6]->GetBinContent( bTagEffPlots_[6]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[6]->GetYaxis()->FindBin(std::abs(jet.Eta())) )
-            / bTagEffPlots_[2]->GetBinContent( bTagEffPlots_[2]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[2]->GetYaxis()->FindBin(std::abs(jet.Eta())) );
+        eff = bTagEffs_[2][effBin].nominal;
     }
     if (partonFlavour == 21) {
-        eff = bTagEffPlots_[7]->GetBinContent( bTagEffPlots_[7]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[7]->GetYaxis()->FindBin(std::abs(jet.Eta())) )
-            / bTagEffPlots_[3]->GetBinContent( bTagEffPlots_[3]->GetXaxis()->FindBin(jet.Pt()), bTagEffPlots_[3]->GetYaxis()->FindBin(std::abs(jet.Eta())) );
+        eff = bTagEffs_[3][effBin].nominal;
     }
 
     if (std::isnan(eff)) {
@@ -2092,9 +1726,9 @@ void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, con
             jetPt = maxBjetPt;
             doubleUncertainty = true;
         }
-        jet_scalefactor = getBSF(0, 0, jetPt);
-        jet_scalefactor_up = getBSF(0, 1, jetPt);
-        jet_scalefactor_do = getBSF(0, -1, jetPt);
+        jet_scalefactor = getBSF(0, 0, jetPt, jet.Eta());
+        jet_scalefactor_up = getBSF(0, 1, jetPt, jet.Eta());
+        jet_scalefactor_do = getBSF(0, -1, jetPt, jet.Eta());
     }
 
     else if (partonFlavour == 4) {
@@ -2102,9 +1736,9 @@ void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, con
             jetPt = maxBjetPt;
             doubleUncertainty = true;
         }
-        jet_scalefactor = getBSF(1, 0, jetPt);
-        jet_scalefactor_up = getBSF(1, 1, jetPt);
-        jet_scalefactor_do = getBSF(1, -1, jetPt);
+        jet_scalefactor = getBSF(1, 0, jetPt, jet.Eta());
+        jet_scalefactor_up = getBSF(1, 1, jetPt, jet.Eta());
+        jet_scalefactor_do = getBSF(1, -1, jetPt, jet.Eta());
     }
 
     // Light jets
@@ -2113,9 +1747,9 @@ void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, con
             jetPt = maxLjetPt;
             doubleUncertainty = true;
         }
-        jet_scalefactor = getBSF(2, 0, jetPt);
-        jet_scalefactor_up = getBSF(2, 1, jetPt);
-        jet_scalefactor_do = getBSF(2, -1, jetPt);
+        jet_scalefactor = getBSF(2, 0, jetPt, jet.Eta());
+        jet_scalefactor_up = getBSF(2, 1, jetPt, jet.Eta());
+        jet_scalefactor_do = getBSF(2, -1, jetPt, jet.Eta());
     }
 
     if (doubleUncertainty) {
@@ -2150,136 +1784,7 @@ void Cuts::getBWeight(const AnalysisEvent& event, const TLorentzVector& jet, con
     }
 }
 
-// Backup temporary method to do Btag Scale Factors whilst debugging is ongoing. TODO: F1X TH1S
-
-double Cuts::getBSF(const int flavour, const int type, const double pt) const {
- if (!is2016_) { // is 2017
-        // https://twiki.cern.ch/twiki/bin/viewauth/CMS/BtagRecommendation94X
-        // MEDIUM
-
-        static constexpr std::array<double, 10> ptBinEdges{20, 30, 50, 70, 100, 140, 200, 300, 600, 1000};
-        const auto ptBin{std::distance(ptBinEdges.begin(), std::upper_bound(ptBinEdges.begin(), ptBinEdges.end(), pt))};
-        const auto mujets_sf = [pt, type](const double p0) {return (0.941966 * ((1 + 0.24108 * pt) / (1 + 0.248776 * pt))) + type * p0;
-        };
-        const auto incl_sf = [pt, type]() {return (0.949449 + 0.000516201 * pt + 7.13398e-08 * pt * pt + -3.55644e-10 * pt * pt * pt) * (1 + type * 0.082197);
-        };
-
-        switch (flavour) {
-            case 0: // B flavour
-                if (type == 0) {
-                    return mujets_sf(0);
-                }
-                else if (std::abs(type) == 1) {
-                    switch (ptBin) {
-                        case 1: return mujets_sf(0.051529459655284882);
-                        case 2: return mujets_sf(0.017671864479780197);
-                        case 3: return mujets_sf(0.022306634113192558);
-                        case 4: return mujets_sf(0.023042259737849236);
-                        case 5: return mujets_sf(0.039661582559347153);
-                        case 6: return mujets_sf(0.061514820903539658);
-                        case 7: return mujets_sf(0.071018315851688385);
-                        case 8: return mujets_sf(0.054169680923223495);
-                        case 9: return mujets_sf(0.063008971512317657);
-                        default: throw std::runtime_error("pT out of range of b tag SFs");
-                    }
-                }
-                else {
-                    throw std::runtime_error("Unknown b tag systematic type");
-                }
-            case 1: // C flavour
-                if (type == 0) {
-                    return mujets_sf(0);
-                }
-                else if (std::abs(type) == 1) {
-                    switch (ptBin) {
-                        case 1: return mujets_sf(0.15458837151527405);
-                        case 2: return mujets_sf(0.053015593439340591);
-                        case 3: return mujets_sf(0.066919900476932526);
-                        case 4: return mujets_sf(0.069126777350902557);
-                        case 5: return mujets_sf(0.11898474395275116);
-                        case 6: return mujets_sf(0.18454445898532867);
-                        case 7: return mujets_sf(0.21305495500564575);
-                        case 8: return mujets_sf(0.16250903904438019);
-                        case 9: return mujets_sf(0.18902692198753357);
-                        default: throw std::runtime_error("pT out of range of b tag SFs");
-                    }
-                }
-                else {
-                    throw std::runtime_error("Unknown b tag systematic type");
-                }
-            case 2: // UDSG flavour
-                if (std::abs(type) <= 1) {
-                    return incl_sf();
-                }
-                else {
-                    throw std::runtime_error("Unknown b tag systematic type");
-                }
-            default:
-                throw std::runtime_error("Unknown b tag systematic flavour");
-        }
-    }
-    else { // is 2016
-
-        double sf{1.0};
-        const double& x{pt};
-
-        // MEDIUM
-        if (flavour == 0) { // B flavour
-            if (type == 0) sf = 0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)));
-            if (type == 1) {
-                if (pt < 30.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.040554910898208618;
-                if (pt < 50.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.01836167648434639;
-                if (pt < 70.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.016199169680476189;
-                if (pt < 100.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.014634267427027225;
-                if (pt < 140.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.014198922552168369;
-                if (pt < 200.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.016547618433833122;
-                if (pt < 300.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.02140621654689312;
-                if (pt < 600.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.023563217371702194;
-                else sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.034716218709945679;
-            }
-            if (type == -1) {
-                if (pt < 30.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.040554910898208618;
-                if (pt < 50.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.01836167648434639;
-                if (pt < 70.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.016199169680476189;
-                if (pt < 100.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.014634267427027225;
-                if (pt < 140.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.014198922552168369;
-                if (pt < 200.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.016547618433833122;
-                if (pt < 300.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.02140621654689312;
-                if (pt < 600.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.023563217371702194;
-                else sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.034716218709945679;
-            }
-        }
-        if (flavour == 1) { // C flavour
-            if (type == 0) sf = 0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)));
-            if (type == 1) {
-                if (pt < 30.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.12166473269462585;
-                if (pt < 50.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.055085029453039169;
-                if (pt < 70.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.048597507178783417;
-                if (pt < 100.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.043902803212404251;
-                if (pt < 140.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.042596768587827682;
-                if (pt < 200.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.049642853438854218;
-                if (pt < 300.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.06421864777803421;
-                if (pt < 600.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.070689648389816284;
-                else sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) + 0.10414865612983704;
-            }
-            if (type == -1) {
-                if (pt < 30.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.12166473269462585;
-                if (pt < 50.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.055085029453039169;
-                if (pt < 70.0)  sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.048597507178783417;
-                if (pt < 100.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.043902803212404251;
-                if (pt < 140.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.042596768587827682;
-                if (pt < 200.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.049642853438854218;
-                if (pt < 300.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.06421864777803421;
-                if (pt < 600.0) sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.070689648389816284;
-                else sf = (0.718014 * ((1. + (0.0685826 * x)) / (1. + (0.0475779 * x)))) - 0.10414865612983704;
-            }
-        }
-        if (flavour == 2) { // UDSG flavour
-            if (type == 0)  sf =  1.0589 + 0.000382569 * x + -2.4252e-07 * x * x + 2.20966e-10 * x * x * x;
-            if (type == 1)  sf = (1.0589 + 0.000382569 * x + -2.4252e-07 * x * x + 2.20966e-10 * x * x * x) * (1 + (0.100485 + 3.95509e-05 * x + -4.90326e-08 * x * x));
-            if (type == -1) sf = (1.0589 + 0.000382569 * x + -2.4252e-07 * x * x + 2.20966e-10 * x * x * x) * (1 - (0.100485 + 3.95509e-05 * x + -4.90326e-08 * x * x));
-        }
-
-        return sf;
-    }
+double Cuts::getBSF(const int flavour, const int type, const double pt, const double eta) const {
+    const double vars[]{eta, pt};
+    return bTagSFs_[flavour][type + 1].evaluate(vars, pt);
 }
@@ -0,0 +1,98 @@
+#include "derivedQuantities.hpp"
+
+#include "AnalysisEvent.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+    const std::pair<FourVector, FourVector>& pairVectors(const AnalysisEvent& event, const DerivedQuantities::Pair pair) {
+        switch (pair) {
+            case DerivedQuantities::Pair::zPair: return event.zPairLeptons;
+            case DerivedQuantities::Pair::zPairRefit: return event.zPairLeptonsRefitted;
+            case DerivedQuantities::Pair::chsPair: return event.chsPairVec;
+            case DerivedQuantities::Pair::chsTrkPair: return event.chsPairTrkVec;
+            case DerivedQuantities::Pair::chsTrkPairRefit: return event.chsPairTrkVecRefitted;
+            case DerivedQuantities::Pair::numPairs:
+            default: throw std::logic_error("Unknown pair");
+        }
+    }
+
+    // The track pair branches of the muon or charged hadron vertex fits
+    struct vertexBranches
+    {
+        const Float_t* p2;
+        const Float_t* vx;
+        const Float_t* vy;
+        const Float_t* vz;
+        const Float_t* chi2;
+        const Float_t* ndof;
+        const Float_t* distMagXY;
+        const Float_t* distMagXYSigma;
+        const Float_t* distMagXYZ;
+        const Float_t* distMagXYZSigma;
+    };
+
+    vertexBranches branches(const AnalysisEvent& event, const DerivedQuantities::Vertex vertex) {
+        if (vertex == DerivedQuantities::Vertex::mumu) {
+            return {event.muonTkPairPF2PATTkVtxP2,
+                    event.muonTkPairPF2PATTkVx,
+                    event.muonTkPairPF2PATTkVy,
+                    event.muonTkPairPF2PATTkVz,
+                    event.muonTkPairPF2PATTkVtxChi2,
+                    event.muonTkPairPF2PATTkVtxNdof,
+                    event.muonTkPairPF2PATTkVtxDistMagXY,
+                    event.muonTkPairPF2PATTkVtxDistMagXYSigma,
+                    event.muonTkPairPF2PATTkVtxDistMagXYZ,
+                    event.muonTkPairPF2PATTkVtxDistMagXYZSigma};
+        }
+        return {event.chsTkPairTkVtxP2,
+                event.chsTkPairTkVx,
+                event.chsTkPairTkVy,
+                event.chsTkPairTkVz,
+                event.chsTkPairTkVtxChi2,
+                event.chsTkPairTkVtxNdof,
+                event.chsTkPairTkVtxDistMagXY,
+                event.chsTkPairTkVtxDistMagXYSigma,
+                event.chsTkPairTkVtxDistMagXYZ,
+                event.chsTkPairTkVtxDistMagXYZSigma};
+    }
+} // namespace
+
+const DerivedQuantities::pairKinematics& DerivedQuantities::pair(const AnalysisEvent& event, const Pair pair) {
+    const std::pair<FourVector, FourVector>& vectors{pairVectors(event, pair)};
+    pairEntry& entry{pairs_[static_cast<size_t>(pair)]};
+    if (!entry.valid || entry.generation != event.pairGeneration()) {
+        entry.generation = event.pairGeneration();
+        entry.value.sum = vectors.first + vectors.second;
+        entry.value.mass = entry.value.sum.M();
+        entry.value.pt = entry.value.sum.Pt();
+        entry.value.eta = entry.value.sum.Eta();
+        entry.value.phi = entry.value.sum.Phi();
+        entry.valid = true;
+    }
+    return entry.value;
+}
+
+const DerivedQuantities::vertexQuantities& DerivedQuantities::vertex(const AnalysisEvent& event, const Vertex vertex) {
+    const int index{vertex == Vertex::mumu ? event.mumuTrkIndex : event.chsPairTrkIndex};
+    vertexEntry& entry{vertices_[static_cast<size_t>(vertex)]};
+    if (!entry.valid || entry.index != index) {
+        // The same arithmetic, in the same precision, as the fill
+        // expressions had
+        const vertexBranches b{branches(event, vertex)};
+        const float vx{b.vx[index]};
+        const float vy{b.vy[index]};
+        const float vz{b.vz[index]};
+        entry.value.p = std::sqrt(b.p2[index]);
+        entry.value.vxy = std::sqrt(vx * vx + vy * vy);
+        entry.value.vabs = std::sqrt(vx * vx + vy * vy + vz * vz);
+        entry.value.chi2Ndof = static_cast<float>(b.chi2[index] / (b.ndof[index] + 1.0e-06));
+        entry.value.sigXY = static_cast<float>(b.distMagXY[index] / (b.distMagXYSigma[index] + 1.0e-06));
+        entry.value.sigXYZ = static_cast<float>(b.distMagXYZ[index] / (b.distMagXYZSigma[index] + 1.0e-06));
+        entry.index = index;
+        entry.valid = true;
+    }
+    return entry.value;
+}
@@ -0,0 +1,200 @@
+#include "AnalysisEvent.hpp"
+#include "TChain.h"
+#include "TH1D.h"
+#include "config_parser.hpp"
+#include "cutClass.hpp"
+#include "plots.hpp"
+#include "systematics.hpp"
+
+#include <boost/program_options.hpp>
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Times Plots::fillAllPlots over the events of an ntuple that pass the
+// nominal selection, against the fill path it replaced, where each
+// expression was a std::function returning a new vector, and filling
+// histogram buffers, exported to TH1Ds at the end, against filling the TH1Ds
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> inFiles;
+    std::string cutConf;
+    std::string plotConf;
+    std::string treeName;
+    long long nEvents{0};
+    unsigned repeats{0};
+    bool isData{false};
+    bool is2016{false};
+    bool is2016APV{false};
+    bool is2018{false};
+
+    namespace po = boost::program_options;
+    po::options_description desc("Options");
+    desc.add_options()("help,h", "Print this message.")(
+        "inFiles,i",
+        po::value<std::vector<std::string>>(&inFiles)->multitoken()->required(),
+        "Ntuples to read.")(
+        "cutConf",
+        po::value<std::string>(&cutConf)->required(),
+        "Cut configuration file.")(
+        "plotConf",
+        po::value<std::string>(&plotConf)->default_value("configs/plots/plotDileptonConf.yaml"),
+        "Plot configuration file.")(
+        "tree",
+        po::value<std::string>(&treeName)->default_value("makeTopologyNtupleMiniAOD/tree"),
+        "Name of the tree in the ntuples.")(
+        "nEvents,n",
+        po::value<long long>(&nEvents)->default_value(0),
+        "Number of ntuple entries to read. 0 reads them all.")(
+        "repeats,r",
+        po::value<unsigned>(&repeats)->default_value(10),
+        "Times to fill the plots for each selected event.")(
+        "data", po::bool_switch(&isData), "The ntuples are data.")(
+        "2016", po::bool_switch(&is2016), "Use 2016 conditions (SFs, et al.).")(
+        "2016APV", po::bool_switch(&is2016APV), "Use 2016 APV conditions (SFs, et al.).")(
+        "2018", po::bool_switch(&is2018), "Use 2018 conditions (SFs, et al.).");
+    po::variables_map vm;
+
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << desc;
+            return 0;
+        }
+
+        po::notify(vm);
+    }
+    catch (const std::logic_error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        std::cerr << "Use -h or --help for help." << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> titles;
+    std::vector<std::string> names;
+    std::vector<float> xMins;
+    std::vector<float> xMaxs;
+    std::vector<int> nBins;
+    std::vector<std::string> fillExps;
+    std::vector<std::string> xAxisLabels;
+    std::vector<int> cutStages;
+    Parser::parse_plots(plotConf, titles, names, xMins, xMaxs, nBins, fillExps, xAxisLabels, cutStages);
+    // Fill every plot in the config
+    const unsigned lastStage{static_cast<unsigned>(*std::max_element(cutStages.begin(), cutStages.end()))};
+    Plots plots{titles, names, xMins, xMaxs, nBins, fillExps, xAxisLabels, cutStages, lastStage, "buffer"};
+    Plots legacyPlots{titles, names, xMins, xMaxs, nBins, fillExps, xAxisLabels, cutStages, lastStage, "vector"};
+    Plots kernelPlots{titles, names, xMins, xMaxs, nBins, fillExps, xAxisLabels, cutStages, lastStage, "kernel"};
+    const std::shared_ptr<Plots> kernelBuffers{kernelPlots.cloneBuffered()};
+
+    // Each expression as the old path ran it, allocating a vector per call.
+    // The old expressions are gone, so these copy out what evaluate gives,
+    // as fillAllPlots calls it, and that call is counted against the old
+    // path, understating the change.
+    std::vector<std::function<std::vector<float>(const AnalysisEvent&)>> legacyFills;
+    for (const auto& fillExp : fillExps) {
+        const FillExpression& expression{Plots::getFillExpression(fillExp)};
+        legacyFills.emplace_back([&expression](const AnalysisEvent& event) {
+            FillValues buffer;
+            const FillValues& values{expression.evaluate(event, buffer)};
+            return std::vector<float>{values.begin(), values.end()};
+        });
+    }
+    const std::vector<plot> legacyPoints{legacyPlots.getPlotPoint()};
+
+    Cuts cuts{false, false, false, is2016, is2016APV, is2018};
+    cuts.parse_config(cutConf);
+    cuts.setMC(!isData);
+    const SystematicsRegistry systematics{"configs/systematicVariations.yaml"};
+
+    TChain chain{treeName.c_str()};
+    for (const auto& file : inFiles) {
+        chain.Add(file.c_str());
+    }
+    AnalysisEvent event{!isData, &chain, is2016 || is2016APV, is2018};
+    const long long numEntries{nEvents > 0 ? std::min(nEvents, chain.GetEntries()) : chain.GetEntries()};
+
+    using clock = std::chrono::steady_clock;
+    clock::duration bufferTime{};
+    clock::duration vectorTime{};
+    clock::duration kernelTime{};
+    long long selected{0};
+    std::vector<Cuts::SystVariation> variations;
+    for (long long entry{0}; entry < numEntries; entry++) {
+        event.GetEntry(entry);
+        variations.clear();
+        variations.push_back({&systematics.nominal(), 1.0, nullptr, nullptr, 0});
+        if (!cuts.makeSharedCuts(event, variations) || !cuts.makeSystCuts(event, variations, 0)) {
+            continue;
+        }
+        selected++;
+        event.loadAllCollections();
+
+        const clock::time_point bufferStart{clock::now()};
+        for (unsigned r{0}; r < repeats; r++) {
+            plots.fillAllPlots(event, variations[0].weight);
+        }
+        const clock::time_point vectorStart{clock::now()};
+        for (unsigned r{0}; r < repeats; r++) {
+            for (size_t i{0}; i < legacyPoints.size(); i++) {
+                if (!legacyPoints[i].fillPlot) continue;
+                for (const auto& val : legacyFills[i](event)) {
+                    legacyPoints[i].plotHist->Fill(val, variations[0].weight);
+                }
+            }
+        }
+        const clock::time_point kernelStart{clock::now()};
+        for (unsigned r{0}; r < repeats; r++) {
+            kernelBuffers->fillAllPlots(event, variations[0].weight);
+        }
+        const clock::time_point kernelEnd{clock::now()};
+        bufferTime += vectorStart - bufferStart;
+        vectorTime += kernelStart - vectorStart;
+        kernelTime += kernelEnd - kernelStart;
+    }
+    kernelPlots.addPlots(*kernelBuffers);
+
+    // Both paths must fill the same histograms
+    const auto differs{[](const double a, const double b) {
+        return a < b || b < a;
+    }};
+    const std::vector<plot> points{plots.getPlotPoint()};
+    const std::vector<plot> kernelPoints{kernelPlots.getPlotPoint()};
+    long long kernelDifferences{0};
+    for (size_t i{0}; i < points.size(); i++) {
+        for (int bin{0}; bin < points[i].plotHist->GetNcells(); bin++) {
+            if (differs(points[i].plotHist->GetBinContent(bin), legacyPoints[i].plotHist->GetBinContent(bin))) {
+                std::cerr << "ERROR: " << names[i] << " differs between the fill paths in bin " << bin << std::endl;
+                return 1;
+            }
+            // Only values within rounding of a bin edge should move
+            if (differs(points[i].plotHist->GetBinContent(bin), kernelPoints[i].plotHist->GetBinContent(bin))) {
+                kernelDifferences++;
+            }
+        }
+    }
+
+    const auto perSecond{[selected, repeats](const clock::duration time) {
+        const double seconds{std::chrono::duration<double>(time).count()};
+        return seconds > 0. ? static_cast<double>(selected) * repeats / seconds : 0.;
+    }};
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << selected << " of " << numEntries << " events selected, " << points.size() << " plots, filled " << repeats << " times each" << std::endl;
+    std::cout << "std::function returning std::vector (wrapping the new expressions, so understates the change): " << perSecond(vectorTime) << " events/s" << std::endl;
+    std::cout << "Fixed buffers and function pointers: " << perSecond(bufferTime) << " events/s" << std::endl;
+    std::cout << "Into histogram buffers: " << perSecond(kernelTime) << " events/s, " << kernelDifferences << " bins differ from the TH1Ds" << std::endl;
+    if (vectorTime.count() > 0 && bufferTime.count() > 0) {
+        std::cout << std::setprecision(2) << "Speed up: " << std::chrono::duration<double>(vectorTime).count() / std::chrono::duration<double>(bufferTime).count() << "x" << std::endl;
+    }
+    if (bufferTime.count() > 0 && kernelTime.count() > 0) {
+        std::cout << std::setprecision(2) << "Speed up of the buffers over TH1D::Fill: " << std::chrono::duration<double>(bufferTime).count() / std::chrono::duration<double>(kernelTime).count() << "x" << std::endl;
+    }
+}
@@ -0,0 +1,97 @@
+#include "histogramBuffer.hpp"
+
+#include <TAxis.h>
+#include <TH1D.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+HistogramBuffer::HistogramBuffer(const TH1D& hist)
+    : numBins_{hist.GetNbinsX()}
+    , xMin_{hist.GetXaxis()->GetXmin()}
+    , xMax_{hist.GetXaxis()->GetXmax()}
+    , binsPerUnit_{hist.GetNbinsX() / (hist.GetXaxis()->GetXmax() - hist.GetXaxis()->GetXmin())}
+    , edges_{}
+    , contents_(static_cast<size_t>(hist.GetNbinsX() + 2), 0.)
+    , sumw2_(static_cast<size_t>(hist.GetNbinsX() + 2), 0.)
+    , entries_{0.}
+    , tsumw_{0.}
+    , tsumw2_{0.}
+    , tsumwx_{0.}
+    , tsumwx2_{0.}
+{
+    if (hist.GetDimension() != 1) {
+        throw std::logic_error(std::string{"Histogram "} + hist.GetName() + " is not one dimensional");
+    }
+    const TArrayD* bins{hist.GetXaxis()->GetXbins()};
+    if (bins->fN > 0) {
+        edges_.assign(bins->GetArray(), bins->GetArray() + bins->fN);
+    }
+}
+
+int HistogramBuffer::variableBin(const double x) const {
+    if (x < xMin_) {
+        return 0;
+    }
+    if (!(x < xMax_)) {
+        return numBins_ + 1;
+    }
+    // TMath::BinarySearch's last edge at or below x, counted from 1
+    return static_cast<int>(std::upper_bound(edges_.begin(), edges_.end(), x) - edges_.begin());
+}
+
+void HistogramBuffer::add(const HistogramBuffer& other) {
+    if (other.contents_.size() != contents_.size()) {
+        throw std::logic_error("Adding histogram buffers with different binnings");
+    }
+    for (size_t i{0}; i < contents_.size(); i++) {
+        contents_[i] += other.contents_[i];
+        sumw2_[i] += other.sumw2_[i];
+    }
+    entries_ += other.entries_;
+    tsumw_ += other.tsumw_;
+    tsumw2_ += other.tsumw2_;
+    tsumwx_ += other.tsumwx_;
+    tsumwx2_ += other.tsumwx2_;
+}
+
+void HistogramBuffer::addTo(TH1D& hist) const {
+    if (hist.GetNcells() != static_cast<int>(contents_.size())) {
+        throw std::logic_error(std::string{"Histogram "} + hist.GetName() + " is not binned as its buffer");
+    }
+    // Before the contents change, as an empty histogram works its
+    // statistics out from them
+    double stats[4];
+    hist.GetStats(stats);
+    const double entries{hist.GetEntries()};
+    if (hist.GetSumw2N() == 0) {
+        hist.Sumw2();
+    }
+
+    double* contents{hist.GetArray()};
+    double* sumw2{hist.GetSumw2()->GetArray()};
+    for (size_t i{0}; i < contents_.size(); i++) {
+        contents[i] += contents_[i];
+        sumw2[i] += sumw2_[i];
+    }
+    stats[0] += tsumw_;
+    stats[1] += tsumw2_;
+    stats[2] += tsumwx_;
+    stats[3] += tsumwx2_;
+    hist.PutStats(stats);
+    hist.SetEntries(entries + entries_);
+}
+
+void HistogramBuffer::reset() {
+    if (empty()) {
+        return;
+    }
+    std::fill(contents_.begin(), contents_.end(), 0.);
+    std::fill(sumw2_.begin(), sumw2_.end(), 0.);
+    entries_ = 0.;
+    tsumw_ = 0.;
+    tsumw2_ = 0.;
+    tsumwx_ = 0.;
+    tsumwx2_ = 0.;
+}
@@ -7,6 +7,7 @@
 #include "TLegend.h"
 #include "TMath.h"
 #include "TPad.h"
+#include "TROOT.h"
 #include "TStyle.h"
 
 // For CMS Guideline styling
@@ -15,6 +16,14 @@
 
 #include <boost/filesystem.hpp>
 #include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 // For debugging. *sigh*
 #include <iostream>
@@ -37,6 +46,7 @@ HistogramPlotter::HistogramPlotter(std::vector<std::string> legOrder,
     , is2016APV_{is2016APV}
     , is2018_{is2018}
     , loadHistos_{false}
+    , plotProcesses_{1}
     ,
 
     // Some things that actually need to be set. plot order, legend order and
@@ -101,8 +111,8 @@ void HistogramPlotter::plotHistos(
     {
         stageNameVec.emplace_back(stageNameIt->first);
     }
-    // Loop over all the plots, for each stage name. Then create a map for each
-    // with all datasets in it.
+    // Every plot of every stage, in the order they were always made
+    std::vector<std::pair<unsigned, std::string>> jobs;
     unsigned long plotNumb{
         firstIt->second.begin()->second->getPlotPoint().size()};
     for (unsigned i{0}; i < plotNumb; i++)
@@ -110,43 +120,133 @@ void HistogramPlotter::plotHistos(
         for (auto stageIt = stageNameVec.begin(); stageIt != stageNameVec.end();
              stageIt++)
         {
-            std::map<std::string, TH1D*> tempPlotMap;
-            for (auto mapIt = plotMap.begin(); mapIt != plotMap.end(); mapIt++)
+            jobs.emplace_back(i, *stageIt);
+        }
+    }
+
+    if (plotProcesses_ < 2 || jobs.size() < 2)
+    {
+        for (const auto& job : jobs)
+        {
+            plotStage(plotMap, job.first, job.second);
+        }
+        return;
+    }
+
+    // Process p draws plots p, p + processes, ... No plot depends on
+    // the ones drawn before it, and every process starts from a copy of
+    // this one's histograms and style, so the files are the same as drawing
+    // them all here would give.
+    const size_t processes{std::min<size_t>(plotProcesses_, jobs.size())};
+    std::cout << std::flush;
+    std::cerr << std::flush;
+    std::fflush(nullptr);
+    std::vector<pid_t> children;
+    for (size_t p{0}; p < processes; p++)
+    {
+        const pid_t pid{fork()};
+        if (pid < 0)
+        {
+            // Don't leave the ones already started running unwaited for
+            for (const pid_t child : children)
             {
-                if (loadHistos_)
-                {
-                    TFile* inputFile = new TFile{
-                        (histogramDirectory_
-                         + firstIt->second[*stageIt]->getPlotPoint()[i].name
-                         + "_Histo.root")
-                            .c_str(),
-                        "READ"};
-                    TH1D* tempHist =
-                        dynamic_cast<TH1D*>(inputFile
-                                                ->Get((firstIt->second[*stageIt]
-                                                           ->getPlotPoint()[i]
-                                                           .name)
-                                                          .c_str())
-                                                ->Clone());
-                    tempHist->SetDirectory(0);
-                    tempPlotMap[mapIt->first] = tempHist;
-                    inputFile->Close();
-                    delete inputFile;
-                }
-                else if (!loadHistos_)
+                int status{0};
+                waitpid(child, &status, 0);
+            }
+            throw std::runtime_error("Unable to fork a plotting process");
+        }
+        if (pid == 0)
+        {
+            int status{0};
+            try
+            {
+                // There's no sharing the parent's display
+                gROOT->SetBatch(true);
+                for (size_t j{p}; j < jobs.size(); j += processes)
                 {
-                    tempPlotMap[mapIt->first] =
-                        mapIt->second[*stageIt]->getPlotPoint()[i].plotHist;
+                    plotStage(plotMap, jobs[j].first, jobs[j].second);
                 }
             }
-            std::vector<std::string> xAxisLabel = {
-                firstIt->second[*stageIt]->getPlotPoint()[i].xAxisLabel};
-            makePlot(tempPlotMap,
-                     firstIt->second[*stageIt]->getPlotPoint()[i].title,
-                     firstIt->second[*stageIt]->getPlotPoint()[i].name,
-                     xAxisLabel);
+            catch (const std::exception& e)
+            {
+                std::cerr << "ERROR: " << e.what() << std::endl;
+                status = 1;
+            }
+            catch (...)
+            {
+                // Nothing may unwind out of the child into the parent's code
+                std::cerr << "ERROR: unknown exception in a plotting process"
+                          << std::endl;
+                status = 1;
+            }
+            std::cout << std::flush;
+            std::cerr << std::flush;
+            std::fflush(nullptr);
+            // Skip the exit handlers, which are the parent's to run
+            _exit(status);
+        }
+        children.emplace_back(pid);
+    }
+    unsigned failed{0};
+    for (const pid_t child : children)
+    {
+        int status{0};
+        if (waitpid(child, &status, 0) < 0 || !WIFEXITED(status)
+            || WEXITSTATUS(status) != 0)
+        {
+            failed++;
+        }
+    }
+    if (failed > 0)
+    {
+        throw std::runtime_error(std::to_string(failed) + " of "
+                                 + std::to_string(processes)
+                                 + " plotting processes failed");
+    }
+}
+
+void HistogramPlotter::plotStage(
+    std::map<std::string, std::map<std::string, std::shared_ptr<Plots>>>&
+        plotMap,
+    const unsigned i,
+    const std::string& stage)
+{
+    auto firstIt = plotMap.begin();
+    std::map<std::string, TH1D*> tempPlotMap;
+    for (auto mapIt = plotMap.begin(); mapIt != plotMap.end(); mapIt++)
+    {
+        if (loadHistos_)
+        {
+            TFile* inputFile = new TFile{
+                (histogramDirectory_
+                 + firstIt->second[stage]->getPlotPoint()[i].name
+                 + "_Histo.root")
+                    .c_str(),
+                "READ"};
+            TH1D* tempHist =
+                dynamic_cast<TH1D*>(inputFile
+                                        ->Get((firstIt->second[stage]
+                                                   ->getPlotPoint()[i]
+                                                   .name)
+                                                  .c_str())
+                                        ->Clone());
+            tempHist->SetDirectory(0);
+            tempPlotMap[mapIt->first] = tempHist;
+            inputFile->Close();
+            delete inputFile;
+        }
+        else if (!loadHistos_)
+        {
+            tempPlotMap[mapIt->first] =
+                mapIt->second[stage]->getPlotPoint()[i].plotHist;
         }
     }
+    std::vector<std::string> xAxisLabel = {
+        firstIt->second[stage]->getPlotPoint()[i].xAxisLabel};
+    makePlot(tempPlotMap,
+             firstIt->second[stage]->getPlotPoint()[i].title,
+             firstIt->second[stage]->getPlotPoint()[i].name,
+             xAxisLabel);
 }
 
 std::map<std::string, TH1D*>
@@ -0,0 +1,100 @@
+#include "jecUncertaintyTable.hpp"
+
+#include "conditions.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    std::mutex tablesMutex;
+    std::map<std::string, std::shared_ptr<const JECUncertaintyTable>> tables;
+
+    // The file repeats its edges and pT points to a handful of digits, so
+    // values read from different lines are matched to within rounding
+    [[gnu::const]] bool differs(const double a, const double b) {
+        return std::abs(a - b) > 1e-9 * std::max(1., std::abs(a));
+    }
+} // namespace
+
+std::shared_ptr<const JECUncertaintyTable> JECUncertaintyTable::load(const std::string& fileName) {
+    const std::lock_guard<std::mutex> lock{tablesMutex};
+    auto& table{tables[fileName]};
+    if (!table) {
+        table.reset(new JECUncertaintyTable{fileName});
+    }
+    return table;
+}
+
+JECUncertaintyTable::JECUncertaintyTable(const std::string& fileName)
+    : etaEdges_{}
+    , ptPoints_{}
+    , up_{}
+    , down_{}
+{
+    const std::unique_ptr<std::istream> jecFile{Conditions::open(fileName)};
+    if (!*jecFile) {
+        throw std::runtime_error("Unable to open JEC uncertainty file " + fileName);
+    }
+
+    // Each line is: etaMin etaMax 3 * numPoints, then pT up down per point
+    std::string line;
+    while (std::getline(*jecFile, line)) {
+        std::istringstream values{line};
+        double etaMin{0.};
+        double etaMax{0.};
+        size_t numValues{0};
+        if (!(values >> etaMin >> etaMax >> numValues)) {
+            continue;
+        }
+        if (etaEdges_.empty()) {
+            etaEdges_.emplace_back(etaMin);
+        }
+        else if (differs(etaMin, etaEdges_.back())) {
+            throw std::logic_error(fileName + ": eta bins are not contiguous");
+        }
+        etaEdges_.emplace_back(etaMax);
+
+        const bool first{ptPoints_.empty()};
+        for (size_t i{0}; i < numValues / 3; i++) {
+            double pt{0.};
+            double up{0.};
+            double down{0.};
+            values >> pt >> up >> down;
+            if (first) {
+                ptPoints_.emplace_back(pt);
+            }
+            else if (i >= ptPoints_.size() || differs(pt, ptPoints_[i])) {
+                throw std::logic_error(fileName + ": pT points differ between eta bins");
+            }
+            up_.emplace_back(up);
+            down_.emplace_back(down);
+        }
+        if (!values || up_.size() != ptPoints_.size() * (etaEdges_.size() - 1)) {
+            throw std::logic_error(fileName + ": bad line \"" + line + "\"");
+        }
+    }
+    if (ptPoints_.size() < 2) {
+        throw std::logic_error(fileName + " has too few pT points");
+    }
+}
+
+double JECUncertaintyTable::uncertainty(const double pt, const double eta, const bool up, const bool interpolate) const {
+    // Only the inner eta edges, so that eta beyond the table lands in the
+    // first or last bin
+    const size_t etaBin{static_cast<size_t>(std::upper_bound(etaEdges_.begin() + 1, etaEdges_.end() - 1, eta) - (etaEdges_.begin() + 1))};
+    const double clampedPt{std::min(std::max(pt, ptPoints_.front()), ptPoints_.back())};
+    // The point below pT, leaving a point above it to interpolate to
+    const size_t point{static_cast<size_t>(std::upper_bound(ptPoints_.begin() + 1, ptPoints_.end() - 1, clampedPt) - (ptPoints_.begin() + 1))};
+
+    const double* values{&(up ? up_ : down_)[etaBin * ptPoints_.size()]};
+    if (!interpolate) {
+        return values[point];
+    }
+    const double fraction{(clampedPt - ptPoints_[point]) / (ptPoints_[point + 1] - ptPoints_[point])};
+    return values[point] + fraction * (values[point + 1] - values[point]);
+}
@@ -7,56 +7,8 @@
 #include "jetCorrectionUncertainty.hpp"
 
 JetCorrectionUncertainty::JetCorrectionUncertainty(std::string dataFile)
-    : ptMinJEC_{}
-    , ptMaxJEC_{}
-    , etaMinJEC_{}
-    , etaMaxJEC_{}
-    , jecSFUp_{}
-    , jecSFDown_{}
-
+    : table_{JECUncertaintyTable::load(dataFile)}
 {
-    std::ifstream jecFile;
-    jecFile.open(dataFile, std::ifstream::in);
-    std::string line;
-
-    if (!jecFile.is_open())
-    {
-        std::cout << "Unable to open jecFile." << std::endl;
-        std::exit(0);
-    }
-
-    bool first{true};
-    while (getline(jecFile, line))
-    {
-        std::vector<std::string> tempVec;
-        std::stringstream lineStream{line};
-        std::string item;
-        while (std::getline(lineStream, item, ' '))
-        {
-            tempVec.emplace_back(item);
-        }
-        std::vector<float> tempUp;
-        std::vector<float> tempDown;
-
-        etaMinJEC_.emplace_back(std::stof(tempVec[0]));
-        etaMaxJEC_.emplace_back(std::stof(tempVec[1]));
-        for (unsigned i{1}; i < tempVec.size() / 3; i++)
-        {
-            const unsigned ind{i * 3};
-            if (first)
-            {
-                ptMinJEC_.emplace_back(std::stof(tempVec[ind]));
-                ptMaxJEC_.emplace_back((ind + 3 >= tempVec.size()
-                                            ? 10000.
-                                            : std::stof(tempVec[ind + 3])));
-            }
-            tempUp.emplace_back(std::stof(tempVec[ind + 1]));
-            tempDown.emplace_back(std::stof(tempVec[ind + 2]));
-        }
-        jecSFUp_.emplace_back(tempUp);
-        jecSFDown_.emplace_back(tempDown);
-        first = false;
-    }
 }
 
 JetCorrectionUncertainty::~JetCorrectionUncertainty()
@@ -71,48 +23,7 @@ double JetCorrectionUncertainty::getUncertainty(const double pt,
     {
         return 1.0;
     }
-
-    unsigned ptBin{0};
-    unsigned etaBin{0};
-
-    for (size_t i{0}; i != ptMinJEC_.size(); i++)
-    {
-        if (pt > ptMinJEC_[i] && pt <= ptMaxJEC_[i])
-        {
-            ptBin = i;
-            break;
-        }
-    }
-
-    for (size_t i{0}; i != etaMinJEC_.size(); i++)
-    {
-        if (eta > etaMinJEC_[i] && eta <= etaMaxJEC_[i])
-        {
-            etaBin = i;
-            break;
-        }
-    }
-
-    double lowFact{0.};
-    double highFact{0.};
-
-    if (jesUD == 1)
-    {
-        lowFact = jecSFUp_[etaBin][ptBin];
-        highFact = jecSFUp_[etaBin][ptBin + 1];
-    }
-    else
-    {
-        lowFact = jecSFDown_[etaBin][ptBin];
-        highFact = jecSFDown_[etaBin][ptBin + 1];
-    }
-
-    const double a{(highFact - lowFact)
-                   / (ptMaxJEC_[ptBin] - ptMinJEC_[ptBin])};
-    const double b{(lowFact * ptMaxJEC_[ptBin] - highFact * ptMinJEC_[ptBin])
-                   / (ptMaxJEC_[ptBin] - ptMinJEC_[ptBin])};
-
-    return a * pt + b;
+    return table_->uncertainty(pt, eta, jesUD == 1);
 }
 
 std::pair<double, double> JetCorrectionUncertainty::getMetAfterJESUnc(
@@ -0,0 +1,58 @@
+#include "analysisAlgo.hpp"
+#include "conditions.hpp"
+#include "cutClass.hpp"
+
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <string>
+
+// Writes the scale factors, pileup weights and text files an analysis job of
+// one era reads at startup to a snapshot, for analysisMain --conditions
+int main(int argc, char* argv[])
+{
+    std::string outFile;
+    bool is2016{false};
+    bool is2016APV{false};
+    bool is2018{false};
+
+    namespace po = boost::program_options;
+    po::options_description desc("Options");
+    desc.add_options()("help,h", "Print this message.")(
+        "outFile,o",
+        po::value<std::string>(&outFile)->required(),
+        "Snapshot to write.")(
+        "2016", po::bool_switch(&is2016), "Use 2016 conditions (SFs, et al.).")(
+        "2016APV", po::bool_switch(&is2016APV), "Use 2016 APV conditions (SFs, et al.).")(
+        "2018", po::bool_switch(&is2018), "Use 2018 conditions (SFs, et al.).");
+    po::variables_map vm;
+
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+
+        if (vm.count("help"))
+        {
+            std::cout << desc;
+            return 0;
+        }
+
+        po::notify(vm);
+
+        if (is2016 + is2016APV + is2018 > 1)
+        {
+            throw std::logic_error("Choose at most one of 2016, 2016APV and 2018.");
+        }
+    }
+    catch (const std::logic_error& e)
+    {
+        std::cerr << "ERROR: " << e.what() << std::endl;
+        std::cerr << "Use -h or --help for help." << std::endl;
+        return 1;
+    }
+
+    // Loading them as a job would records every table and file it reads
+    const Cuts cuts{false, false, false, is2016, is2016APV, is2018};
+    AnalysisAlgo::loadPileupWeights(is2016, is2016APV, is2018);
+
+    Conditions::writeSnapshot(outFile, Conditions::era(is2016, is2016APV, is2018));
+}
@@ -1,9 +1,9 @@
 #include "MvaEvent.hpp"
-#include "TLorentzVector.h"
 #include "TMVA/Config.h"
 #include "TMVA/Timer.h"
 #include "TTree.h"
 #include "config_parser.hpp"
+#include "fourVector.hpp"
 #include "makeMVAinputAlgo.hpp"
 
 #include <boost/filesystem.hpp>
@@ -528,12 +528,12 @@ void MakeMvaInputs::sameSignAnalysis(
     }
 }
 
-std::pair<TLorentzVector, TLorentzVector>
+std::pair<FourVector, FourVector>
     MakeMvaInputs::sortOutLeptons(const MvaEvent* tree,
                                   const std::string& channel) const
 {
-    TLorentzVector zLep1;
-    TLorentzVector zLep2;
+    FourVector zLep1;
+    FourVector zLep2;
 
     const int zl1Index{tree->zLep1Index};
     const int zl2Index{tree->zLep2Index};
@@ -596,10 +596,10 @@ std::pair<TLorentzVector, TLorentzVector>
     return {zLep1, zLep2};
 }
 
-std::pair<TLorentzVector, TLorentzVector>
+std::pair<FourVector, FourVector>
     MakeMvaInputs::sortOutHadronicW(const MvaEvent* tree,
                                     const int syst,
-                                    TLorentzVector met,
+                                    FourVector met,
                                     const std::vector<int>& jets) const
 {
     const auto wQuark1{getJetVec(tree,
@@ -618,11 +618,11 @@ std::pair<TLorentzVector, TLorentzVector>
     return {wQuark1, wQuark2};
 }
 
-std::pair<std::vector<int>, std::vector<TLorentzVector>> MakeMvaInputs::getJets(
-    const MvaEvent* tree, const int syst, TLorentzVector met) const
+std::pair<std::vector<int>, std::vector<FourVector>> MakeMvaInputs::getJets(
+    const MvaEvent* tree, const int syst, FourVector met) const
 {
     std::vector<int> jetList{};
-    std::vector<TLorentzVector> jetVecList{};
+    std::vector<FourVector> jetVecList{};
 
     for (int i{0}; i != tree->NJETS; i++)
     {
@@ -645,14 +645,14 @@ std::pair<std::vector<int>, std::vector<TLorentzVector>> MakeMvaInputs::getJets(
     return {jetList, jetVecList};
 }
 
-std::pair<std::vector<int>, std::vector<TLorentzVector>>
+std::pair<std::vector<int>, std::vector<FourVector>>
     MakeMvaInputs::getBjets(const MvaEvent* tree,
                             const int syst,
-                            TLorentzVector met,
+                            FourVector met,
                             const std::vector<int>& jets) const
 {
     std::vector<int> bJetList{};
-    std::vector<TLorentzVector> bJetVecList{};
+    std::vector<FourVector> bJetVecList{};
 
     for (int i{0}; i != tree->NBJETS; i++)
     {
@@ -676,14 +676,14 @@ std::pair<std::vector<int>, std::vector<TLorentzVector>>
     return {bJetList, bJetVecList};
 }
 
-TLorentzVector MakeMvaInputs::getJetVec(const MvaEvent* tree,
+FourVector MakeMvaInputs::getJetVec(const MvaEvent* tree,
                                         const int index,
                                         const float smearValue,
-                                        TLorentzVector& metVec,
+                                        FourVector& metVec,
                                         const int syst,
                                         const bool doMetSmear) const
 {
-    TLorentzVector returnJet;
+    FourVector returnJet;
     returnJet.SetPxPyPzE(tree->jetPF2PATPx[index],
                          tree->jetPF2PATPy[index],
                          tree->jetPF2PATPz[index],
@@ -719,11 +719,11 @@ TLorentzVector MakeMvaInputs::getJetVec(const MvaEvent* tree,
     return returnJet;
 }
 
-TLorentzVector
-    MakeMvaInputs::doUncMet(TLorentzVector met,
-                            const TLorentzVector& zLep1,
-                            const TLorentzVector& zLep2,
-                            const std::vector<TLorentzVector>& jetVecs,
+FourVector
+    MakeMvaInputs::doUncMet(FourVector met,
+                            const FourVector& zLep1,
+                            const FourVector& zLep2,
+                            const std::vector<FourVector>& jetVecs,
                             const unsigned syst) const
 {
     double uncMetX{met.Px() + zLep1.Px() + zLep2.Px()};
@@ -926,12 +926,12 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
 
     inputVars.at("eventNumber") = tree->eventNum;
 
-    const std::pair<TLorentzVector, TLorentzVector> zPairLeptons{
+    const std::pair<FourVector, FourVector> zPairLeptons{
         sortOutLeptons(tree, channel)};
-    const TLorentzVector zLep1{zPairLeptons.first};
-    const TLorentzVector zLep2{zPairLeptons.second};
+    const FourVector zLep1{zPairLeptons.first};
+    const FourVector zLep2{zPairLeptons.second};
 
-    TLorentzVector metVec;
+    FourVector metVec;
 
     if (oldMetFlag)
     {
@@ -961,20 +961,20 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
         }
     }
 
-    const std::pair<std::vector<int>, std::vector<TLorentzVector>> jetPair{
+    const std::pair<std::vector<int>, std::vector<FourVector>> jetPair{
         getJets(tree, syst, metVec)};
     const std::vector<int> jets{jetPair.first};
-    const std::vector<TLorentzVector> jetVecs{jetPair.second};
+    const std::vector<FourVector> jetVecs{jetPair.second};
 
-    const std::pair<std::vector<int>, std::vector<TLorentzVector>> bJetPair{
+    const std::pair<std::vector<int>, std::vector<FourVector>> bJetPair{
         getBjets(tree, syst, metVec, jets)};
     const std::vector<int> bJets{bJetPair.first};
-    const std::vector<TLorentzVector> bJetVecs{bJetPair.second};
+    const std::vector<FourVector> bJetVecs{bJetPair.second};
 
-    const std::pair<TLorentzVector, TLorentzVector> wQuarkPair{
+    const std::pair<FourVector, FourVector> wQuarkPair{
         sortOutHadronicW(tree, syst, metVec, jets)};
-    const TLorentzVector wQuark1{wQuarkPair.first};
-    const TLorentzVector wQuark2{wQuarkPair.second};
+    const FourVector wQuark1{wQuarkPair.first};
+    const FourVector wQuark2{wQuarkPair.second};
 
     // Do unclustered met stuff here now that we have all of the objects, all
     // corrected for their various SFs etc ...
@@ -1012,7 +1012,7 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
     inputVars.at("l2Eta") = zLep2.Eta();
     inputVars.at("l2Phi") = zLep2.Phi();
 
-    const TLorentzVector zVec{zLep1 + zLep2};
+    const FourVector zVec{zLep1 + zLep2};
     inputVars.at("zMass") = zVec.M();
     // if (abs(zVec.M() - 91.1876) > 100)
     // {
@@ -1023,14 +1023,14 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
     inputVars.at("zPhi") = zVec.Phi();
     inputVars.at("zMt") = zVec.Mt();
 
-    const TLorentzVector wVec{wQuark1 + wQuark2};
+    const FourVector wVec{wQuark1 + wQuark2};
     const double wMass{(wQuark1 + wQuark2).M()};
     inputVars.at("wMass") = wMass;
     inputVars.at("wPt") = wVec.Pt();
     inputVars.at("wEta") = wVec.Eta();
     inputVars.at("wPhi") = wVec.Phi();
 
-    const TLorentzVector tVec{bJetVecs[0] + wVec};
+    const FourVector tVec{bJetVecs[0] + wVec};
     const double topMass{tVec.M()};
     inputVars.at("tMass") = topMass;
     inputVars.at("tMt") = tVec.Mt();
@@ -1073,7 +1073,7 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
     inputVars.at("wj2Eta") = wQuark2.Eta();
     inputVars.at("wj2Phi") = wQuark2.Phi();
 
-    TLorentzVector totVec{zVec};
+    FourVector totVec{zVec};
     for (const auto& jetVec : jetVecs)
     {
         totVec += jetVec;
@@ -1214,7 +1214,7 @@ void MakeMvaInputs::fillTree(TTree* outTreeSig,
     inputVars.at("l2wj1DelR") = zLep2.DeltaR(wQuark1);
     inputVars.at("l2wj2DelR") = zLep2.DeltaR(wQuark2);
 
-    TLorentzVector jetVector;
+    FourVector jetVector;
     inputVars.at("zjMinR") = std::numeric_limits<float>::infinity();
     inputVars.at("zjMaxR") = -std::numeric_limits<float>::infinity();
 
@@ -0,0 +1,69 @@
+#include "packedCandGrid.hpp"
+
+#include <algorithm>
+
+namespace
+{
+    constexpr float PI_F{3.14159265358979f};
+    constexpr float ETA_WIDTH{2.f * PackedCandGrid::ETA_MAX / PackedCandGrid::NETA};
+    constexpr float PHI_WIDTH{2.f * PI_F / PackedCandGrid::NPHI};
+} // namespace
+
+static_assert(ETA_WIDTH >= PackedCandGrid::CELL_SIZE && PHI_WIDTH >= PackedCandGrid::CELL_SIZE, "Grid cells must be at least as wide as the largest cone");
+
+size_t PackedCandGrid::etaBin(const float eta) {
+    // Written so that NaN ends up in the first bin
+    float bin{(eta + ETA_MAX) / ETA_WIDTH};
+    bin = bin > 0.f ? bin : 0.f;
+    bin = bin < static_cast<float>(NETA - 1) ? bin : static_cast<float>(NETA - 1);
+    return static_cast<size_t>(bin);
+}
+
+size_t PackedCandGrid::phiBin(const float phi) {
+    float bin{(phi + PI_F) / PHI_WIDTH};
+    bin = bin > 0.f ? bin : 0.f;
+    bin = bin < static_cast<float>(NPHI - 1) ? bin : static_cast<float>(NPHI - 1);
+    return static_cast<size_t>(bin);
+}
+
+void PackedCandGrid::build(const float* eta, const float* phi, const int numCands) {
+    // Counting sort of the candidates into their cells
+    std::array<size_t, MAXCANDS> candCell;
+    cellStart_.fill(0);
+    for (int k{0}; k < numCands; k++) {
+        candCell[k] = cell(etaBin(eta[k]), phiBin(phi[k]));
+        cellStart_[candCell[k] + 1]++;
+    }
+    for (size_t c{0}; c < NCELLS; c++) {
+        cellStart_[c + 1] += cellStart_[c];
+    }
+    std::array<int, NCELLS> filled;
+    std::copy(cellStart_.begin(), cellStart_.end() - 1, filled.begin());
+    for (int k{0}; k < numCands; k++) {
+        cellCands_[filled[candCell[k]]++] = k;
+    }
+}
+
+void PackedCandGrid::candidatesNear(const float* axisEta, const float* axisPhi, const size_t numAxes, std::vector<int>& indices) const {
+    indices.clear();
+
+    std::array<bool, NCELLS> wanted{};
+    for (size_t a{0}; a < numAxes; a++) {
+        const size_t etaCentre{etaBin(axisEta[a])};
+        const size_t phiCentre{phiBin(axisPhi[a])};
+        const size_t etaFirst{etaCentre > 0 ? etaCentre - 1 : 0};
+        const size_t etaLast{etaCentre < NETA - 1 ? etaCentre + 1 : NETA - 1};
+        for (size_t e{etaFirst}; e <= etaLast; e++) {
+            wanted[cell(e, (phiCentre + NPHI - 1) % NPHI)] = true;
+            wanted[cell(e, phiCentre)] = true;
+            wanted[cell(e, (phiCentre + 1) % NPHI)] = true;
+        }
+    }
+
+    for (size_t c{0}; c < NCELLS; c++) {
+        if (wanted[c]) {
+            indices.insert(indices.end(), cellCands_.begin() + cellStart_[c], cellCands_.begin() + cellStart_[c + 1]);
+        }
+    }
+    std::sort(indices.begin(), indices.end());
+}
@@ -0,0 +1,91 @@
+#include "packedCandIsolation.hpp"
+
+namespace
+{
+    constexpr float PI_F{3.14159265358979f};
+    constexpr float TWO_PI_F{2.f * PI_F};
+    // Charged, neutral and pileup
+    constexpr size_t NSUMS{3};
+    // A few pairs per event for each of the muons and the hadrons
+    constexpr size_t CACHE_RESERVE{16};
+} // namespace
+
+static_assert(PackedCandIsolation::CONES[PackedCandIsolation::NCONES - 1] <= PackedCandGrid::CELL_SIZE, "Cones must fit in the grid cells");
+
+PackedCandIsolation::PackedCandIsolation()
+    : cands_{nullptr}
+    , cache_{}
+    , nearCands_{}
+    , numScans_{0}
+{
+    cache_.reserve(CACHE_RESERVE);
+    nearCands_.reserve(PackedCandKinematics::MAXCANDS);
+}
+
+void PackedCandIsolation::reset(const PackedCandKinematics& cands) {
+    cands_ = &cands;
+    cache_.clear();
+    numScans_ = 0;
+}
+
+PackedCandIsolation::pairSums PackedCandIsolation::pairIsolation(const Pair pair, const int index1, const int index2, const Vec vec, const FourVector& first, const FourVector& second, const int exclude1, const int exclude2) {
+    for (const cacheEntry& entry : cache_) {
+        if (entry.pair == pair && entry.index1 == index1 && entry.index2 == index2 && entry.vec == vec) {
+            return entry.sums;
+        }
+    }
+
+    const FourVector pairVec{first + second};
+    const float axisEta[NAXES]{static_cast<float>(first.Eta()), static_cast<float>(second.Eta()), static_cast<float>(pairVec.Eta())};
+    const float axisPhi[NAXES]{static_cast<float>(first.Phi()), static_cast<float>(second.Phi()), static_cast<float>(pairVec.Phi())};
+    float cone2[NCONES];
+    for (size_t c{0}; c < NCONES; c++) {
+        cone2[c] = CONES[c] * CONES[c];
+    }
+
+    const bool pf{vec == Vec::pf};
+    const float* eta{pf ? cands_->eta : cands_->trkEta};
+    const float* phi{pf ? cands_->phi : cands_->trkPhi};
+    const float* charged{pf ? cands_->chargedPt : cands_->chargedTrkPt};
+    const float* neutral{pf ? cands_->neutralEt : cands_->neutralTrkEt};
+    const float* pu{pf ? cands_->puPt : cands_->puTrkPt};
+    const PackedCandGrid& grid{pf ? cands_->grid : cands_->trkGrid};
+    grid.candidatesNear(axisEta, axisPhi, NAXES, nearCands_);
+    const int* near{nearCands_.data()};
+    const int numNear{static_cast<int>(nearCands_.size())};
+
+    // Every axis, cone and sum in one pass over the nearby candidates. The
+    // inner loops have fixed trip counts, so they unroll and the candidate
+    // loop vectorises.
+    float sums[NAXES * NCONES * NSUMS]{};
+#pragma omp simd reduction(+ : sums[:NAXES * NCONES * NSUMS])
+    for (int n = 0; n < numNear; n++) {
+        const int k{near[n]};
+        const bool counted{k != exclude1 && k != exclude2};
+        for (size_t a = 0; a < NAXES; a++) {
+            const float dEta{eta[k] - axisEta[a]};
+            float dPhi{phi[k] - axisPhi[a]};
+            dPhi = dPhi > PI_F ? dPhi - TWO_PI_F : dPhi;
+            dPhi = dPhi < -PI_F ? dPhi + TWO_PI_F : dPhi;
+            const float dR2{dEta * dEta + dPhi * dPhi};
+            for (size_t c = 0; c < NCONES; c++) {
+                const bool inCone{counted && dR2 < cone2[c]};
+                float* axisSums{&sums[(a * NCONES + c) * NSUMS]};
+                axisSums[0] += inCone ? charged[k] : 0.f;
+                axisSums[1] += inCone ? neutral[k] : 0.f;
+                axisSums[2] += inCone ? pu[k] : 0.f;
+            }
+        }
+    }
+    numScans_++;
+
+    pairSums result;
+    for (size_t a{0}; a < NAXES; a++) {
+        for (size_t c{0}; c < NCONES; c++) {
+            const float* axisSums{&sums[(a * NCONES + c) * NSUMS]};
+            result[a][c] = {axisSums[0], axisSums[1], axisSums[2]};
+        }
+    }
+    cache_.push_back({pair, index1, index2, vec, result});
+    return result;
+}
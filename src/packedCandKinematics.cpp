@@ -0,0 +1,54 @@
+#include "packedCandKinematics.hpp"
+
+#include "AnalysisEvent.hpp"
+
+#include <cmath>
+
+static_assert(PackedCandKinematics::MAXCANDS == AnalysisEvent::NPACKEDCANDSMAX, "PackedCandKinematics must hold every packed candidate");
+static_assert(PackedCandGrid::MAXCANDS == PackedCandKinematics::MAXCANDS, "PackedCandGrid must hold every packed candidate");
+
+namespace
+{
+    // What TLorentzVector::Eta() gives for a vector along the beam line, as
+    // in FourVector::Eta()
+    constexpr float BEAMLINE_ETA{10e10f};
+} // namespace
+
+void PackedCandKinematics::fill(const AnalysisEvent& event) {
+    size = event.numPackedCands;
+
+    for (int k{0}; k < size; k++) {
+        const float px{event.packedCandsPx[k]};
+        const float py{event.packedCandsPy[k]};
+        const float pz{event.packedCandsPz[k]};
+        const float e{event.packedCandsE[k]};
+
+        pt[k] = std::sqrt(px * px + py * py);
+        phi[k] = std::atan2(py, px);
+        if (pt[k] > 0.f) {
+            eta[k] = std::asinh(pz / pt[k]);
+            et[k] = e * pt[k] / std::sqrt(pt[k] * pt[k] + pz * pz);
+        }
+        else {
+            eta[k] = pz > 0.f ? BEAMLINE_ETA : pz < 0.f ? -BEAMLINE_ETA : 0.f;
+            et[k] = 0.f;
+        }
+
+        trkPt[k] = event.packedCandsPseudoTrkPt[k];
+        trkEta[k] = event.packedCandsPseudoTrkEta[k];
+        trkPhi[k] = event.packedCandsPseudoTrkPhi[k];
+        trkEt[k] = trkPt[k] > 0.f ? e / std::cosh(trkEta[k]) : 0.f;
+
+        const bool neutral{event.packedCandsCharge[k] == 0};
+        const bool fromPV{event.packedCandsFromPV[k] >= 2};
+        neutralEt[k] = neutral && pt[k] >= 0.5f ? et[k] : 0.f;
+        neutralTrkEt[k] = neutral && trkPt[k] >= 0.5f ? trkEt[k] : 0.f;
+        chargedPt[k] = !neutral && fromPV ? pt[k] : 0.f;
+        chargedTrkPt[k] = !neutral && fromPV ? trkPt[k] : 0.f;
+        puPt[k] = !neutral && !fromPV && pt[k] >= 0.5f ? pt[k] : 0.f;
+        puTrkPt[k] = !neutral && !fromPV && trkPt[k] >= 0.5f ? trkPt[k] : 0.f;
+    }
+
+    grid.build(eta, phi, size);
+    trkGrid.build(trkEta, trkPhi, size);
+}
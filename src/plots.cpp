@@ -1,27 +1,32 @@
 #include "TH1D.h"
-#include "TLorentzVector.h"
 #include "cutClass.hpp"
+#include "fourVector.hpp"
 #include "plots.hpp"
 
 #include <boost/numeric/conversion/cast.hpp>
+#include <algorithm>
 #include <cmath>
 #include <iomanip>
 #include <iostream>
 
 Plots::Plots(const std::vector<std::string> titles, const std::vector<std::string> names, const std::vector<float> xMins, const std::vector<float> xMaxs, const std::vector<int> nBins, const std::vector<std::string> fillExps, const std::vector<std::string> xAxisLabels,
              const std::vector<int> cutStage, const unsigned thisCutStage,  const std::string postfixName) { // Get the function pointer map for later custopmisation. This is gonna be great, I promise.
-    const auto functionMap{getFncMap()};
+    const auto branchMap{getBranchMap()};
 
     plotPoint = std::vector<plot>(names.size());
     for (unsigned i{0}; i < names.size(); i++) {
         std::string plotName = names[i] + "_" + postfixName;
         plotPoint[i].name = plotName;
         plotPoint[i].title = titles[i];
-        plotPoint[i].fillExp = functionMap.at(fillExps[i]);
+        plotPoint[i].fillExp = getFillExpression(fillExps[i]);
         plotPoint[i].xAxisLabel = xAxisLabels[i];
         plotPoint[i].plotHist =
             new TH1D{plotName.c_str(), (plotName + ";" + plotPoint[i].xAxisLabel).c_str(), nBins[i], xMins[i], xMaxs[i]};
         plotPoint[i].fillPlot = boost::numeric_cast<unsigned>(cutStage[i]) <= thisCutStage;
+        if (plotPoint[i].fillPlot && branchMap.count(fillExps[i])) {
+            const auto& branches{branchMap.at(fillExps[i])};
+            branchManifest.insert(branchManifest.end(), branches.begin(), branches.end());
+        }
     }
 }
 
@@ -30,216 +35,260 @@ Plots::~Plots() {
         delete plotPoint[i].plotHist;
 }
 
-std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisEvent&)>> Plots::getFncMap() const {
-    return {
-        {"lep1Pt", [](const AnalysisEvent& event) -> std::vector<float> {
+std::shared_ptr<Plots> Plots::cloneBuffered() const {
+    std::shared_ptr<Plots> copy{new Plots{}};
+    copy->plotPoint = plotPoint;
+    copy->branchManifest = branchManifest;
+    for (auto& point : copy->plotPoint) {
+        copy->buffers.emplace_back(*point.plotHist);
+        // Owned by this one
+        point.plotHist = nullptr;
+    }
+    return copy;
+}
+
+void Plots::addPlots(const Plots& other) {
+    for (unsigned i{0}; i < plotPoint.size(); i++) {
+        if (buffers.empty()) {
+            other.buffers[i].addTo(*plotPoint[i].plotHist);
+        }
+        else {
+            buffers[i].add(other.buffers[i]);
+        }
+    }
+}
+
+void Plots::resetBuffers() {
+    for (auto& buffer : buffers) {
+        buffer.reset();
+    }
+}
+
+namespace
+{
+    using Pair = DerivedQuantities::Pair;
+    using Vertex = DerivedQuantities::Vertex;
+
+    constexpr FillExpression scalarFill(float (*fill)(const AnalysisEvent&)) {
+        return {fill, nullptr};
+    }
+    constexpr FillExpression listFill(FillValues& (*fill)(const AnalysisEvent&, FillValues&)) {
+        return {nullptr, fill};
+    }
+
+    struct NamedFillExpression
+    {
+        const char* name;
+        FillExpression fill;
+    };
+
+    // Built at compile time; the lambdas capture nothing, so each is a
+    // plain function pointer
+    constexpr NamedFillExpression fillExpressions[]{
+        {"lep1Pt", scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.elePF2PATPX[event.electronIndexTight[0]],
                      event.elePF2PATPY[event.electronIndexTight[0]],
                      event.elePF2PATPZ[event.electronIndexTight[0]],
                      event.elePF2PATE[event.electronIndexTight[0]]};
-                 return { float (tempVec.Pt()) };
+                 return float (tempVec.Pt());
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[0]],
                      event.muonPF2PATPY[event.muonIndexTight[0]],
                      event.muonPF2PATPZ[event.muonIndexTight[0]],
                      event.muonPF2PATE[event.muonIndexTight[0]]};
 //                 tempVec *= event.muonMomentumSF[0];
-                 return { float (tempVec.Pt()) };
+                 return float (tempVec.Pt());
              }
-         }},
-        {"lep1Eta", [](const AnalysisEvent& event) -> std::vector<float> {
+         })},
+        {"lep1Eta", scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {std::abs(event.elePF2PATSCEta[event.electronIndexTight[0]])};
+                 return std::abs(event.elePF2PATSCEta[event.electronIndexTight[0]]);
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[0]],
                      event.muonPF2PATPY[event.muonIndexTight[0]],
                      event.muonPF2PATPZ[event.muonIndexTight[0]],
                      event.muonPF2PATE[event.muonIndexTight[0]]};
 //                 tempVec *= event.muonMomentumSF[0];
-                 return { float (tempVec.Eta()) };
+                 return float (tempVec.Eta());
              }
-         }},
-        {"lep2Pt", [](const AnalysisEvent& event) -> std::vector<float> {
+         })},
+        {"lep2Pt", scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.elePF2PATPX[event.electronIndexTight[1]],
                      event.elePF2PATPY[event.electronIndexTight[1]],
                      event.elePF2PATPZ[event.electronIndexTight[1]],
                      event.elePF2PATE[event.electronIndexTight[1]]};
-                 return { float (tempVec.Pt()) };
+                 return float (tempVec.Pt());
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[1]],
                      event.muonPF2PATPY[event.muonIndexTight[1]],
                      event.muonPF2PATPZ[event.muonIndexTight[1]],
                      event.muonPF2PATE[event.muonIndexTight[1]]};
 //                 tempVec *= event.muonMomentumSF[1];
-                 return { float (tempVec.Pt()) };
+                 return float (tempVec.Pt());
              }
-         }},
-        {"lep2Eta", [](const AnalysisEvent& event) -> std::vector<float> {
+         })},
+        {"lep2Eta", scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {std::abs(event.elePF2PATSCEta[event.electronIndexTight[1]])};
+                 return std::abs(event.elePF2PATSCEta[event.electronIndexTight[1]]);
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[1]],
                      event.muonPF2PATPY[event.muonIndexTight[1]],
                      event.muonPF2PATPZ[event.muonIndexTight[1]],
                      event.muonPF2PATE[event.muonIndexTight[1]]};
 //                 tempVec *= event.muonMomentumSF[1];
-                 return { float (tempVec.Eta()) };
+                 return float (tempVec.Eta());
              }
-         }},
+         })},
         {"lep1RelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {
-                     event.elePF2PATComRelIsoRho[event.electronIndexTight[0]]};
+                 return event.elePF2PATComRelIsoRho[event.electronIndexTight[0]];
              }
              else {
-                 return {
-                     event.muonPF2PATComRelIsodBeta[event.muonIndexTight[0]]};
+                 return event.muonPF2PATComRelIsodBeta[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2RelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {
-                     event.elePF2PATComRelIsoRho[event.electronIndexTight[1]]};
+                 return event.elePF2PATComRelIsoRho[event.electronIndexTight[1]];
              }
              else {
-                 return {
-                     event.muonPF2PATComRelIsodBeta[event.muonIndexTight[1]]};
+                 return event.muonPF2PATComRelIsodBeta[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"lep1Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATPhi[event.electronIndexTight[0]]};
+                 return event.elePF2PATPhi[event.electronIndexTight[0]];
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[0]],
                      event.muonPF2PATPY[event.muonIndexTight[0]],
                      event.muonPF2PATPZ[event.muonIndexTight[0]],
                      event.muonPF2PATE[event.muonIndexTight[0]]};
 //                 tempVec *= event.muonMomentumSF[0];
-                 return { float (tempVec.Phi()) };
+                 return float (tempVec.Phi());
              }
-         }},
+         })},
         {"lep2Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATPhi[event.electronIndexTight[1]]};
+                 return event.elePF2PATPhi[event.electronIndexTight[1]];
              }
              else {
-                 TLorentzVector tempVec{
+                 FourVector tempVec{
                      event.muonPF2PATPX[event.muonIndexTight[1]],
                      event.muonPF2PATPY[event.muonIndexTight[1]],
                      event.muonPF2PATPZ[event.muonIndexTight[1]],
                      event.muonPF2PATE[event.muonIndexTight[1]]};
 //                 tempVec *= event.muonMomentumSF[1];
-                 return { float (tempVec.Phi()) };
+                 return float (tempVec.Phi());
              }
-         }},
+         })},
         {"wQuark1Pt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.wPairQuarks.first.Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.wPairQuarks.first.Pt());
+         })},
         {"wQuark1Eta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.wPairQuarks.first.Eta()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.wPairQuarks.first.Eta());
+         })},
         {"wQuark1Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.wPairQuarks.first.Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.wPairQuarks.first.Phi());
+         })},
         {"wQuark2Pt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.wPairQuarks.second.Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.wPairQuarks.second.Pt());
+         })},
         {"wQuark2Eta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.wPairQuarks.second.Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.wPairQuarks.second.Eta()));
+         })},
         {"wQuark2Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.wPairQuarks.second.Phi()) };
-         }},
-        {"chs1Pt", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.first.Pt()) };
-         }},
-        {"chs1Eta", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.chsPairVec.first.Eta())) };
-         }},
-        {"chs1Phi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.first.Phi()) };
-         }},
-        {"chs1RelIso", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsPairRelIso.first};
-         }},
-        {"chs2Pt", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.second.Pt()) };
-         }},
-        {"chs2Eta", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.chsPairVec.second.Eta())) };
-         }},
-        {"chs2Phi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float (event.chsPairVec.second.Phi()) };
-         }},
-        {"chs2RelIso", [](const AnalysisEvent&event) -> std::vector<float> {
-             return {event.chsPairRelIso.second};
-         }},
-        {"chs1TrkPt", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.first.Pt()) };
-         }},
-        {"chs1TrkEta", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.chsPairTrkVec.first.Eta())) };
-         }},
-        {"chs1TrkPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.first.Phi()) };
-         }},
-        {"chs1TrkIso", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsPairTrkIso.first};
-         }},
-        {"chs2TrkPt", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.second.Pt()) };
-         }},
-        {"chs2TrkEta", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.chsPairTrkVec.second.Eta())) };
-         }},
-        {"chs2TrkPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float (event.chsPairTrkVec.second.Phi()) };
-         }},
-        {"chs2TrkIso", [](const AnalysisEvent&event) -> std::vector<float> {
-             return {event.chsPairTrkIso.second};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.wPairQuarks.second.Phi());
+         })},
+        {"chs1Pt", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.first.Pt());
+         })},
+        {"chs1Eta", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.chsPairVec.first.Eta()));
+         })},
+        {"chs1Phi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.first.Phi());
+         })},
+        {"chs1RelIso", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsPairRelIso.first;
+         })},
+        {"chs2Pt", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.second.Pt());
+         })},
+        {"chs2Eta", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.chsPairVec.second.Eta()));
+         })},
+        {"chs2Phi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.second.Phi());
+         })},
+        {"chs2RelIso", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsPairRelIso.second;
+         })},
+        {"chs1TrkPt", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.first.Pt());
+         })},
+        {"chs1TrkEta", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.chsPairTrkVec.first.Eta()));
+         })},
+        {"chs1TrkPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.first.Phi());
+         })},
+        {"chs1TrkIso", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsPairTrkIso.first;
+         })},
+        {"chs2TrkPt", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.second.Pt());
+         })},
+        {"chs2TrkEta", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.chsPairTrkVec.second.Eta()));
+         })},
+        {"chs2TrkPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.second.Phi());
+         })},
+        {"chs2TrkIso", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsPairTrkIso.second;
+         })},
         {"met",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.metPF2PATEt) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.metPF2PATEt);
+         })},
         {"numbJets",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.jetIndex.size()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.jetIndex.size());
+         })},
         {"totalJetMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totalJet;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector totalJet;
              if (event.jetIndex.size() > 0)
              {
                  for (auto jetIt = event.jetIndex.begin();
                       jetIt != event.jetIndex.end();
                       ++jetIt)
                  {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue = event.jetSmearValue[*jetIt];
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt],
                                         event.jetPF2PATPy[*jetIt],
@@ -248,23 +297,23 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      tempJet *= smearValue;
                      totalJet += tempJet;
                  }
-                 return { float (totalJet.M()) };
+                 return values.add(float (totalJet.M()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"totalJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totalJet;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector totalJet;
              if (event.jetIndex.size() > 0)
              {
                  for (auto jetIt = event.jetIndex.begin();
                       jetIt != event.jetIndex.end();
                       ++jetIt)
                  {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue = event.jetSmearValue[*jetIt];
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt],
                                         event.jetPF2PATPy[*jetIt],
@@ -273,23 +322,23 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      tempJet *= smearValue;
                      totalJet += tempJet;
                  }
-                 return { float (totalJet.Pt()) };
+                 return values.add(float (totalJet.Pt()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"totalJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totalJet;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector totalJet;
              if (event.jetIndex.size() > 0)
              {
                  for (auto jetIt = event.jetIndex.begin();
                       jetIt != event.jetIndex.end();
                       ++jetIt)
                  {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue = event.jetSmearValue[*jetIt];
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt],
                                         event.jetPF2PATPy[*jetIt],
@@ -298,23 +347,23 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      tempJet *= smearValue;
                      totalJet += tempJet;
                  }
-                 return { float (totalJet.Eta()) };
+                 return values.add(float (totalJet.Eta()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"totalJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totalJet;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector totalJet;
              if (event.jetIndex.size() > 0)
              {
                  for (auto jetIt = event.jetIndex.begin();
                       jetIt != event.jetIndex.end();
                       ++jetIt)
                  {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue = event.jetSmearValue[*jetIt];
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt],
                                         event.jetPF2PATPy[*jetIt],
@@ -323,652 +372,650 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      tempJet *= smearValue;
                      totalJet += tempJet;
                  }
-                 return { float (totalJet.Phi())};
+                 return values.add(float (totalJet.Phi()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"leadingJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 0)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[0]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[0]],
                                     event.jetPF2PATPy[event.jetIndex[0]],
                                     event.jetPF2PATPz[event.jetIndex[0]],
                                     event.jetPF2PATE[event.jetIndex[0]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Pt()) };
+                 return values.add(float (tempJet.Pt()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"leadingJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 0)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[0]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[0]],
                                     event.jetPF2PATPy[event.jetIndex[0]],
                                     event.jetPF2PATPz[event.jetIndex[0]],
                                     event.jetPF2PATE[event.jetIndex[0]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Eta()) };
+                 return values.add(float (tempJet.Eta()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"leadingJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 0)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[0]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[0]],
                                     event.jetPF2PATPy[event.jetIndex[0]],
                                     event.jetPF2PATPz[event.jetIndex[0]],
                                     event.jetPF2PATE[event.jetIndex[0]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Phi()) };
+                 return values.add(float (tempJet.Phi()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"leadingJetDeltaRLep",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 0)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[0]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[0]],
                                     event.jetPF2PATPy[event.jetIndex[0]],
                                     event.jetPF2PATPz[event.jetIndex[0]],
                                     event.jetPF2PATE[event.jetIndex[0]]);
                  tempJet *= smearValue;
-                 return { float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
-                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))) };
+                 return values.add(float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
+                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"leadingJetBDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 0)
              {
-                 return {
-                     event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags
-                         [event.jetIndex[0]]};
+                 return values.add(event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags
+                         [event.jetIndex[0]]);
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"secondJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[1]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]],
                                     event.jetPF2PATPy[event.jetIndex[1]],
                                     event.jetPF2PATPz[event.jetIndex[1]],
                                     event.jetPF2PATE[event.jetIndex[1]]);
                  tempJet *= smearValue;
-                 return {float (tempJet.Pt()) };
+                 return values.add(float (tempJet.Pt()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"secondJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[1]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]],
                                     event.jetPF2PATPy[event.jetIndex[1]],
                                     event.jetPF2PATPz[event.jetIndex[1]],
                                     event.jetPF2PATE[event.jetIndex[1]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Eta()) };
+                 return values.add(float (tempJet.Eta()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"secondJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[1]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]],
                                     event.jetPF2PATPy[event.jetIndex[1]],
                                     event.jetPF2PATPz[event.jetIndex[1]],
                                     event.jetPF2PATE[event.jetIndex[1]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Phi()) };
+                 return values.add(float (tempJet.Phi()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"secondJetBDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 return {event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[1]]};
+                 return values.add(event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[1]]);
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"secondJetDeltaRLep",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[1]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]], event.jetPF2PATPy[event.jetIndex[1]], event.jetPF2PATPz[event.jetIndex[1]], event.jetPF2PATE[event.jetIndex[1]]);
                  tempJet *= smearValue;
-                 return { float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
-                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))) };
+                 return values.add(float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
+                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"thirdJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 2)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[2]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[2]], event.jetPF2PATPy[event.jetIndex[2]], event.jetPF2PATPz[event.jetIndex[2]], event.jetPF2PATE[event.jetIndex[2]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Pt()) };
+                 return values.add(float (tempJet.Pt()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"thirdJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 2)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[2]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[2]], event.jetPF2PATPy[event.jetIndex[2]], event.jetPF2PATPz[event.jetIndex[2]], event.jetPF2PATE[event.jetIndex[2]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Eta()) };
+                 return values.add(float (tempJet.Eta()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"thirdJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 2)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[2]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[2]], event.jetPF2PATPy[event.jetIndex[2]], event.jetPF2PATPz[event.jetIndex[2]], event.jetPF2PATE[event.jetIndex[2]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Phi()) };
+                 return values.add(float (tempJet.Phi()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"thirdJetBDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 2)
              {
-                 return {
-                     event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[2]]};
+                 return values.add(event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[2]]);
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"thirdJetDeltaRLep",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 2)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[2]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[2]], event.jetPF2PATPy[event.jetIndex[2]], event.jetPF2PATPz[event.jetIndex[2]], event.jetPF2PATE[event.jetIndex[2]]);
                  tempJet *= smearValue;
-                 return { float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
-                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))) };
+                 return values.add(float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
+                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"fourthJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 3)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[3]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[3]], event.jetPF2PATPy[event.jetIndex[3]], event.jetPF2PATPz[event.jetIndex[3]], event.jetPF2PATE[event.jetIndex[3]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Pt()) };
+                 return values.add(float (tempJet.Pt()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"fourthJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 3)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[3]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[3]], event.jetPF2PATPy[event.jetIndex[3]], event.jetPF2PATPz[event.jetIndex[3]], event.jetPF2PATE[event.jetIndex[3]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Eta()) };
+                 return values.add(float (tempJet.Eta()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"fourthJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 3)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[3]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[3]], event.jetPF2PATPy[event.jetIndex[3]], event.jetPF2PATPz[event.jetIndex[3]], event.jetPF2PATE[event.jetIndex[3]]);
                  tempJet *= smearValue;
-                 return { float (tempJet.Phi()) };
+                 return values.add(float (tempJet.Phi()));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"fourthJetBDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 3)
              {
-                 return {event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[3]]};
+                 return values.add(event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[3]]);
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"fourthJetDeltaRLep",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() > 1)
              {
-                 TLorentzVector tempJet;
+                 FourVector tempJet;
                  float smearValue = event.jetSmearValue[event.jetIndex[1]];
                  tempJet.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]], event.jetPF2PATPy[event.jetIndex[1]], event.jetPF2PATPz[event.jetIndex[1]], event.jetPF2PATE[event.jetIndex[1]]);
                  tempJet *= smearValue;
-                 return { float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
-                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))) };
+                 return values.add(float (std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(), event.zPairLeptons.first.Phi(), tempJet.Eta(), tempJet.Phi()),
+                                  Cuts::deltaR(event.zPairLeptons.second.Eta(), event.zPairLeptons.second.Phi(), tempJet.Eta(), tempJet.Phi()))));
              }
              else
              {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"numbBJets",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.bTagIndex.size()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.bTagIndex.size());
+         })},
         {"bTagDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() > 0)
              {
-                 return {event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[event.bTagIndex[0]]]};
+                 return values.add(event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags[event.jetIndex[event.bTagIndex[0]]]);
              }
-             return {};
-         }},
+             return values;
+         })},
         {"zLepton1Pt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.Pt());
+         })},
         {"zLepton1Eta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.zPairLeptons.first.Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.zPairLeptons.first.Eta()));
+         })},
         {"zLepton2Pt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.Pt());
+         })},
         {"zLepton2Eta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs(event.zPairLeptons.second.Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.zPairLeptons.second.Eta()));
+         })},
         {"zLepton1RelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairRelIso.first};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairRelIso.first;
+         })},
         {"zLepton2RelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairRelIso.second};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairRelIso.second;
+         })},
         {"zLepton1NewRelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairNewRelIso.first};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairNewRelIso.first;
+         })},
         {"zLepton2NewRelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairNewRelIso.second};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairNewRelIso.second;
+         })},
         {"zLepton1NewTrkIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairNewTrkIso.first};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairNewTrkIso.first;
+         })},
         {"zLepton2NewTrkIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zPairNewTrkIso.second};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zPairNewTrkIso.second;
+         })},
         {"zLepton1Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.Phi());
+         })},
         {"zLepton2Phi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.Phi());
+         })},
         {"zPairMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).M()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).mass);
+         })},
         {"zPairPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).pt);
+         })},
         {"zPairEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs((event.zPairLeptons.first + event.zPairLeptons.second).Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.pairKinematics(Pair::zPair).eta));
+         })},
         {"zPairPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).phi);
+         })},
         {"zPairRelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zRelIso};
-         }},        
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zRelIso;
+         })},        
         {"zPairTrkIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.zTrkIso};
-         }},        
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.zTrkIso;
+         })},        
         {"zPairMassRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-                 return { float ((event.zPairLeptonsRefitted.first+event.zPairLeptonsRefitted.second).M()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+                 return float (event.pairKinematics(Pair::zPairRefit).mass);
+         })},
         {"zPairPtRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-                 return { float ((event.zPairLeptonsRefitted.first+event.zPairLeptonsRefitted.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+                 return float (event.pairKinematics(Pair::zPairRefit).pt);
+         })},
         {"zPairEtaRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-                 return { float ((event.zPairLeptonsRefitted.first+event.zPairLeptonsRefitted.second).Eta()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+                 return float (event.pairKinematics(Pair::zPairRefit).eta);
+         })},
         {"zPairPhiRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-                 return { float ((event.zPairLeptonsRefitted.first+event.zPairLeptonsRefitted.second).Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+                 return float (event.pairKinematics(Pair::zPairRefit).phi);
+         })},
 	{"chsPairMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairVec.first + event.chsPairVec.second).M()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsPair).mass);
+         })},
 	{"chsPairPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairVec.first + event.chsPairVec.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsPair).pt);
+         })},
 	{"chsPairEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs((event.chsPairVec.first + event.chsPairVec.second).Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.pairKinematics(Pair::chsPair).eta));
+         })},
 	{"chsPairPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairVec.first + event.chsPairVec.second).Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsPair).phi);
+         })},
         {"chsPairRelIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsRelIso};
-         }},        
-        {"chsPairDeltaR", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.first.DeltaR(event.chsPairVec.second)) };
-         }},
-        {"chsPairDeltaPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.first.DeltaPhi(event.chsPairVec.second)) };
-         }},
-        {"chsPairDeltaZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairVec.first.Z() - event.chsPairVec.second.Z()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsRelIso;
+         })},        
+        {"chsPairDeltaR", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.first.DeltaR(event.chsPairVec.second));
+         })},
+        {"chsPairDeltaPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.first.DeltaPhi(event.chsPairVec.second));
+         })},
+        {"chsPairDeltaZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairVec.first.Z() - event.chsPairVec.second.Z());
+         })},
 	{"chsTrkPairMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVec.first + event.chsPairTrkVec.second).M()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPair).mass);
+         })},
 	{"chsTrkPairPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVec.first + event.chsPairTrkVec.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPair).pt);
+         })},
 	{"chsTrkPairEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs((event.chsPairTrkVec.first + event.chsPairTrkVec.second).Eta())) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.pairKinematics(Pair::chsTrkPair).eta));
+         })},
 	{"chsTrkPairPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVec.first + event.chsPairTrkVec.second).Phi()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPair).phi);
+         })},
         {"chsTrkPairTrkIso",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTrkIso};
-         }},        
-        {"chsTrkPairDeltaR", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.first.DeltaR(event.chsPairTrkVec.second)) };
-         }},
-        {"chsTrkPairDeltaPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.first.DeltaPhi(event.chsPairTrkVec.second)) };
-         }},
-        {"chsTrkPairDeltaZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVec.first.Z() - event.chsPairTrkVec.second.Z()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTrkIso;
+         })},        
+        {"chsTrkPairDeltaR", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.first.DeltaR(event.chsPairTrkVec.second));
+         })},
+        {"chsTrkPairDeltaPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.first.DeltaPhi(event.chsPairTrkVec.second));
+         })},
+        {"chsTrkPairDeltaZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVec.first.Z() - event.chsPairTrkVec.second.Z());
+         })},
 	{"chsTrkPairMassRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPairRefit).mass);
+         })},
 	{"chsTrkPairPtRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPairRefit).pt);
+         })},
 	{"chsTrkPairEtaRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::abs((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Eta()))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::abs(event.pairKinematics(Pair::chsTrkPairRefit).eta));
+         })},
 	{"chsTrkPairPhiRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Phi())};
-         }},
-        {"chsTrkPairDeltaRRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVecRefitted.first.DeltaR(event.chsPairTrkVecRefitted.second))};
-         }},
-        {"chsTrkPairDeltaPhiRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVecRefitted.first.DeltaPhi(event.chsPairTrkVecRefitted.second))};
-         }},
-        {"chsTrkPairDeltaZRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.chsPairTrkVecRefitted.first.Z() - event.chsPairTrkVecRefitted.second.Z())};
-         }},
-        {"wPairMass", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.wPairQuarks.first + event.wPairQuarks.second).M()) };
-         }},
-        {"discalarMass", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).M()) };
-         }},
-        {"discalarMassNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::chsTrkPairRefit).phi);
+         })},
+        {"chsTrkPairDeltaRRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVecRefitted.first.DeltaR(event.chsPairTrkVecRefitted.second));
+         })},
+        {"chsTrkPairDeltaPhiRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVecRefitted.first.DeltaPhi(event.chsPairTrkVecRefitted.second));
+         })},
+        {"chsTrkPairDeltaZRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.chsPairTrkVecRefitted.first.Z() - event.chsPairTrkVecRefitted.second.Z());
+         })},
+        {"wPairMass", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.wPairQuarks.first + event.wPairQuarks.second).M());
+         })},
+        {"discalarMass", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).M());
+         })},
+        {"discalarMassNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1+mu2 + event.chsPairVec.first + event.chsPairVec.second).M()) };
+             return float ((mu1+mu2 + event.chsPairVec.first + event.chsPairVec.second).M());
 //             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).M()) };
-         }},
-        {"discalarDeltaMass", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).M() - (event.chsPairVec.first + event.chsPairVec.second).M()) };
-         }},
-        {"discalarDeltaMassNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+         })},
+        {"discalarDeltaMass", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).mass - event.pairKinematics(Pair::chsPair).mass);
+         })},
+        {"discalarDeltaMassNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1 + mu2).M() - (event.chsPairVec.first + event.chsPairVec.second).M()) };
-         }},
-        {"discalarPt", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Pt()) };
-         }},
-        {"discalarEta", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Eta()) };
-         }},
-        {"discalarPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Phi()) };
-         }},
-        {"discalarDeltaR", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR((event.chsPairVec.first + event.chsPairVec.second))) };
-         }},
-        {"discalarDeltaRNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+             return float ((mu1 + mu2).M() - event.pairKinematics(Pair::chsPair).mass);
+         })},
+        {"discalarPt", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Pt());
+         })},
+        {"discalarEta", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Eta());
+         })},
+        {"discalarPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairVec.first + event.chsPairVec.second).Phi());
+         })},
+        {"discalarDeltaR", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.pairKinematics(Pair::chsPair).sum));
+         })},
+        {"discalarDeltaRNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1+mu2).DeltaR((event.chsPairVec.first + event.chsPairVec.second))) };
-         }},
-        {"discalarDeltaPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi((event.chsPairVec.first + event.chsPairVec.second))) };
-         }},
-        {"discalarDeltaZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Z() - (event.chsPairVec.first + event.chsPairVec.second).Z()) };
-         }},
-        {"discalarMassRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M()) };
-         }},
-        {"discalarMassRefitNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+             return float ((mu1+mu2).DeltaR(event.pairKinematics(Pair::chsPair).sum));
+         })},
+        {"discalarDeltaPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.pairKinematics(Pair::chsPair).sum));
+         })},
+        {"discalarDeltaZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.Z() - event.pairKinematics(Pair::chsPair).sum.Z());
+         })},
+        {"discalarMassRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M());
+         })},
+        {"discalarMassRefitNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1+mu2 + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M()) };
-         }},
-        {"discalarDeltaMassRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).M() - (event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M()) };
-         }},
-        {"discalarDeltaMassRefitNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+             return float ((mu1+mu2 + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M());
+         })},
+        {"discalarDeltaMassRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).mass - event.pairKinematics(Pair::chsTrkPairRefit).mass);
+         })},
+        {"discalarDeltaMassRefitNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1+mu2).M() - (event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).M()) };
-         }},
-        {"discalarPtRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Pt()) };
-         }},
-        {"discalarEtaRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Eta()) };
-         }},
-        {"discalarPhiRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Phi()) };
-         }},
-        {"discalarDeltaRRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second))) };
-         }},
-        {"discalarDeltaRRefitNew", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector mu1, mu2;
+             return float ((mu1+mu2).M() - event.pairKinematics(Pair::chsTrkPairRefit).mass);
+         })},
+        {"discalarPtRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Pt());
+         })},
+        {"discalarEtaRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Eta());
+         })},
+        {"discalarPhiRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.zPairLeptons.first + event.zPairLeptons.second + event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Phi());
+         })},
+        {"discalarDeltaRRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.pairKinematics(Pair::chsTrkPairRefit).sum));
+         })},
+        {"discalarDeltaRRefitNew", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector mu1, mu2;
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
              mu1.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]);
              mu2.SetPxPyPzE(event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]);
-             return { float ((mu1+mu2).DeltaR((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second))) };
-         }},
-        {"discalarDeltaPhiRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi((event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second))) };
-         }},
-        {"discalarDeltaZRefit", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Z() - (event.chsPairTrkVecRefitted.first + event.chsPairTrkVecRefitted.second).Z()) };
-         }},
+             return float ((mu1+mu2).DeltaR(event.pairKinematics(Pair::chsTrkPairRefit).sum));
+         })},
+        {"discalarDeltaPhiRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.pairKinematics(Pair::chsTrkPairRefit).sum));
+         })},
+        {"discalarDeltaZRefit", scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.Z() - event.pairKinematics(Pair::chsTrkPairRefit).sum.Z());
+         })},
 
         {"topMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() > 0) {
-                 TLorentzVector tempBjet;
+                 FourVector tempBjet;
                  float smearValue = event.jetSmearValue[event.bTagIndex[0]];
                  tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
                  tempBjet *= smearValue;
-                 return { float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).M()) };
+                 return values.add(float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).M()));
              }
              else {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"topPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() > 0) {
-                 TLorentzVector tempBjet;
+                 FourVector tempBjet;
                  float smearValue = event.jetSmearValue[event.bTagIndex[0]];
                  tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
                  tempBjet *= smearValue;
-                 return { float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Pt()) };
+                 return values.add(float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Pt()));
              }
              else {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"topEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() > 0) {
-                 TLorentzVector tempBjet;
+                 FourVector tempBjet;
                  float smearValue = event.jetSmearValue[event.bTagIndex[0]];
                  tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
                  tempBjet *= smearValue;
-                 return { float (std::abs((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Eta())) };
+                 return values.add(float (std::abs((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Eta())));
              }
              else {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"topPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() > 0) {
-                 TLorentzVector tempBjet;
+                 FourVector tempBjet;
                  float smearValue = event.jetSmearValue[event.bTagIndex[0]];
                  tempBjet.SetPtEtaPhiE(
                      event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]],
@@ -976,204 +1023,203 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]],
                      event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
                  tempBjet *= smearValue;
-                 return { float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Phi()) };
+                 return values.add(float ((tempBjet + event.wPairQuarks.first + event.wPairQuarks.second).Phi()));
              }
              else {
-                 return {};
+                 return values;
              }
-         }},
+         })},
         {"lep1D0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATD0PV[event.electronIndexTight[0]]};
+                 return event.elePF2PATD0PV[event.electronIndexTight[0]];
              }
              else {
-              	 return {event.muonPF2PATDBPV[event.muonIndexTight[0]]};
+              	 return event.muonPF2PATDBPV[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep1D0Sig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATImpactTransSignificance[event.electronIndexTight[0]]};
+                 return event.elePF2PATImpactTransSignificance[event.electronIndexTight[0]];
              }
              else {
-                 return { float ((std::abs(event.muonPF2PATDBPV[event.muonIndexTight[0]]))/(event.muonPF2PATDBPVError[event.muonIndexTight[0]] + 1.0e-06)) };
+                 return float ((std::abs(event.muonPF2PATDBPV[event.muonIndexTight[0]]))/(event.muonPF2PATDBPVError[event.muonIndexTight[0]] + 1.0e-06));
              }
-         }},
+         })},
         {"lep2D0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATD0PV[event.electronIndexTight[1]]};
+                 return event.elePF2PATD0PV[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATDBPV[event.muonIndexTight[1]]};
+                 return event.muonPF2PATDBPV[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"lep2D0Sig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATImpactTransSignificance[event.electronIndexTight[1]]};
+                 return event.elePF2PATImpactTransSignificance[event.electronIndexTight[1]];
              }
              else {
-              	 return { float ((std::abs(event.muonPF2PATDBPV[event.muonIndexTight[1]]))/(event.muonPF2PATDBPVError[event.muonIndexTight[1]] + 1.0e-06)) };
+              	 return float ((std::abs(event.muonPF2PATDBPV[event.muonIndexTight[1]]))/(event.muonPF2PATDBPVError[event.muonIndexTight[1]] + 1.0e-06));
              }
-         }},
+         })},
         {"lep1DZ",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATDZPV[event.electronIndexTight[0]]};
+                 return event.elePF2PATDZPV[event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATDZPV[event.muonIndexTight[0]]};
+                 return event.muonPF2PATDZPV[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep1DZSig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATImpact3DSignificance[event.electronIndexTight[0]]};
+                 return event.elePF2PATImpact3DSignificance[event.electronIndexTight[0]];
              }
              else {
-              	 return { float ((std::abs(event.muonPF2PATDZPV[event.muonIndexTight[0]]))/(event.muonPF2PATDZPVError[event.muonIndexTight[0]] + 1.0e-06)) };
+              	 return float ((std::abs(event.muonPF2PATDZPV[event.muonIndexTight[0]]))/(event.muonPF2PATDZPVError[event.muonIndexTight[0]] + 1.0e-06));
              }
-         }},
+         })},
         {"lep2DZ",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATDZPV[event.electronIndexTight[1]]};
+                 return event.elePF2PATDZPV[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATDZPV[event.muonIndexTight[1]]};
+                 return event.muonPF2PATDZPV[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"lep2DZSig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATImpact3DSignificance[event.electronIndexTight[1]]};
+                 return event.elePF2PATImpact3DSignificance[event.electronIndexTight[1]];
              }
              else {
-              	 return { float ((std::abs(event.muonPF2PATDZPV[event.muonIndexTight[1]]))/(event.muonPF2PATDZPVError[event.muonIndexTight[1]] + 1.0e-06)) };
+              	 return float ((std::abs(event.muonPF2PATDZPV[event.muonIndexTight[1]]))/(event.muonPF2PATDZPVError[event.muonIndexTight[1]] + 1.0e-06));
              }
-         }},
+         })},
         {"lep1DBD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATTrackDBD0[event.electronIndexTight[0]]};
+                 return event.elePF2PATTrackDBD0[event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATTrackDBD0[event.muonIndexTight[0]]};
+                 return event.muonPF2PATTrackDBD0[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2DBD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATTrackDBD0[event.electronIndexTight[1]]};
+                 return event.elePF2PATTrackDBD0[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATTrackDBD0[event.muonIndexTight[1]]};
+                 return event.muonPF2PATTrackDBD0[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"lep1BeamSpotCorrectedD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATBeamSpotCorrectedTrackD0
-                             [event.electronIndexTight[0]]};
+                 return event.elePF2PATBeamSpotCorrectedTrackD0
+                             [event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATBeamSpotCorrectedD0[event.muonIndexTight[0]]};
+                 return event.muonPF2PATBeamSpotCorrectedD0[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2BeamSpotCorrectedD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if (event.electronIndexTight.size() > 1) {
-                 return {event.elePF2PATBeamSpotCorrectedTrackD0[event.electronIndexTight[1]]};
+                 return event.elePF2PATBeamSpotCorrectedTrackD0[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATBeamSpotCorrectedD0[event.muonIndexTight[1]]};
+                 return event.muonPF2PATBeamSpotCorrectedD0[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"lep1InnerTrackD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.electronIndexTight.size() > 1) {
-                 return {};
+                 return values;
              }
              else {
-                 return {
-                     event.muonPF2PATDBInnerTrackD0[event.muonIndexTight[0]]};
+                 return values.add(event.muonPF2PATDBInnerTrackD0[event.muonIndexTight[0]]);
              }
-         }},
+         })},
         {"lep2InnerTrackD0",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.electronIndexTight.size() > 1) {
-                 return {};
+                 return values;
              }
              else {
-                 return {event.muonPF2PATDBInnerTrackD0[event.muonIndexTight[1]]};
+                 return values.add(event.muonPF2PATDBInnerTrackD0[event.muonIndexTight[1]]);
              }
-         }},
+         })},
         {"lep1ImpactTransDist",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransDist[event.electronIndexTight[0]]};
+                 return event.elePF2PATImpactTransDist[event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATImpactTransDist[event.muonIndexTight[0]]};
+                 return event.muonPF2PATImpactTransDist[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2ImpactTransDist",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransDist[event.electronIndexTight[1]]};
+                 return event.elePF2PATImpactTransDist[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATImpactTransDist[event.muonIndexTight[1]]};
+                 return event.muonPF2PATImpactTransDist[event.muonIndexTight[1]];
              }
-         }},
+         })},
 	{"lep1ImpactTransError",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransError[event.electronIndexTight[0]]};
+                 return event.elePF2PATImpactTransError[event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATImpactTransError[event.muonIndexTight[0]]};
+                 return event.muonPF2PATImpactTransError[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2ImpactTransError",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransError[event.electronIndexTight[1]]};
+                 return event.elePF2PATImpactTransError[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATImpactTransError[event.muonIndexTight[1]]};
+                 return event.muonPF2PATImpactTransError[event.muonIndexTight[1]];
              }
-         }},
+         })},
 	{"lep1ImpactTransSig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransSignificance[event.electronIndexTight[0]]};
+                 return event.elePF2PATImpactTransSignificance[event.electronIndexTight[0]];
              }
              else {
-                 return {event.muonPF2PATImpactTransSignificance[event.muonIndexTight[0]]};
+                 return event.muonPF2PATImpactTransSignificance[event.muonIndexTight[0]];
              }
-         }},
+         })},
         {"lep2ImpactTransSig",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              if ( event.electronIndexTight.size() > 1 ) {
-                 return {event.elePF2PATImpactTransSignificance[event.electronIndexTight[1]]};
+                 return event.elePF2PATImpactTransSignificance[event.electronIndexTight[1]];
              }
              else {
-                 return {event.muonPF2PATImpactTransSignificance[event.muonIndexTight[1]]};
+                 return event.muonPF2PATImpactTransSignificance[event.muonIndexTight[1]];
              }
-         }},
+         })},
         {"wTransverseMass",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (std::sqrt(2 * event.wPairQuarks.first.Pt() * event.wPairQuarks.second.Pt() * (1 - std::cos(event.wPairQuarks.first.Phi() - event.wPairQuarks.second.Phi()))))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (std::sqrt(2 * event.wPairQuarks.first.Pt() * event.wPairQuarks.second.Pt() * (1 - std::cos(event.wPairQuarks.first.Phi() - event.wPairQuarks.second.Phi()))));
+         })},
         {"jjDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempJet1;
-             TLorentzVector tempJet2;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector tempJet1;
+             FourVector tempJet2;
              if (event.jetIndex.size() < 2) {
-                 return {};
+                 return values;
              }
              float smearValue1 = event.jetSmearValue[event.jetIndex[0]];
              float smearValue2 = event.jetSmearValue[event.jetIndex[1]];
@@ -1181,14 +1227,14 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
              tempJet2.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]], event.jetPF2PATPy[event.jetIndex[1]], event.jetPF2PATPz[event.jetIndex[1]], event.jetPF2PATE[event.jetIndex[1]]);
              tempJet1 *= smearValue1;
              tempJet2 *= smearValue2;
-             return { float (tempJet1.DeltaR(tempJet2)) };
-         }},
+             return values.add(float (tempJet1.DeltaR(tempJet2)));
+         })},
         {"jjDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempJet1;
-             TLorentzVector tempJet2;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector tempJet1;
+             FourVector tempJet2;
              if (event.jetIndex.size() < 2) {
-                 return {};
+                 return values;
              }
              float smearValue1 = event.jetSmearValue[event.jetIndex[0]];
              float smearValue2 = event.jetSmearValue[event.jetIndex[1]];
@@ -1196,193 +1242,193 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
              tempJet2.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[1]], event.jetPF2PATPy[event.jetIndex[1]], event.jetPF2PATPz[event.jetIndex[1]], event.jetPF2PATE[event.jetIndex[1]]);
              tempJet1 *= smearValue1;
              tempJet2 *= smearValue2;
-             return { float (tempJet1.DeltaPhi(tempJet2)) };
-         }},
+             return values.add(float (tempJet1.DeltaPhi(tempJet2)));
+         })},
         {"wwDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() < 3) {
-                 return {};
+                 return values;
              }
-             return { float (event.wPairQuarks.first.DeltaR(event.wPairQuarks.second)) };
-         }},
+             return values.add(float (event.wPairQuarks.first.DeltaR(event.wPairQuarks.second)));
+         })},
         {"wwDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.jetIndex.size() < 3) {
-                 return {};
+                 return values;
              }
-             return { float (event.wPairQuarks.first.DeltaPhi(event.wPairQuarks.second)) };
-         }},
+             return values.add(float (event.wPairQuarks.first.DeltaPhi(event.wPairQuarks.second)));
+         })},
         {"lbDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempJet1;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector tempJet1;
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
              float smearValue = event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]];
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (tempJet1.DeltaR(event.wLepton)) };
-         }},
+             return values.add(float (tempJet1.DeltaR(event.wLepton)));
+         })},
         {"lbDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempJet1;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
+             FourVector tempJet1;
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
              float smearValue = event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]];
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (tempJet1.DeltaPhi(event.wLepton)) };
-         }},
+             return values.add(float (tempJet1.DeltaPhi(event.wLepton)));
+         })},
         {"zLepDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaR(event.zPairLeptons.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaR(event.zPairLeptons.second));
+         })},
         {"zLepDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaPhi(event.zPairLeptons.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaPhi(event.zPairLeptons.second));
+         })},
         {"zLepDelZ",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.Z() - event.zPairLeptons.second.Z()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.Z() - event.zPairLeptons.second.Z());
+         })},
         {"zLepDelRRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float (event.zPairLeptonsRefitted.first.DeltaR(event.zPairLeptonsRefitted.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptonsRefitted.first.DeltaR(event.zPairLeptonsRefitted.second));
+         })},
         {"zLepDelPhiRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptonsRefitted.first.DeltaPhi(event.zPairLeptonsRefitted.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptonsRefitted.first.DeltaPhi(event.zPairLeptonsRefitted.second));
+         })},
         {"zLepDelZRefit",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptonsRefitted.first.Z() - event.zPairLeptonsRefitted.second.Z()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptonsRefitted.first.Z() - event.zPairLeptonsRefitted.second.Z());
+         })},
         {"zLep1Quark1DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaR(event.wPairQuarks.first)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaR(event.wPairQuarks.first));
+         })},
         {"zLep1Quark1DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaPhi(event.wPairQuarks.first)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaPhi(event.wPairQuarks.first));
+         })},
         {"zLep1Quark2DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaR(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaR(event.wPairQuarks.second));
+         })},
         {"zLep1Quark2DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.first.DeltaPhi(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.first.DeltaPhi(event.wPairQuarks.second));
+         })},
         {"zLep2Quark1DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.DeltaR(event.wPairQuarks.first)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.DeltaR(event.wPairQuarks.first));
+         })},
         {"zLep2Quark1DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.DeltaPhi(event.wPairQuarks.first)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.DeltaPhi(event.wPairQuarks.first));
+         })},
         {"zLep2Quark2DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.DeltaR(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.DeltaR(event.wPairQuarks.second));
+         })},
         {"zLep2Quark2DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float (event.zPairLeptons.second.DeltaPhi(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.zPairLeptons.second.DeltaPhi(event.wPairQuarks.second));
+         })},
         {"zLep1BjetDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
-             TLorentzVector tempJet1;
+             FourVector tempJet1;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]]) };
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (event.zPairLeptons.first.DeltaR(tempJet1)) };
-         }},
+             return values.add(float (event.zPairLeptons.first.DeltaR(tempJet1)));
+         })},
         {"zLep1BjetDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
-             TLorentzVector tempJet1;
+             FourVector tempJet1;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]]) };
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (event.zPairLeptons.first.DeltaPhi(tempJet1)) };
-         }},
+             return values.add(float (event.zPairLeptons.first.DeltaPhi(tempJet1)));
+         })},
         {"zLep2BjetDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
-             TLorentzVector tempJet1;
+             FourVector tempJet1;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]]) };
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (event.zPairLeptons.second.DeltaR(tempJet1)) };
-         }},
+             return values.add(float (event.zPairLeptons.second.DeltaR(tempJet1)));
+         })},
         {"zLep2BjetDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              if (event.bTagIndex.size() < 1) {
-                 return {};
+                 return values;
              }
-             TLorentzVector tempJet1;
+             FourVector tempJet1;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]]) };
              tempJet1.SetPxPyPzE(event.jetPF2PATPx[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPy[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPz[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempJet1 *= smearValue;
-             return { float (event.zPairLeptons.second.DeltaPhi(tempJet1)) };
-         }},
+             return values.add(float (event.zPairLeptons.second.DeltaPhi(tempJet1)));
+         })},
         {"lepHt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).pt);
+         })},
         {"wQuarkHt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).Pt()) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).pt);
+         })},
         {"jetHt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              float jetHt{0.0};
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt = event.jetIndex.begin(); jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
                      jetHt += float (tempJet.Pt());
                  }
              }
-             return { jetHt};
-         }},
+             return jetHt;
+         })},
         {"totHt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              float totHt{0.0};
              totHt +=
-                 (event.zPairLeptons.first + event.zPairLeptons.second).Pt();
+                 event.pairKinematics(Pair::zPair).pt;
              if (event.jetIndex.size() > 0)
              {
                  for (auto jetIt{event.jetIndex.begin()};
                       jetIt != event.jetIndex.end();
                       ++jetIt)
                  {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
                      totHt += float (tempJet.Pt());
                  }
              }
-             return {totHt};
-         }},
+             return totHt;
+         })},
         {"totHtOverPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              float totHt{0.0};
-             totHt += float ((event.zPairLeptons.first + event.zPairLeptons.second).Pt());
+             totHt += float (event.pairKinematics(Pair::zPair).pt);
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt{event.jetIndex.begin()}; jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
@@ -1391,11 +1437,11 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
              }
              float totPx{0.0};
              float totPy{0.0};
-             totPx += float ((event.zPairLeptons.first + event.zPairLeptons.second).Px());
-             totPy += float ((event.zPairLeptons.first + event.zPairLeptons.second).Py());
+             totPx += float (event.pairKinematics(Pair::zPair).sum.Px());
+             totPy += float (event.pairKinematics(Pair::zPair).sum.Py());
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt{event.jetIndex.begin()}; jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
@@ -1404,17 +1450,17 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                  }
              }
 
-             return {totHt / std::sqrt(totPx * totPx + totPy * totPy)};
-         }},
+             return totHt / std::sqrt(totPx * totPx + totPy * totPy);
+         })},
         {"totPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
+         scalarFill([](const AnalysisEvent& event) -> float {
              float totPx{0.0};
              float totPy{0.0};
-             totPx += float ((event.zPairLeptons.first + event.zPairLeptons.second).Px());
-             totPy += float ((event.zPairLeptons.first + event.zPairLeptons.second).Py());
+             totPx += float (event.pairKinematics(Pair::zPair).sum.Px());
+             totPy += float (event.pairKinematics(Pair::zPair).sum.Py());
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt{event.jetIndex.begin()}; jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
@@ -1422,149 +1468,145 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                      totPy += float (tempJet.Py());
                  }
              }
-             return {std::sqrt(totPx * totPx + totPy * totPy)};
-         }},
+             return std::sqrt(totPx * totPx + totPy * totPy);
+         })},
         {"totEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totVec;
-             totVec = event.zPairLeptons.first + event.zPairLeptons.second;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector totVec;
+             totVec = event.pairKinematics(Pair::zPair).sum;
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt{event.jetIndex.begin()}; jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
                  }
              }
-             return { float (std::abs(totVec.Eta())) };
-         }},
+             return float (std::abs(totVec.Eta()));
+         })},
         {"totM",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector totVec;
-             totVec = event.zPairLeptons.first + event.zPairLeptons.second;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector totVec;
+             totVec = event.pairKinematics(Pair::zPair).sum;
              if (event.jetIndex.size() > 0) {
                  for (auto jetIt{event.jetIndex.begin()}; jetIt != event.jetIndex.end(); ++jetIt) {
-                     TLorentzVector tempJet;
+                     FourVector tempJet;
                      float smearValue{ float (event.jetSmearValue[*jetIt]) };
                      tempJet.SetPxPyPzE(event.jetPF2PATPx[*jetIt], event.jetPF2PATPy[*jetIt], event.jetPF2PATPz[*jetIt], event.jetPF2PATE[*jetIt]);
                      tempJet *= smearValue;
                      totVec += tempJet;
                  }
              }
-             return { float (totVec.M()) };
-         }},
+             return float (totVec.M());
+         })},
         {"wzDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.wPairQuarks.first + event.wPairQuarks.second));
+         })},
         {"wzDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second));
+         })},
         {"zQuark1DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR(event.wPairQuarks.first))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.wPairQuarks.first));
+         })},
         {"zQuark1DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.first))};
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.wPairQuarks.first));
+         })},
         {"zQuark2DelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.wPairQuarks.second));
+         })},
         {"zQuark2DelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.second)) };
-         }},
+         scalarFill([](const AnalysisEvent& event) -> float {
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.wPairQuarks.second));
+         })},
         {"zTopDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]])};
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
         {"zTopDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]])};
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.first + event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
+             return float (event.pairKinematics(Pair::zPair).sum.DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
         {"zl1TopDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]])};
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.first).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
+             return float ((event.zPairLeptons.first).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
         {"zl1TopDelPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]])};
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.first).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
+             return float ((event.zPairLeptons.first).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
         {"zl2TopDelR",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+         scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float (event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]])};
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.second).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
+             return float ((event.zPairLeptons.second).DeltaR(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
         {"allJetEta",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             std::vector<float> etas;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              for (const auto& i : event.jetIndex) {
                  float smearValue = event.jetSmearValue[i];
-                 TLorentzVector tempJet{event.jetPF2PATPx[i], event.jetPF2PATPy[i], event.jetPF2PATPz[i], event.jetPF2PATE[i]};
+                 FourVector tempJet{event.jetPF2PATPx[i], event.jetPF2PATPy[i], event.jetPF2PATPz[i], event.jetPF2PATE[i]};
                  tempJet *= smearValue;
-                 etas.emplace_back(float (tempJet.Eta()) );
+                 values.add(float (tempJet.Eta()) );
              }
-             return etas;
-         }},
+             return values;
+         })},
         {"allJetPhi",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             std::vector<float> phis;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              for (const auto& i : event.jetIndex) {
                  float smearValue = event.jetSmearValue[i];
-                 TLorentzVector tempJet{event.jetPF2PATPx[i], event.jetPF2PATPy[i], event.jetPF2PATPz[i], event.jetPF2PATE[i]};
+                 FourVector tempJet{event.jetPF2PATPx[i], event.jetPF2PATPy[i], event.jetPF2PATPz[i], event.jetPF2PATE[i]};
                  tempJet *= smearValue;
-                 phis.emplace_back(float (tempJet.Phi()));
+                 values.add(float (tempJet.Phi()));
              }
-             return phis;
-         }},
+             return values;
+         })},
         {"allJetPt",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             std::vector<float> pts;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              for (const auto& i : event.jetIndex) {
                  float smearValue = event.jetSmearValue[i];
-                 TLorentzVector tempJet{event.jetPF2PATPx[i],
+                 FourVector tempJet{event.jetPF2PATPx[i],
                                         event.jetPF2PATPy[i],
                                         event.jetPF2PATPz[i],
                                         event.jetPF2PATE[i]};
                  tempJet *= smearValue;
-                 pts.emplace_back(tempJet.Pt());
+                 values.add(tempJet.Pt());
              }
-             return pts;
-         }},
+             return values;
+         })},
         {"allJetDeltaRLep",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             std::vector<float> dRs;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              for (const auto& i : event.jetIndex)
              {
                  float smearValue = event.jetSmearValue[i];
-                 TLorentzVector tempJet{event.jetPF2PATPx[i],
+                 FourVector tempJet{event.jetPF2PATPx[i],
                                         event.jetPF2PATPy[i],
                                         event.jetPF2PATPz[i],
                                         event.jetPF2PATE[i]};
                  tempJet *= smearValue;
-                 dRs.emplace_back(
+                 values.add(
                      std::min(Cuts::deltaR(event.zPairLeptons.first.Eta(),
                                            event.zPairLeptons.first.Phi(),
                                            tempJet.Eta(),
@@ -1574,201 +1616,390 @@ std::unordered_map<std::string, std::function<std::vector<float>(const AnalysisE
                                            tempJet.Eta(),
                                            tempJet.Phi())));
              }
-             return dRs;
-         }},
+             return values;
+         })},
         {"allJetBDisc",
-         [](const AnalysisEvent& event) -> std::vector<float> {
-             std::vector<float> discs;
+         listFill([](const AnalysisEvent& event, FillValues& values) -> FillValues& {
              for (const auto& i : event.jetIndex)
              {
-                 discs.emplace_back(
+                 values.add(
                      event.jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags
                          [i]);
              }
-             return discs;
-         }},
-        {"zl2TopDelPhi", [](const AnalysisEvent& event) -> std::vector<float> {
-             TLorentzVector tempBjet;
+             return values;
+         })},
+        {"zl2TopDelPhi", scalarFill([](const AnalysisEvent& event) -> float {
+             FourVector tempBjet;
              float smearValue{ float(event.jetSmearValue[event.jetIndex[event.bTagIndex[0]]]) };
              tempBjet.SetPtEtaPhiE(event.jetPF2PATPt[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATEta[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATPhi[event.jetIndex[event.bTagIndex[0]]], event.jetPF2PATE[event.jetIndex[event.bTagIndex[0]]]);
              tempBjet *= smearValue;
-             return { float ((event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet)) };
-         }},
-        {"mumuVtxPx", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVtxPx[event.mumuTrkIndex]};
-         }},
-        {"mumuVtxPy", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVtxPy[event.mumuTrkIndex]};
-         }},
-        {"mumuVtxPz", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVtxPz[event.mumuTrkIndex]};
-         }},
-        {"mumuVtxP", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {std::sqrt( event.muonTkPairPF2PATTkVtxP2[event.mumuTrkIndex] )};
-         }},
-	{"mumuVx", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVx[event.mumuTrkIndex]};
-         }},
-	{"mumuVy", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVy[event.mumuTrkIndex]};
-         }},
-	{"mumuVz", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTkVz[event.mumuTrkIndex]};
-         }},
-	{"mumuVxy", [](const AnalysisEvent& event) -> std::vector<float> {
-             float vx {event.muonTkPairPF2PATTkVx[event.mumuTrkIndex]}, vy {event.muonTkPairPF2PATTkVy[event.mumuTrkIndex]};
-             return { std::sqrt(vx*vx + vy*vy) };
-         }},
-	{"mumuVabs", [](const AnalysisEvent& event) -> std::vector<float> {
-             float vx {event.muonTkPairPF2PATTkVx[event.mumuTrkIndex]}, vy {event.muonTkPairPF2PATTkVy[event.mumuTrkIndex]}, vz {event.muonTkPairPF2PATTkVz[event.mumuTrkIndex]};
-             return { std::sqrt(vx*vx + vy*vy + vz*vz) };
-         }},
-	{"mumuVtxChi2Ndof", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06)) };
-         }},
-	{"mumuVtxAngleXY", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxAngleXY[event.mumuTrkIndex])) };
-         }},
-        {"mumuVtxAngleXYZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxAngleXYZ[event.mumuTrkIndex])) };
-         }},
-        {"mumuVtxSigXY", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxDistMagXY[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxDistMagXYSigma[event.mumuTrkIndex]+1.0e-06)) };
-         }},
-	{"mumuVtxSigXYZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxDistMagXYZ[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxDistMagXYZSigma[event.mumuTrkIndex]+1.0e-06)) };
-         }},
-	{"mumuVtxDca", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTkVtxDcaPreFit[event.mumuTrkIndex])) };
-         }},
-        {"mumuTrkInnerPtOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkPt[event.zPairIndex.first]};
-         }},
-        {"mumuTrkInnerEtaOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkEta[event.zPairIndex.first]};
-         }},
-        {"mumuTrkInnerChi2NdofOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkNormChi2[event.zPairIndex.first]};
-         }},
-        {"mumuTrkInnerPtOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkPt[event.zPairIndex.second]};
-         }},
-        {"mumuTrkInnerEtaOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkEta[event.zPairIndex.second]};
-         }},
-        {"mumuTrkInnerChi2NdofOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonPF2PATInnerTkNormChi2[event.zPairIndex.second]};
-         }},
-	{"mumuTrkInnerPtNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTk1Pt[event.mumuTrkIndex]};
-         }},
-	{"mumuTrkInnerEtaNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTk2Eta[event.mumuTrkIndex]};
-         }},
-	{"mumuTrkInnerChi2NdofNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTk1Chi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTk1Ndof[event.mumuTrkIndex]+1.0e-06)) };
-         }},
-	{"mumuTrkInnerPtNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTk2Pt[event.mumuTrkIndex]};
-         }},
-	{"mumuTrkInnerEtaNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.muonTkPairPF2PATTk2Eta[event.mumuTrkIndex]};
-         }},
-	{"mumuTrkInnerChi2NdofNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.muonTkPairPF2PATTk2Chi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTk2Ndof[event.mumuTrkIndex]+1.0e-06)) };
-         }},
-        {"dichsVtxPx", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVtxPx[event.chsPairTrkIndex]};
-         }},
-        {"dichsVtxPy", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVtxPy[event.chsPairTrkIndex]};
-         }},
-        {"dichsVtxPz", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVtxPz[event.chsPairTrkIndex]};
-         }},
-        {"dichsVtxP", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {std::sqrt( event.chsTkPairTkVtxP2[event.chsPairTrkIndex] )};
-         }},
-	{"dichsVx", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVx[event.chsPairTrkIndex]};
-         }},
-	{"dichsVy", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVy[event.chsPairTrkIndex]};
-         }},
-	{"dichsVz", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTkVz[event.chsPairTrkIndex]};
-         }},
-	{"dichsVxy", [](const AnalysisEvent& event) -> std::vector<float> {
-             float vx {event.chsTkPairTkVx[event.chsPairTrkIndex]}, vy {event.chsTkPairTkVy[event.chsPairTrkIndex]};
-             return { std::sqrt(vx*vx + vy*vy) };
-         }},
-	{"dichsVabs", [](const AnalysisEvent& event) -> std::vector<float> {
-             float vx {event.chsTkPairTkVx[event.chsPairTrkIndex]}, vy {event.chsTkPairTkVy[event.chsPairTrkIndex]}, vz {event.chsTkPairTkVz[event.chsPairTrkIndex]};
-             return { std::sqrt(vx*vx + vy*vy + vz*vz) };
-         }},
-	{"dichsVtxChi2Ndof", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsTkPairTkVtxChi2[event.chsPairTrkIndex])/(event.chsTkPairTkVtxNdof[event.chsPairTrkIndex]+1.0e-06)) };
-         }},
-	{"dichsVtxAngleXY", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {(event.chsTkPairTkVtxAngleXY[event.chsPairTrkIndex])};
-         }},
-        {"dichsVtxAngleXYZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {(event.chsTkPairTkVtxAngleXYZ[event.chsPairTrkIndex])};         
-         }},
-        {"dichsVtxSigXY", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsTkPairTkVtxDistMagXY[event.chsPairTrkIndex])/(event.chsTkPairTkVtxDistMagXYSigma[event.chsPairTrkIndex]+1.0e-06)) };
-         }},
-	{"dichsVtxSigXYZ", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsTkPairTkVtxDistMagXYZ[event.chsPairTrkIndex])/(event.chsTkPairTkVtxDistMagXYZSigma[event.chsPairTrkIndex]+1.0e-06)) };
-         }},
-	{"dichsVtxDca", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {(event.chsTkPairTkVtxDcaPreFit[event.chsPairTrkIndex])};
-         }},
-        {"dichsTrkInnerPtOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float(event.chsPairTrkVec.first.Pt())};
-         }},
-        {"dichsTrkInnerEtaOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float(event.chsPairTrkVec.first.Eta())};
-         }},
-        {"dichsTrkInnerChi2NdofOld1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.packedCandsPseudoTrkChi2Norm[event.chsPairIndex.first]};
-         }},
-        {"dichsTrkInnerPtOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float(event.chsPairTrkVec.second.Pt())};
-         }},
-        {"dichsTrkInnerEtaOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {float(event.chsPairTrkVec.second.Eta())};
-         }},
-        {"dichsTrkInnerChi2NdofOld2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.packedCandsPseudoTrkChi2Norm[event.chsPairIndex.second]};
-         }},
-	{"dichsTrkInnerPtNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTk1Pt[event.chsPairTrkIndex]};
-         }},
-	{"dichsTrkInnerEtaNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTk2Eta[event.chsPairTrkIndex]};
-         }},
-	{"dichsTrkInnerChi2NdofNew1", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsTkPairTk1Chi2[event.chsPairTrkIndex])/(event.chsTkPairTk1Ndof[event.chsPairTrkIndex]+1.0e-06)) };
-         }},
-	{"dichsTrkInnerPtNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTk2Pt[event.chsPairTrkIndex]};
-         }},
-	{"dichsTrkInnerEtaNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return {event.chsTkPairTk2Eta[event.chsPairTrkIndex]};
-         }},
-	{"dichsTrkInnerChi2NdofNew2", [](const AnalysisEvent& event) -> std::vector<float> {
-             return { float ((event.chsTkPairTk2Chi2[event.chsPairTrkIndex])/(event.chsTkPairTk2Ndof[event.chsPairTrkIndex]+1.0e-06)) };
-         }}
+             return float ((event.zPairLeptons.second).DeltaPhi(event.wPairQuarks.first + event.wPairQuarks.second + tempBjet));
+         })},
+        {"mumuVtxPx", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVtxPx[event.mumuTrkIndex];
+         })},
+        {"mumuVtxPy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVtxPy[event.mumuTrkIndex];
+         })},
+        {"mumuVtxPz", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVtxPz[event.mumuTrkIndex];
+         })},
+        {"mumuVtxP", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).p;
+         })},
+	{"mumuVx", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVx[event.mumuTrkIndex];
+         })},
+	{"mumuVy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVy[event.mumuTrkIndex];
+         })},
+	{"mumuVz", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTkVz[event.mumuTrkIndex];
+         })},
+	{"mumuVxy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).vxy;
+         })},
+	{"mumuVabs", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).vabs;
+         })},
+	{"mumuVtxChi2Ndof", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).chi2Ndof;
+         })},
+	{"mumuVtxAngleXY", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.muonTkPairPF2PATTkVtxAngleXY[event.mumuTrkIndex]));
+         })},
+        {"mumuVtxAngleXYZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.muonTkPairPF2PATTkVtxAngleXYZ[event.mumuTrkIndex]));
+         })},
+        {"mumuVtxSigXY", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).sigXY;
+         })},
+	{"mumuVtxSigXYZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::mumu).sigXYZ;
+         })},
+	{"mumuVtxDca", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.muonTkPairPF2PATTkVtxDcaPreFit[event.mumuTrkIndex]));
+         })},
+        {"mumuTrkInnerPtOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkPt[event.zPairIndex.first];
+         })},
+        {"mumuTrkInnerEtaOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkEta[event.zPairIndex.first];
+         })},
+        {"mumuTrkInnerChi2NdofOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkNormChi2[event.zPairIndex.first];
+         })},
+        {"mumuTrkInnerPtOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkPt[event.zPairIndex.second];
+         })},
+        {"mumuTrkInnerEtaOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkEta[event.zPairIndex.second];
+         })},
+        {"mumuTrkInnerChi2NdofOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonPF2PATInnerTkNormChi2[event.zPairIndex.second];
+         })},
+	{"mumuTrkInnerPtNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTk1Pt[event.mumuTrkIndex];
+         })},
+	{"mumuTrkInnerEtaNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTk2Eta[event.mumuTrkIndex];
+         })},
+	{"mumuTrkInnerChi2NdofNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.muonTkPairPF2PATTk1Chi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTk1Ndof[event.mumuTrkIndex]+1.0e-06));
+         })},
+	{"mumuTrkInnerPtNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTk2Pt[event.mumuTrkIndex];
+         })},
+	{"mumuTrkInnerEtaNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.muonTkPairPF2PATTk2Eta[event.mumuTrkIndex];
+         })},
+	{"mumuTrkInnerChi2NdofNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.muonTkPairPF2PATTk2Chi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTk2Ndof[event.mumuTrkIndex]+1.0e-06));
+         })},
+        {"dichsVtxPx", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVtxPx[event.chsPairTrkIndex];
+         })},
+        {"dichsVtxPy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVtxPy[event.chsPairTrkIndex];
+         })},
+        {"dichsVtxPz", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVtxPz[event.chsPairTrkIndex];
+         })},
+        {"dichsVtxP", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).p;
+         })},
+	{"dichsVx", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVx[event.chsPairTrkIndex];
+         })},
+	{"dichsVy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVy[event.chsPairTrkIndex];
+         })},
+	{"dichsVz", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTkVz[event.chsPairTrkIndex];
+         })},
+	{"dichsVxy", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).vxy;
+         })},
+	{"dichsVabs", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).vabs;
+         })},
+	{"dichsVtxChi2Ndof", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).chi2Ndof;
+         })},
+	{"dichsVtxAngleXY", scalarFill([](const AnalysisEvent& event) -> float {
+             return (event.chsTkPairTkVtxAngleXY[event.chsPairTrkIndex]);
+         })},
+        {"dichsVtxAngleXYZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return (event.chsTkPairTkVtxAngleXYZ[event.chsPairTrkIndex]);         
+         })},
+        {"dichsVtxSigXY", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).sigXY;
+         })},
+	{"dichsVtxSigXYZ", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.vertexQuantities(Vertex::dichs).sigXYZ;
+         })},
+	{"dichsVtxDca", scalarFill([](const AnalysisEvent& event) -> float {
+             return (event.chsTkPairTkVtxDcaPreFit[event.chsPairTrkIndex]);
+         })},
+        {"dichsTrkInnerPtOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return float(event.chsPairTrkVec.first.Pt());
+         })},
+        {"dichsTrkInnerEtaOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return float(event.chsPairTrkVec.first.Eta());
+         })},
+        {"dichsTrkInnerChi2NdofOld1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.packedCandsPseudoTrkChi2Norm[event.chsPairIndex.first];
+         })},
+        {"dichsTrkInnerPtOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return float(event.chsPairTrkVec.second.Pt());
+         })},
+        {"dichsTrkInnerEtaOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return float(event.chsPairTrkVec.second.Eta());
+         })},
+        {"dichsTrkInnerChi2NdofOld2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.packedCandsPseudoTrkChi2Norm[event.chsPairIndex.second];
+         })},
+	{"dichsTrkInnerPtNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTk1Pt[event.chsPairTrkIndex];
+         })},
+	{"dichsTrkInnerEtaNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTk2Eta[event.chsPairTrkIndex];
+         })},
+	{"dichsTrkInnerChi2NdofNew1", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.chsTkPairTk1Chi2[event.chsPairTrkIndex])/(event.chsTkPairTk1Ndof[event.chsPairTrkIndex]+1.0e-06));
+         })},
+	{"dichsTrkInnerPtNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTk2Pt[event.chsPairTrkIndex];
+         })},
+	{"dichsTrkInnerEtaNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return event.chsTkPairTk2Eta[event.chsPairTrkIndex];
+         })},
+	{"dichsTrkInnerChi2NdofNew2", scalarFill([](const AnalysisEvent& event) -> float {
+             return float ((event.chsTkPairTk2Chi2[event.chsPairTrkIndex])/(event.chsTkPairTk2Ndof[event.chsPairTrkIndex]+1.0e-06));
+         })}
+    };
+} // namespace
+
+const FillExpression& Plots::getFillExpression(const std::string& name) {
+    for (const auto& expression : fillExpressions) {
+        if (name == expression.name) {
+            return expression.fill;
+        }
+    }
+    throw std::out_of_range("Unknown fill expression " + name);
+}
+
+std::unordered_map<std::string, std::vector<std::string>> Plots::getBranchMap() {
+    // Ntuple branches read directly by each fill expression. Expressions that
+    // only use quantities filled by Cuts (zPairLeptons, chsPairVec, ...) don't
+    // need an entry. Every name must be one of fillExpressions, which is
+    // checked below.
+    std::unordered_map<std::string, std::vector<std::string>> branchMap{
+        {"lep1Pt", {"elePF2PATE", "elePF2PATPX", "elePF2PATPY", "elePF2PATPZ", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"lep1Eta", {"elePF2PATSCEta", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"lep2Pt", {"elePF2PATE", "elePF2PATPX", "elePF2PATPY", "elePF2PATPZ", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"lep2Eta", {"elePF2PATSCEta", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"lep1RelIso", {"elePF2PATComRelIsoRho", "muonPF2PATComRelIsodBeta"}},
+        {"lep2RelIso", {"elePF2PATComRelIsoRho", "muonPF2PATComRelIsodBeta"}},
+        {"lep1Phi", {"elePF2PATPhi", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"lep2Phi", {"elePF2PATPhi", "muonPF2PATE", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ"}},
+        {"met", {"metPF2PATEt"}},
+        {"totalJetMass", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totalJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totalJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totalJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"leadingJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"leadingJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"leadingJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"leadingJetDeltaRLep", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"leadingJetBDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"secondJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"secondJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"secondJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"secondJetBDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"secondJetDeltaRLep", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"thirdJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"thirdJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"thirdJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"thirdJetBDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"thirdJetDeltaRLep", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"fourthJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"fourthJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"fourthJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"fourthJetBDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"fourthJetDeltaRLep", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"bTagDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"discalarMassNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"discalarDeltaMassNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"discalarDeltaRNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"discalarMassRefitNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"discalarDeltaMassRefitNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"discalarDeltaRRefitNew", {"muonPF2PATPackedCandIndex", "packedCandsE", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy", "packedCandsPseudoTrkPz"}},
+        {"topMass", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"topPt", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"topEta", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"topPhi", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"lep1D0", {"elePF2PATD0PV", "muonPF2PATDBPV"}},
+        {"lep1D0Sig", {"elePF2PATImpactTransSignificance", "muonPF2PATDBPV", "muonPF2PATDBPVError"}},
+        {"lep2D0", {"elePF2PATD0PV", "muonPF2PATDBPV"}},
+        {"lep2D0Sig", {"elePF2PATImpactTransSignificance", "muonPF2PATDBPV", "muonPF2PATDBPVError"}},
+        {"lep1DZ", {"elePF2PATDZPV", "muonPF2PATDZPV"}},
+        {"lep1DZSig", {"elePF2PATImpact3DSignificance", "muonPF2PATDZPV", "muonPF2PATDZPVError"}},
+        {"lep2DZ", {"elePF2PATDZPV", "muonPF2PATDZPV"}},
+        {"lep2DZSig", {"elePF2PATImpact3DSignificance", "muonPF2PATDZPV", "muonPF2PATDZPVError"}},
+        {"lep1DBD0", {"elePF2PATTrackDBD0", "muonPF2PATTrackDBD0"}},
+        {"lep2DBD0", {"elePF2PATTrackDBD0", "muonPF2PATTrackDBD0"}},
+        {"lep1BeamSpotCorrectedD0", {"elePF2PATBeamSpotCorrectedTrackD0", "muonPF2PATBeamSpotCorrectedD0"}},
+        {"lep2BeamSpotCorrectedD0", {"elePF2PATBeamSpotCorrectedTrackD0", "muonPF2PATBeamSpotCorrectedD0"}},
+        {"lep1InnerTrackD0", {"muonPF2PATDBInnerTrackD0"}},
+        {"lep2InnerTrackD0", {"muonPF2PATDBInnerTrackD0"}},
+        {"lep1ImpactTransDist", {"elePF2PATImpactTransDist", "muonPF2PATImpactTransDist"}},
+        {"lep2ImpactTransDist", {"elePF2PATImpactTransDist", "muonPF2PATImpactTransDist"}},
+        {"lep1ImpactTransError", {"elePF2PATImpactTransError", "muonPF2PATImpactTransError"}},
+        {"lep2ImpactTransError", {"elePF2PATImpactTransError", "muonPF2PATImpactTransError"}},
+        {"lep1ImpactTransSig", {"elePF2PATImpactTransSignificance", "muonPF2PATImpactTransSignificance"}},
+        {"lep2ImpactTransSig", {"elePF2PATImpactTransSignificance", "muonPF2PATImpactTransSignificance"}},
+        {"jjDelR", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"jjDelPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"lbDelR", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"lbDelPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"zLep1BjetDelR", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"zLep1BjetDelPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"zLep2BjetDelR", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"zLep2BjetDelPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"jetHt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totHt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totHtOverPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"totM", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"zTopDelR", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"zTopDelPhi", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"zl1TopDelR", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"zl1TopDelPhi", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"zl2TopDelR", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"allJetEta", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"allJetPhi", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"allJetPt", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"allJetDeltaRLep", {"jetPF2PATE", "jetPF2PATPx", "jetPF2PATPy", "jetPF2PATPz"}},
+        {"allJetBDisc", {"jetPF2PATpfCombinedInclusiveSecondaryVertexV2BJetTags"}},
+        {"zl2TopDelPhi", {"jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt"}},
+        {"mumuVtxPx", {"muonTkPairPF2PATTkVtxPx"}},
+        {"mumuVtxPy", {"muonTkPairPF2PATTkVtxPy"}},
+        {"mumuVtxPz", {"muonTkPairPF2PATTkVtxPz"}},
+        {"mumuVtxP", {"muonTkPairPF2PATTkVtxP2"}},
+        {"mumuVx", {"muonTkPairPF2PATTkVx"}},
+        {"mumuVy", {"muonTkPairPF2PATTkVy"}},
+        {"mumuVz", {"muonTkPairPF2PATTkVz"}},
+        {"mumuVxy", {"muonTkPairPF2PATTkVx", "muonTkPairPF2PATTkVy"}},
+        {"mumuVabs", {"muonTkPairPF2PATTkVx", "muonTkPairPF2PATTkVy", "muonTkPairPF2PATTkVz"}},
+        {"mumuVtxChi2Ndof", {"muonTkPairPF2PATTkVtxChi2", "muonTkPairPF2PATTkVtxNdof"}},
+        {"mumuVtxAngleXY", {"muonTkPairPF2PATTkVtxAngleXY"}},
+        {"mumuVtxAngleXYZ", {"muonTkPairPF2PATTkVtxAngleXYZ"}},
+        {"mumuVtxSigXY", {"muonTkPairPF2PATTkVtxDistMagXY", "muonTkPairPF2PATTkVtxDistMagXYSigma"}},
+        {"mumuVtxSigXYZ", {"muonTkPairPF2PATTkVtxDistMagXYZ", "muonTkPairPF2PATTkVtxDistMagXYZSigma"}},
+        {"mumuVtxDca", {"muonTkPairPF2PATTkVtxDcaPreFit"}},
+        {"mumuTrkInnerPtOld1", {"muonPF2PATInnerTkPt"}},
+        {"mumuTrkInnerEtaOld1", {"muonPF2PATInnerTkEta"}},
+        {"mumuTrkInnerChi2NdofOld1", {"muonPF2PATInnerTkNormChi2"}},
+        {"mumuTrkInnerPtOld2", {"muonPF2PATInnerTkPt"}},
+        {"mumuTrkInnerEtaOld2", {"muonPF2PATInnerTkEta"}},
+        {"mumuTrkInnerChi2NdofOld2", {"muonPF2PATInnerTkNormChi2"}},
+        {"mumuTrkInnerPtNew1", {"muonTkPairPF2PATTk1Pt"}},
+        {"mumuTrkInnerEtaNew1", {"muonTkPairPF2PATTk2Eta"}},
+        {"mumuTrkInnerChi2NdofNew1", {"muonTkPairPF2PATTk1Chi2", "muonTkPairPF2PATTk1Ndof"}},
+        {"mumuTrkInnerPtNew2", {"muonTkPairPF2PATTk2Pt"}},
+        {"mumuTrkInnerEtaNew2", {"muonTkPairPF2PATTk2Eta"}},
+        {"mumuTrkInnerChi2NdofNew2", {"muonTkPairPF2PATTk2Chi2", "muonTkPairPF2PATTk2Ndof"}},
+        {"dichsVtxPx", {"chsTkPairTkVtxPx"}},
+        {"dichsVtxPy", {"chsTkPairTkVtxPy"}},
+        {"dichsVtxPz", {"chsTkPairTkVtxPz"}},
+        {"dichsVtxP", {"chsTkPairTkVtxP2"}},
+        {"dichsVx", {"chsTkPairTkVx"}},
+        {"dichsVy", {"chsTkPairTkVy"}},
+        {"dichsVz", {"chsTkPairTkVz"}},
+        {"dichsVxy", {"chsTkPairTkVx", "chsTkPairTkVy"}},
+        {"dichsVabs", {"chsTkPairTkVx", "chsTkPairTkVy", "chsTkPairTkVz"}},
+        {"dichsVtxChi2Ndof", {"chsTkPairTkVtxChi2", "chsTkPairTkVtxNdof"}},
+        {"dichsVtxAngleXY", {"chsTkPairTkVtxAngleXY"}},
+        {"dichsVtxAngleXYZ", {"chsTkPairTkVtxAngleXYZ"}},
+        {"dichsVtxSigXY", {"chsTkPairTkVtxDistMagXY", "chsTkPairTkVtxDistMagXYSigma"}},
+        {"dichsVtxSigXYZ", {"chsTkPairTkVtxDistMagXYZ", "chsTkPairTkVtxDistMagXYZSigma"}},
+        {"dichsVtxDca", {"chsTkPairTkVtxDcaPreFit"}},
+        {"dichsTrkInnerChi2NdofOld1", {"packedCandsPseudoTrkChi2Norm"}},
+        {"dichsTrkInnerChi2NdofOld2", {"packedCandsPseudoTrkChi2Norm"}},
+        {"dichsTrkInnerPtNew1", {"chsTkPairTk1Pt"}},
+        {"dichsTrkInnerEtaNew1", {"chsTkPairTk2Eta"}},
+        {"dichsTrkInnerChi2NdofNew1", {"chsTkPairTk1Chi2", "chsTkPairTk1Ndof"}},
+        {"dichsTrkInnerPtNew2", {"chsTkPairTk2Pt"}},
+        {"dichsTrkInnerEtaNew2", {"chsTkPairTk2Eta"}},
+        {"dichsTrkInnerChi2NdofNew2", {"chsTkPairTk2Chi2", "chsTkPairTk2Ndof"}}
     };
+    for (const auto& entry : branchMap) {
+        if (std::none_of(std::begin(fillExpressions), std::end(fillExpressions), [&entry](const NamedFillExpression& expression) { return entry.first == expression.name; })) {
+            throw std::logic_error("Branch map entry " + entry.first + " has no fill expression");
+        }
+    }
+    return branchMap;
+}
+
+void Plots::fill(const size_t i, const FillValues& values, const double eventWeight) {
+    if (buffers.empty()) {
+        for (const float val : values) {
+            plotPoint[i].plotHist->Fill(val, eventWeight);
+        }
+    }
+    else {
+        buffers[i].fill(values.begin(), values.size(), eventWeight);
+    }
 }
 
 void Plots::fillAllPlots(const AnalysisEvent& event, const double eventWeight)
 {
+    // Fill expressions can touch any collection
+    event.loadAllCollections();
+    FillValues values;
     for (unsigned i{0}; i < plotPoint.size(); i++) {
         if (plotPoint[i].fillPlot) {
-            for (const auto& val : (this->plotPoint[i].fillExp)(event)) {
-                plotPoint[i].plotHist->Fill(val, eventWeight);
+            fill(i, plotPoint[i].fillExp.evaluate(event, values), eventWeight);
+        }
+    }
+}
+
+void Plots::fillAllPlots(const AnalysisEvent& event, const std::vector<Plots*>& plots, const std::vector<double>& eventWeights)
+{
+    if (plots.empty()) {
+        return;
+    }
+    // Fill expressions can touch any collection
+    event.loadAllCollections();
+    const std::vector<plot>& points{plots.front()->plotPoint};
+    FillValues values;
+    for (unsigned i{0}; i < points.size(); i++) {
+        if (points[i].fillPlot) {
+            points[i].fillExp.evaluate(event, values);
+            for (size_t p{0}; p < plots.size(); p++) {
+                plots[p]->fill(i, values, eventWeights[p]);
             }
         }
     }
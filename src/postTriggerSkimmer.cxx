@@ -1,4 +1,4 @@
-#include "AnalysisEvent.hpp"
+#include "triggerEvent.hpp"
 
 #include <TChain.h>
 #include <TFile.h>
@@ -136,7 +136,7 @@ int main(int argc, char* argv[])
                 boost::numeric_cast<unsigned long>(numberOfEvents),
                 std::cout,
                 outFilePath + "\n"};
-            AnalysisEvent event{false, &datasetChain, is2016_, is2018_};
+            TriggerEvent event{false, &datasetChain, is2016_, is2018_};
 
             for (long long int i{0}; i < numberOfEvents; i++)
             {
@@ -235,7 +235,7 @@ int main(int argc, char* argv[])
                 boost::numeric_cast<unsigned long>(numberOfEvents),
                 std::cout,
                 outFilePath + "\n"};
-            AnalysisEvent event{false, &datasetChain, is2016_, is2018_};
+            TriggerEvent event{false, &datasetChain, is2016_, is2018_};
 
             for (long long int i{0}; i < numberOfEvents; i++)
             {
@@ -10,9 +10,9 @@
 #include "TLatex.h"
 #include "TMVA/Timer.h"
 #include "TTree.h"
-#include "TLorentzVector.h"
 #include "TString.h"
 #include "config_parser.hpp"
+#include "fourVector.hpp"
 
 #include <boost/filesystem.hpp>
 #include <boost/functional/hash.hpp>
@@ -44,6 +44,21 @@ float deltaR(float eta1, float phi1, float eta2, float phi2);
 
 namespace fs = boost::filesystem;
 
+// Ntuple branches read by this macro, used with --branchManifest
+const std::vector<std::string> branchManifest_ {
+    "chsTkPairIndex1", "chsTkPairIndex2", "chsTkPairTk1Eta", "chsTkPairTk1P2", "chsTkPairTk1Phi",
+    "chsTkPairTk1Pt", "chsTkPairTk2Eta", "chsTkPairTk2P2", "chsTkPairTk2Phi", "chsTkPairTk2Pt",
+    "genElePF2PATScalarAncestor", "genJetPF2PATScalarAncestor", "genMuonPF2PATDirectScalarAncestor", "genMuonPF2PATScalarAncestor", "muonPF2PATCharge",
+    "muonPF2PATComRelIsodBeta", "muonPF2PATE", "muonPF2PATEta", "muonPF2PATIsPFMuon", "muonPF2PATLooseCutId",
+    "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ", "muonPF2PATPackedCandIndex", "muonPF2PATPfIsoVeryLoose",
+    "muonPF2PATPt", "muonTkPairPF2PATIndex1", "muonTkPairPF2PATIndex2", "muonTkPairPF2PATTk1P2", "muonTkPairPF2PATTk1Px",
+    "muonTkPairPF2PATTk1Py", "muonTkPairPF2PATTk1Pz", "muonTkPairPF2PATTk2P2", "muonTkPairPF2PATTk2Px", "muonTkPairPF2PATTk2Py",
+    "muonTkPairPF2PATTk2Pz", "numChsTrackPairs", "numMuonPF2PAT", "numMuonTrackPairsPF2PAT", "numPackedCands",
+    "packedCandsCharge", "packedCandsE", "packedCandsElectronIndex", "packedCandsFromPV", "packedCandsHasTrackDetails",
+    "packedCandsJetIndex", "packedCandsMuonIndex", "packedCandsPdgId", "packedCandsPhotonIndex", "packedCandsPseudoTrkEta",
+    "packedCandsPseudoTrkPhi", "packedCandsPseudoTrkPt", "packedCandsPx", "packedCandsPy", "packedCandsPz"
+};
+
 // Lepton cut variables
 const float looseMuonEta_ {2.4}, looseMuonPt_ {5.}, looseMuonPtLeading_ {30.}, looseMuonRelIso_ {100.};
 const float chsMass_{0.13957018};
@@ -61,6 +76,7 @@ int main(int argc, char* argv[]) {
     double totalLumi;
     double usePreLumi;
     bool usePostLepTree {false};
+    bool useBranchManifest {false};
    
     std::string outFileString{"plots/distributions/output.root"};
     bool is2016_;
@@ -106,6 +122,9 @@ int main(int argc, char* argv[]) {
         ",u",
         po::bool_switch(&usePostLepTree),
         "Use post lepton selection trees.")(
+        "branchManifest",
+        po::bool_switch(&useBranchManifest),
+        "Only read the ntuple branches this macro uses.")(
         "2016", po::bool_switch(&is2016_), "Use 2016 conditions (SFs, et al.).")(
         "2018", po::bool_switch(&is2018_), "Use 2018 conditions (SFs, et al.).");
     po::variables_map vm;
@@ -194,6 +213,8 @@ int main(int argc, char* argv[]) {
 
         AnalysisEvent event{dataset->isMC(), datasetChain, is2016_, is2018_};
 
+        if (useBranchManifest) event.setBranchManifest(branchManifest_);
+
         Long64_t numberOfEvents{datasetChain->GetEntries()};
         if (nEvents && nEvents < numberOfEvents) numberOfEvents = nEvents;
 
@@ -310,7 +331,7 @@ std::vector<int> getChargedHadronTracks(const AnalysisEvent& event) {
         if (std::abs(event.packedCandsPdgId[k]) != 211) continue;
         if (event.packedCandsCharge[k] == 0 ) continue;
         if (event.packedCandsHasTrackDetails[k] != 1 ) continue;
-        TLorentzVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
+        FourVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
         if (lVec.Pt() < 1.0) continue;
 
         chs.emplace_back(k);
@@ -326,8 +347,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
             if (event.muonPF2PATCharge[muons[i]] * event.muonPF2PATCharge[muons[j]] >= 0) continue;
             if ( mcTruth && (!event.genMuonPF2PATDirectScalarAncestor[muons[i]] || !event.genMuonPF2PATDirectScalarAncestor[muons[j]]) ) continue;
 
-            TLorentzVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
-            TLorentzVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
+            FourVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
+            FourVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
             double delR { lepton1.DeltaR(lepton2) };
             if ( delR < maxDileptonDeltaR_  ) {
                 event.zPairLeptons.first  = lepton1.Pt() > lepton2.Pt() ? lepton1 : lepton2;
@@ -354,7 +375,7 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
                 for (int k = 0; k < event.numPackedCands; k++) {
                     if ( k == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] || k == event.muonPF2PATPackedCandIndex[event.zPairIndex.second] ) continue;
 
-                    TLorentzVector packedCandVec, packedCandTrkVec;
+                    FourVector packedCandVec, packedCandTrkVec;
                     packedCandVec.SetPxPyPzE      (event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);
                     packedCandTrkVec.SetPtEtaPhiE (event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
 
@@ -418,8 +439,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
 
 //                if ( (event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06) > 10. ) continue;
 
-                event.zPairLeptonsRefitted.first  = TLorentzVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
-                event.zPairLeptonsRefitted.second = TLorentzVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.first  = FourVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.second = FourVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
 
                 return true;
             }
@@ -456,8 +477,8 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
 
             if (event.packedCandsCharge[chs[i]] * event.packedCandsCharge[chs[j]] >= 0) continue;
 
-            TLorentzVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
-            TLorentzVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
+            FourVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
+            FourVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
 
             double pT { (chs1+chs2).Pt() };
             double delR { chs1.DeltaR(chs2) };
@@ -470,7 +491,7 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
                 event.chsPairIndex.first = chs1.Pt() > chs2.Pt() ? chs[i] : chs[j];
                 event.chsPairIndex.second = chs1.Pt() > chs2.Pt() ? chs[j] : chs[i];
 
-                TLorentzVector chsTrk1, chsTrk2;
+                FourVector chsTrk1, chsTrk2;
                 chsTrk1.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.first], event.packedCandsPseudoTrkEta[event.chsPairIndex.first], event.packedCandsPseudoTrkPhi[event.chsPairIndex.first], event.packedCandsE[event.chsPairIndex.first]);
                 chsTrk2.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.second], event.packedCandsPseudoTrkEta[event.chsPairIndex.second], event.packedCandsPseudoTrkPhi[event.chsPairIndex.second], event.packedCandsE[event.chsPairIndex.second]);
 
@@ -488,8 +509,8 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
                 for (int k = 0; k < event.numPackedCands; k++) {
                     if ( k == event.chsPairIndex.first || k == event.chsPairIndex.second ) continue;
 
-                    TLorentzVector packedCandVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
-                    TLorentzVector packedCandTrkVec;
+                    FourVector packedCandVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
+                    FourVector packedCandTrkVec;
                     packedCandTrkVec.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
 
                     if ( event.packedCandsCharge[k] == 0 ) {
@@ -559,7 +580,7 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
                 if ( std::isnan(event.chsTkPairTk1P2[event.chsPairTrkIndex])  || std::isnan(event.chsTkPairTk2P2[event.chsPairTrkIndex]) ) return false;
                 if ( std::isnan(event.chsTkPairTk1Phi[event.chsPairTrkIndex]) || std::isnan(event.chsTkPairTk2Phi[event.chsPairTrkIndex]) ) return false;
 
-                TLorentzVector chsTrk1Refitted, chsTrk2Refitted;
+                FourVector chsTrk1Refitted, chsTrk2Refitted;
                 chsTrk1Refitted.SetPtEtaPhiE(event.chsTkPairTk1Pt[event.chsPairTrkIndex], event.chsTkPairTk1Eta[event.chsPairTrkIndex], event.chsTkPairTk1Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk1P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 chsTrk2Refitted.SetPtEtaPhiE(event.chsTkPairTk2Pt[event.chsPairTrkIndex], event.chsTkPairTk2Eta[event.chsPairTrkIndex], event.chsTkPairTk2Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk2P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 event.chsPairTrkVecRefitted.first  = chsTrk1Refitted;
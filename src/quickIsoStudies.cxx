@@ -10,9 +10,9 @@
 #include "TLatex.h"
 #include "TMVA/Timer.h"
 #include "TTree.h"
-#include "TLorentzVector.h"
 #include "TString.h"
 #include "config_parser.hpp"
+#include "fourVector.hpp"
 
 #include <boost/filesystem.hpp>
 #include <boost/functional/hash.hpp>
@@ -40,10 +40,26 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs);
 int getMuonTrackPairIndex(const AnalysisEvent& event);
 int getChsTrackPairIndex(const AnalysisEvent& event);
 bool scalarGrandparent(const AnalysisEvent& event, const Int_t& k, const Int_t& pdgId_);
+std::vector<int> getNearbyPackedCands(const AnalysisEvent& event, const FourVector& first, const FourVector& second);
 float deltaR(float eta1, float phi1, float eta2, float phi2);
 
 namespace fs = boost::filesystem;
 
+// Ntuple branches read by this macro, used with --branchManifest
+const std::vector<std::string> branchManifest_ {
+    "chsTkPairIndex1", "chsTkPairIndex2", "chsTkPairTk1Eta", "chsTkPairTk1P2", "chsTkPairTk1Phi",
+    "chsTkPairTk1Pt", "chsTkPairTk2Eta", "chsTkPairTk2P2", "chsTkPairTk2Phi", "chsTkPairTk2Pt",
+    "genParId", "genParMotherId", "genParMotherIndex", "genParNumDaughters", "muonPF2PATCharge",
+    "muonPF2PATComRelIsodBeta", "muonPF2PATE", "muonPF2PATEta", "muonPF2PATIsPFMuon", "muonPF2PATLooseCutId",
+    "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ", "muonPF2PATPackedCandIndex", "muonPF2PATPt",
+    "muonTkPairPF2PATIndex1", "muonTkPairPF2PATIndex2", "muonTkPairPF2PATTk1P2", "muonTkPairPF2PATTk1Px", "muonTkPairPF2PATTk1Py",
+    "muonTkPairPF2PATTk1Pz", "muonTkPairPF2PATTk2P2", "muonTkPairPF2PATTk2Px", "muonTkPairPF2PATTk2Py", "muonTkPairPF2PATTk2Pz",
+    "numChsTrackPairs", "numMuonPF2PAT", "numMuonTrackPairsPF2PAT", "numPackedCands", "packedCandsCharge",
+    "packedCandsE", "packedCandsFromPV", "packedCandsHasTrackDetails", "packedCandsMuonIndex", "packedCandsPdgId",
+    "packedCandsPseudoTrkEta", "packedCandsPseudoTrkPhi", "packedCandsPseudoTrkPt", "packedCandsPx", "packedCandsPy",
+    "packedCandsPz"
+};
+
 // Lepton cut variables
 const float looseMuonEta_ {2.4}, looseMuonPt_ {5.}, looseMuonPtLeading_ {5.}, looseMuonRelIso_ {100.};
 const float invZMassCut_ {10.0}, chsMass_{0.13957018};
@@ -60,6 +76,7 @@ int main(int argc, char* argv[]) {
     double totalLumi;
     double usePreLumi;
     bool usePostLepTree {false};
+    bool useBranchManifest {false};
    
     std::string outFileString{"plots/distributions/output.root"};
     bool is2016_;
@@ -245,6 +262,9 @@ int main(int argc, char* argv[]) {
         ",u",
         po::bool_switch(&usePostLepTree),
         "Use post lepton selection trees.")(
+        "branchManifest",
+        po::bool_switch(&useBranchManifest),
+        "Only read the ntuple branches this macro uses.")(
         "2016", po::bool_switch(&is2016_), "Use 2016 conditions (SFs, et al.).")(
         "2018", po::bool_switch(&is2018_), "Use 2018 conditions (SFs, et al.).");
     po::variables_map vm;
@@ -332,6 +352,8 @@ int main(int argc, char* argv[]) {
       }
 
       AnalysisEvent event{dataset->isMC(), datasetChain, is2016_, is2018_};
+
+      if (useBranchManifest) event.setBranchManifest(branchManifest_);
       
       Long64_t numberOfEvents{datasetChain->GetEntries()};
       if (nEvents && nEvents < numberOfEvents) numberOfEvents = nEvents;
@@ -382,19 +404,19 @@ int main(int argc, char* argv[]) {
 	double mu_gamma_iso_pT_0p3 {0.}, mu_gamma_iso1_pT_0p3 {0.}, mu_gamma_iso2_pT_0p3 {0.};
 	double mu_gamma_iso_pT_0p4 {0.}, mu_gamma_iso1_pT_0p4 {0.}, mu_gamma_iso2_pT_0p4 {0.};
 
-	for (int k = 0; k < event.numPackedCands; k++) {
+	for (const int k : getNearbyPackedCands(event, event.zPairLeptons.first, event.zPairLeptons.second)) {
 
 	  // Skip packed cand if it is related to either selectednyib
 	  if ( k == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] || k == event.muonPF2PATPackedCandIndex[event.zPairIndex.second] ) continue;
 
 	  // Skip low momentum PF cands
-	  TLorentzVector packedCandVec;
+	  FourVector packedCandVec;
 	  packedCandVec.SetPxPyPzE(event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);                
 	  if ( packedCandVec.Pt() < 0.5 ) continue;
 	  
 	  // Track iso
 	  if ( event.packedCandsHasTrackDetails[k] > 0 ) {
-	    TLorentzVector packedTrkVec;
+	    FourVector packedTrkVec;
 	    packedTrkVec.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
 	    if ( event.zPairLeptons.first.DeltaR(packedTrkVec)   < 0.3 )                             mu_trkiso1_0p3 += packedTrkVec.Pt();
 	    if ( event.zPairLeptons.second.DeltaR(packedTrkVec)  < 0.3 )                             mu_trkiso2_0p3 += packedTrkVec.Pt();
@@ -626,19 +648,19 @@ int main(int argc, char* argv[]) {
 	double chs_gamma_iso_pT_0p3 {0.}, chs_gamma_iso1_pT_0p3 {0.}, chs_gamma_iso2_pT_0p3 {0.};
 	double chs_gamma_iso_pT_0p4 {0.}, chs_gamma_iso1_pT_0p4 {0.}, chs_gamma_iso2_pT_0p4 {0.};
 
-	for (int k = 0; k < event.numPackedCands; k++) {
+	for (const int k : getNearbyPackedCands(event, event.chsPairVec.first, event.chsPairVec.second)) {
 
 	  // Skip packed cand if it is related to either selected charged hadron
 	  if ( k == event.chsPairIndex.first || k == event.chsPairIndex.second ) continue;
 
 	  // Skip low momentum PF cands
-	  TLorentzVector packedCandVec;
+	  FourVector packedCandVec;
 	  packedCandVec.SetPxPyPzE(event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);                
 	  if ( packedCandVec.Pt() < 0.5 ) continue;
 	  
 	  // Track iso
 	  if ( event.packedCandsHasTrackDetails[k] > 0 ) {
-	    TLorentzVector packedTrkVec;
+	    FourVector packedTrkVec;
 	    packedTrkVec.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
 	    if ( event.chsPairVec.first.DeltaR(packedTrkVec)   < 0.3 )                             chs_trkiso1_0p3 += packedTrkVec.Pt();
 	    if ( event.chsPairVec.second.DeltaR(packedTrkVec)  < 0.3 )                             chs_trkiso2_0p3 += packedTrkVec.Pt();
@@ -1023,7 +1045,7 @@ std::vector<int> getChargedHadronTracks(const AnalysisEvent& event) {
         if (std::abs(event.packedCandsPdgId[k]) != 211) continue;
         if (event.packedCandsCharge[k] == 0 ) continue;
         if (event.packedCandsHasTrackDetails[k] != 1 ) continue;
-        TLorentzVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
+        FourVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
         if (lVec.Pt() < 1.0) continue;
 
         chs.emplace_back(k);
@@ -1038,8 +1060,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons) {
 
             if (event.muonPF2PATCharge[muons[i]] * event.muonPF2PATCharge[muons[j]] >= 0) continue;
 
-            TLorentzVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
-            TLorentzVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
+            FourVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
+            FourVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
             double delR { lepton1.DeltaR(lepton2) };
             if ( delR < maxDileptonDeltaR_  ) {
                 event.zPairLeptons.first  = lepton1.Pt() > lepton2.Pt() ? lepton1 : lepton2;
@@ -1053,8 +1075,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons) {
 
 //                if ( (event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06) > 10. ) continue;
 
-                event.zPairLeptonsRefitted.first  = TLorentzVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
-                event.zPairLeptonsRefitted.second = TLorentzVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.first  = FourVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.second = FourVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
 
                 return true;
             }
@@ -1077,8 +1099,8 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs) {
 
             if (event.packedCandsCharge[chs[i]] * event.packedCandsCharge[chs[j]] >= 0) continue;
 
-            TLorentzVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
-            TLorentzVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
+            FourVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
+            FourVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
 
             double pT { (chs1+chs2).Pt() };
             double delR { chs1.DeltaR(chs2) };
@@ -1090,7 +1112,7 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs) {
                 event.chsPairIndex.first = chs1.Pt() > chs2.Pt() ? chs[i] : chs[j];
                 event.chsPairIndex.second = chs1.Pt() > chs2.Pt() ? chs[j] : chs[i];
 
-                TLorentzVector chsTrk1, chsTrk2;
+                FourVector chsTrk1, chsTrk2;
                 chsTrk1.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.first], event.packedCandsPseudoTrkEta[event.chsPairIndex.first], event.packedCandsPseudoTrkPhi[event.chsPairIndex.first], event.packedCandsE[event.chsPairIndex.first]);
                 chsTrk2.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.second], event.packedCandsPseudoTrkEta[event.chsPairIndex.second], event.packedCandsPseudoTrkPhi[event.chsPairIndex.second], event.packedCandsE[event.chsPairIndex.second]);
 
@@ -1106,7 +1128,7 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs) {
                 if ( std::isnan(event.chsTkPairTk1P2[event.chsPairTrkIndex])  || std::isnan(event.chsTkPairTk2P2[event.chsPairTrkIndex]) ) return false;
                 if ( std::isnan(event.chsTkPairTk1Phi[event.chsPairTrkIndex]) || std::isnan(event.chsTkPairTk2Phi[event.chsPairTrkIndex]) ) return false;
 
-                TLorentzVector chsTrk1Refitted, chsTrk2Refitted;
+                FourVector chsTrk1Refitted, chsTrk2Refitted;
                 chsTrk1Refitted.SetPtEtaPhiE(event.chsTkPairTk1Pt[event.chsPairTrkIndex], event.chsTkPairTk1Eta[event.chsPairTrkIndex], event.chsTkPairTk1Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk1P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 chsTrk2Refitted.SetPtEtaPhiE(event.chsTkPairTk2Pt[event.chsPairTrkIndex], event.chsTkPairTk2Eta[event.chsPairTrkIndex], event.chsTkPairTk2Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk2P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 event.chsPairTrkVecRefitted.first  = chsTrk1Refitted;
@@ -1163,3 +1185,17 @@ float deltaR(float eta1, float phi1, float eta2, float phi2){
   return std::sqrt((dEta*dEta)+(dPhi*dPhi));
 }
 
+// Candidates that can be within deltaR 0.4 of either object or their sum,
+// by either their PF or their pseudo-track direction
+std::vector<int> getNearbyPackedCands(const AnalysisEvent& event, const FourVector& first, const FourVector& second) {
+    const PackedCandKinematics& packedCands {event.packedCandKinematics()};
+    const FourVector pairVec {first + second};
+    const float axisEta[3] {float(first.Eta()), float(second.Eta()), float(pairVec.Eta())};
+    const float axisPhi[3] {float(first.Phi()), float(second.Phi()), float(pairVec.Phi())};
+
+    std::vector<int> pfCands, trkCands, nearby;
+    packedCands.grid.candidatesNear(axisEta, axisPhi, 3, pfCands);
+    packedCands.trkGrid.candidatesNear(axisEta, axisPhi, 3, trkCands);
+    std::set_union(pfCands.begin(), pfCands.end(), trkCands.begin(), trkCands.end(), std::back_inserter(nearby));
+    return nearby;
+}
@@ -10,9 +10,9 @@
 #include "TLatex.h"
 #include "TMVA/Timer.h"
 #include "TTree.h"
-#include "TLorentzVector.h"
 #include "TString.h"
 #include "config_parser.hpp"
+#include "fourVector.hpp"
 
 #include <boost/filesystem.hpp>
 #include <boost/functional/hash.hpp>
@@ -42,6 +42,27 @@ float deltaR(float eta1, float phi1, float eta2, float phi2);
 
 namespace fs = boost::filesystem;
 
+// Ntuple branches read by this macro, used with --branchManifest
+const std::vector<std::string> branchManifest_ {
+    "genMuonPF2PATHardProcess", "genMuonPF2PATMotherId", "genMuonPF2PATPdgId", "genMuonPF2PATPromptFinalState", "genParId",
+    "genParMotherId", "genParMotherIndex", "genParNumDaughters", "muonPF2PATCharge", "muonPF2PATComRelIsodBeta",
+    "muonPF2PATDBPV", "muonPF2PATDZPV", "muonPF2PATE", "muonPF2PATEta", "muonPF2PATInnerTkEta",
+    "muonPF2PATInnerTkNormChi2", "muonPF2PATInnerTkPt", "muonPF2PATIsPFMuon", "muonPF2PATLooseCutId", "muonPF2PATMediumCutId",
+    "muonPF2PATNumSourceCandidates", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ", "muonPF2PATPackedCandIndex",
+    "muonPF2PATPfIsoLoose", "muonPF2PATPfIsoMedium", "muonPF2PATPfIsoTight", "muonPF2PATPfIsoVeryLoose", "muonPF2PATPfIsoVeryTight",
+    "muonPF2PATPhi", "muonPF2PATPt", "muonPF2PATTightCutId", "muonTkPairPF2PATIndex1", "muonTkPairPF2PATIndex2",
+    "muonTkPairPF2PATTk1Chi2", "muonTkPairPF2PATTk1Eta", "muonTkPairPF2PATTk1Ndof", "muonTkPairPF2PATTk1P2", "muonTkPairPF2PATTk1Pt",
+    "muonTkPairPF2PATTk1Px", "muonTkPairPF2PATTk1Py", "muonTkPairPF2PATTk1Pz", "muonTkPairPF2PATTk2Chi2", "muonTkPairPF2PATTk2Eta",
+    "muonTkPairPF2PATTk2Ndof", "muonTkPairPF2PATTk2P2", "muonTkPairPF2PATTk2Pt", "muonTkPairPF2PATTk2Px", "muonTkPairPF2PATTk2Py",
+    "muonTkPairPF2PATTk2Pz", "muonTkPairPF2PATTkVtxAngleXY", "muonTkPairPF2PATTkVtxAngleXYZ", "muonTkPairPF2PATTkVtxChi2", "muonTkPairPF2PATTkVtxDcaPreFit",
+    "muonTkPairPF2PATTkVtxDistMagXY", "muonTkPairPF2PATTkVtxDistMagXYSigma", "muonTkPairPF2PATTkVtxDistMagXYZ", "muonTkPairPF2PATTkVtxNdof", "muonTkPairPF2PATTkVtxP2",
+    "muonTkPairPF2PATTkVtxPx", "muonTkPairPF2PATTkVtxPy", "muonTkPairPF2PATTkVtxPz", "muonTkPairPF2PATTkVx", "muonTkPairPF2PATTkVy",
+    "muonTkPairPF2PATTkVz", "nGenPar", "numMuonPF2PAT", "numMuonTrackPairsPF2PAT", "numPackedCands",
+    "packedCandsCharge", "packedCandsE", "packedCandsElectronIndex", "packedCandsFromPV", "packedCandsJetIndex",
+    "packedCandsMuonIndex", "packedCandsPdgId", "packedCandsPseudoTrkEta", "packedCandsPseudoTrkPhi", "packedCandsPseudoTrkPt",
+    "packedCandsPx", "packedCandsPy", "packedCandsPz"
+};
+
 // Lepton cut variables
 const float looseMuonEta_ {2.8}, looseMuonPt_ {6.}, looseMuonPtLeading_ {15.}, looseMuonRelIso_ {100.};
 const float invZMassCut_ {10.0};
@@ -56,6 +77,7 @@ int main(int argc, char* argv[]) {
     double totalLumi;
     double usePreLumi;
     bool usePostLepTree {false};
+    bool useBranchManifest {false};
    
     std::string outFileString{"plots/distributions/output.root"};
     bool is2016_;
@@ -314,6 +336,9 @@ int main(int argc, char* argv[]) {
         ",u",
         po::bool_switch(&usePostLepTree),
         "Use post lepton selection trees.")(
+        "branchManifest",
+        po::bool_switch(&useBranchManifest),
+        "Only read the ntuple branches this macro uses.")(
         "2016", po::bool_switch(&is2016_), "Use 2016 conditions (SFs, et al.).")(
         "2018", po::bool_switch(&is2018_), "Use 2018 conditions (SFs, et al.).");
     po::variables_map vm;
@@ -407,6 +432,8 @@ int main(int argc, char* argv[]) {
 
         AnalysisEvent event{dataset->isMC(), datasetChain, is2016_, is2018_};
 
+        if (useBranchManifest) event.setBranchManifest(branchManifest_);
+
         Long64_t numberOfEvents{datasetChain->GetEntries()};
         if (nEvents && nEvents < numberOfEvents) numberOfEvents = nEvents;
 
@@ -939,8 +966,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
             if (event.muonPF2PATCharge[muons[i]] * event.muonPF2PATCharge[muons[j]] >= 0) continue;
             if ( mcTruth && event.genMuonPF2PATMotherId[muons[i]] == 9000006 && event.genMuonPF2PATMotherId[muons[j]] == 9000006) continue;
 
-            TLorentzVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
-            TLorentzVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
+            FourVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
+            FourVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
             double delR { lepton1.DeltaR(lepton2) };
             if ( delR < maxDileptonDeltaR_  ) {
                 event.zPairLeptons.first  = lepton1.Pt() > lepton2.Pt() ? lepton1 : lepton2;
@@ -963,7 +990,7 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
                 for (int k = 0; k < event.numPackedCands; k++) {
                     if ( k == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] || k == event.muonPF2PATPackedCandIndex[event.zPairIndex.second] ) continue;
 
-                    TLorentzVector packedCandVec, packedCandTrkVec;
+                    FourVector packedCandVec, packedCandTrkVec;
                     packedCandVec.SetPxPyPzE      (event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);
                     packedCandTrkVec.SetPtEtaPhiE (event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
 
@@ -1027,8 +1054,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
 
 //                if ( (event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06) > 10. ) continue;
 
-                event.zPairLeptonsRefitted.first  = TLorentzVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
-                event.zPairLeptonsRefitted.second = TLorentzVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.first  = FourVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.second = FourVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
 
                 return true;
             }
@@ -11,9 +11,9 @@
 #include "TLatex.h"
 #include "TMVA/Timer.h"
 #include "TTree.h"
-#include "TLorentzVector.h"
 #include "TString.h"
 #include "config_parser.hpp"
+#include "fourVector.hpp"
 
 #include <boost/filesystem.hpp>
 #include <boost/functional/hash.hpp>
@@ -45,6 +45,25 @@ float deltaR(float eta1, float phi1, float eta2, float phi2);
 
 namespace fs = boost::filesystem;
 
+// Ntuple branches read by this macro, used with --branchManifest
+const std::vector<std::string> branchManifest_ {
+    "chsTkPairIndex1", "chsTkPairIndex2", "chsTkPairTk1Eta", "chsTkPairTk1P2", "chsTkPairTk1Phi",
+    "chsTkPairTk1Pt", "chsTkPairTk2Eta", "chsTkPairTk2P2", "chsTkPairTk2Phi", "chsTkPairTk2Pt",
+    "genElePF2PATScalarAncestor", "genJetPF2PATScalarAncestor", "genMuonPF2PATDirectScalarAncestor", "genMuonPF2PATEta", "genMuonPF2PATHardProcess",
+    "genMuonPF2PATMotherId", "genMuonPF2PATPT", "genMuonPF2PATPhi", "genMuonPF2PATScalarAncestor", "genParE",
+    "genParEta", "genParId", "genParMotherId", "genParPhi", "genParPt",
+    "jetPF2PATE", "jetPF2PATEta", "jetPF2PATPhi", "jetPF2PATPt", "muonPF2PATCharge",
+    "muonPF2PATComRelIsodBeta", "muonPF2PATE", "muonPF2PATEta", "muonPF2PATImpact3DSignificance", "muonPF2PATImpactTransSignificance",
+    "muonPF2PATIsPFMuon", "muonPF2PATLooseCutId", "muonPF2PATPX", "muonPF2PATPY", "muonPF2PATPZ",
+    "muonPF2PATPackedCandIndex", "muonPF2PATPt", "muonTkPairPF2PATIndex1", "muonTkPairPF2PATIndex2", "muonTkPairPF2PATTk1P2",
+    "muonTkPairPF2PATTk1Px", "muonTkPairPF2PATTk1Py", "muonTkPairPF2PATTk1Pz", "muonTkPairPF2PATTk2P2", "muonTkPairPF2PATTk2Px",
+    "muonTkPairPF2PATTk2Py", "muonTkPairPF2PATTk2Pz", "nGenPar", "numChsTrackPairs", "numMuonPF2PAT",
+    "numMuonTrackPairsPF2PAT", "numPackedCands", "packedCandsCharge", "packedCandsE", "packedCandsElectronIndex",
+    "packedCandsFromPV", "packedCandsHasTrackDetails", "packedCandsJetIndex", "packedCandsMuonIndex", "packedCandsPdgId",
+    "packedCandsPseudoTrkEta", "packedCandsPseudoTrkPhi", "packedCandsPseudoTrkPt", "packedCandsPseudoTrkPx", "packedCandsPseudoTrkPy",
+    "packedCandsPseudoTrkPz", "packedCandsPx", "packedCandsPy", "packedCandsPz"
+};
+
 // Lepton cut variables
 const float looseMuonEtaLeading_ {2.5}, looseMuonEta_ {2.5}, looseMuonPt_ {5.}, looseMuonPtLeading_ {5.}, looseMuonRelIso_ {100.};
 const float invZMassCut_ {10.0}, chsMass_{0.13957018};
@@ -61,6 +80,7 @@ int main(int argc, char* argv[]) {
     double totalLumi;
     double usePreLumi;
     bool usePostLepTree {false};
+    bool useBranchManifest {false};
     bool mcTruth_ {false};
    
     std::string outFileString{"plots/distributions/output.root"};
@@ -217,6 +237,9 @@ int main(int argc, char* argv[]) {
         ",u",
         po::bool_switch(&usePostLepTree),
         "Use post lepton selection trees.")(
+        "branchManifest",
+        po::bool_switch(&useBranchManifest),
+        "Only read the ntuple branches this macro uses.")(
         "2016", po::bool_switch(&is2016_), "Use 2016 conditions (SFs, et al.).")(
         "2018", po::bool_switch(&is2018_), "Use 2018 conditions (SFs, et al.).");
     po::variables_map vm;
@@ -310,6 +333,8 @@ int main(int argc, char* argv[]) {
 
         AnalysisEvent event{dataset->isMC(), datasetChain, is2016_, is2018_};
 
+        if (useBranchManifest) event.setBranchManifest(branchManifest_);
+
         Long64_t numberOfEvents{datasetChain->GetEntries()};
         if (nEvents && nEvents < numberOfEvents) numberOfEvents = nEvents;
 
@@ -332,7 +357,7 @@ int main(int argc, char* argv[]) {
                 }
             }
 
-            TLorentzVector genMuon1, genMuon2;
+            FourVector genMuon1, genMuon2;
             if ( genMuonIndex.size() == 2 ) {
                 bool firstLeading {false};
                 if ( event.genParPt[genMuonIndex[0]] > event.genParPt[genMuonIndex[1]] ) firstLeading = true;
@@ -412,13 +437,13 @@ int main(int argc, char* argv[]) {
             const bool passTriggers ( event.muTrig() );
 
 //            const int index1 {event.zPairIndex.first}, index2 {event.zPairIndex.second};
-            const TLorentzVector muon1Vec {event.zPairLeptons.first}, muon2Vec {event.zPairLeptons.second};
+            const FourVector muon1Vec {event.zPairLeptons.first}, muon2Vec {event.zPairLeptons.second};
 
              int idx1 {event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
              int idx2 {event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
 
-            TLorentzVector muon1VecNew{event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]};
-            TLorentzVector muon2VecNew{event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]};
+            FourVector muon1VecNew{event.packedCandsPseudoTrkPx[idx1], event.packedCandsPseudoTrkPy[idx1], event.packedCandsPseudoTrkPz[idx1], event.packedCandsE[idx1]};
+            FourVector muon2VecNew{event.packedCandsPseudoTrkPx[idx2], event.packedCandsPseudoTrkPy[idx2], event.packedCandsPseudoTrkPz[idx2], event.packedCandsE[idx2]};
 
             // Get CHS
 
@@ -430,9 +455,9 @@ int main(int argc, char* argv[]) {
 //            if ( muScalarMass  < hadScalarMass*1.25 && muScalarMass  >= hadScalarMass*.75 ) return false;
  //           if ( hadScalarMass < muScalarMass*1.25  && hadScalarMass >= muScalarMass*.75  ) return false;
 
-            const TLorentzVector chs1Vec{event.chsPairVec.first}, chs2Vec{event.chsPairVec.second};
+            const FourVector chs1Vec{event.chsPairVec.first}, chs2Vec{event.chsPairVec.second};
 
-            TLorentzVector jet1Vec, jet2Vec;
+            FourVector jet1Vec, jet2Vec;
             const int jetIndex1 {event.packedCandsJetIndex[event.chsPairIndex.first]}, jetIndex2 {event.packedCandsJetIndex[event.chsPairIndex.second]};
             jet1Vec.SetPtEtaPhiE(event.jetPF2PATPt[jetIndex1], event.jetPF2PATEta[jetIndex1], event.jetPF2PATPhi[jetIndex1], event.jetPF2PATE[jetIndex1]);
             jet2Vec.SetPtEtaPhiE(event.jetPF2PATPt[jetIndex2], event.jetPF2PATEta[jetIndex2], event.jetPF2PATPhi[jetIndex2], event.jetPF2PATE[jetIndex2]);
@@ -691,7 +716,7 @@ std::vector<int> getChargedHadronTracks(const AnalysisEvent& event) {
         if (std::abs(event.packedCandsPdgId[k]) != 211) continue;
         if (event.packedCandsCharge[k] == 0 ) continue;
         if (event.packedCandsHasTrackDetails[k] != 1 ) continue;
-        TLorentzVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
+        FourVector lVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
         if (lVec.Pt() < 1.0) continue;
 
         chs.emplace_back(k);
@@ -718,8 +743,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
 
             if (event.muonPF2PATCharge[muons[i]] * event.muonPF2PATCharge[muons[j]] >= 0) continue;
 
-            TLorentzVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
-            TLorentzVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
+            FourVector lepton1{event.muonPF2PATPX[muons[i]], event.muonPF2PATPY[muons[i]], event.muonPF2PATPZ[muons[i]], event.muonPF2PATE[muons[i]]};
+            FourVector lepton2{event.muonPF2PATPX[muons[j]], event.muonPF2PATPY[muons[j]], event.muonPF2PATPZ[muons[j]], event.muonPF2PATE[muons[j]]};
 
             double delR { lepton1.DeltaR(lepton2) };
 
@@ -734,60 +759,36 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
                 event.zPairRelIso.first  = event.muonPF2PATComRelIsodBeta[muons[i]];
                 event.zPairRelIso.second = event.muonPF2PATComRelIsodBeta[muons[j]];
 
+                // pf and trk isolation sums around each lepton and the pair
+                using Iso = PackedCandIsolation;
+                PackedCandIsolation& packedCandIso{event.packedCandIsolation()};
+                const int excludeCand1{event.muonPF2PATPackedCandIndex[event.zPairIndex.first]};
+                const int excludeCand2{event.muonPF2PATPackedCandIndex[event.zPairIndex.second]};
+                const Iso::pairSums pfIso{packedCandIso.pairIsolation(Iso::Pair::muons, event.zPairIndex.first, event.zPairIndex.second, Iso::Vec::pf, event.zPairLeptons.first, event.zPairLeptons.second, excludeCand1, excludeCand2)};
+                const Iso::pairSums trkIso{packedCandIso.pairIsolation(Iso::Pair::muons, event.zPairIndex.first, event.zPairIndex.second, Iso::Vec::pseudoTrack, event.zPairLeptons.first, event.zPairLeptons.second, excludeCand1, excludeCand2)};
+                const size_t cone{Iso::CONE_0P4};
+
                 // pf quantities
-                float neutral_iso {0.0}, neutral_iso1 {0.0}, neutral_iso2 {0.0};
-                float ch_iso {0.0}, ch_iso1 {0.0}, ch_iso2 {0.0};
-                float pu_iso {0.0}, pu_iso1 {0.0}, pu_iso2 {0.0};
+                const float neutral_iso1 {pfIso[Iso::FIRST][cone].neutral};
+                const float neutral_iso2 {pfIso[Iso::SECOND][cone].neutral};
+                const float neutral_iso {pfIso[Iso::SUM][cone].neutral};
+                const float ch_iso1 {pfIso[Iso::FIRST][cone].charged};
+                const float ch_iso2 {pfIso[Iso::SECOND][cone].charged};
+                const float ch_iso {pfIso[Iso::SUM][cone].charged};
+                const float pu_iso1 {pfIso[Iso::FIRST][cone].pu};
+                const float pu_iso2 {pfIso[Iso::SECOND][cone].pu};
+                const float pu_iso {pfIso[Iso::SUM][cone].pu};
 
                 // trk quantities
-                float neutral_trkiso {0.0}, neutral_trkiso1 {0.0}, neutral_trkiso2 {0.0};
-                float ch_trkiso {0.0}, ch_trkiso1 {0.0}, ch_trkiso2 {0.0};
-                float pu_trkiso {0.0}, pu_trkiso1 {0.0}, pu_trkiso2 {0.0};
-   
-                for (int k = 0; k < event.numPackedCands; k++) {
-                    if ( k == event.muonPF2PATPackedCandIndex[event.zPairIndex.first] || k == event.muonPF2PATPackedCandIndex[event.zPairIndex.second] ) continue;
-
-                    TLorentzVector packedCandVec, packedCandTrkVec;
-                    packedCandVec.SetPxPyPzE      (event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]);
-                    packedCandTrkVec.SetPtEtaPhiE (event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
-
-                    // Charge hadron contributions have to have pT > 0.5
-                    if ( event.packedCandsCharge[k] == 0 ) {
-                        if ( packedCandVec.Pt() >= 0.5 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  neutral_iso1 += packedCandVec.Et();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  neutral_iso2 += packedCandVec.Et();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) neutral_iso += packedCandVec.Et();
-                        }
-                        if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  neutral_trkiso1 += packedCandTrkVec.Et();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  neutral_trkiso2 += packedCandTrkVec.Et();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) neutral_trkiso += packedCandTrkVec.Et();
-                        }
-                    }
-                    else {
-                        if ( event.packedCandsFromPV[k] >= 2 ) {
-                            if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  ch_iso1 += packedCandVec.Pt();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  ch_iso2 += packedCandVec.Pt();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) ch_iso += packedCandVec.Pt();
-
-                            if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  ch_trkiso1 += packedCandTrkVec.Pt();
-                            if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  ch_trkiso2 += packedCandTrkVec.Pt();
-                            if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) ch_trkiso += packedCandTrkVec.Pt();
-                        }
-                        else {
-                            if ( packedCandVec.Pt() >= 0.5 ) {
-                                if ( event.zPairLeptons.first.DeltaR(packedCandVec)   < 0.4 )  pu_iso1 += packedCandVec.Pt();
-                                if ( event.zPairLeptons.second.DeltaR(packedCandVec)  < 0.4 )  pu_iso2 += packedCandVec.Pt();
-                                if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandVec)  < 0.4 ) pu_iso += packedCandVec.Pt();
-                            }
-       	                    if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                                if ( event.zPairLeptons.first.DeltaR(packedCandTrkVec)   < 0.4 )  pu_trkiso1 += packedCandTrkVec.Pt();
-                                if ( event.zPairLeptons.second.DeltaR(packedCandTrkVec)  < 0.4 )  pu_trkiso2 += packedCandTrkVec.Pt();
-                                if ( (event.zPairLeptons.first+event.zPairLeptons.second).DeltaR(packedCandTrkVec)  < 0.4 ) pu_trkiso += packedCandTrkVec.Pt();
-                            }
-                        }
-                    }
-                }
+                const float neutral_trkiso1 {trkIso[Iso::FIRST][cone].neutral};
+                const float neutral_trkiso2 {trkIso[Iso::SECOND][cone].neutral};
+                const float neutral_trkiso {trkIso[Iso::SUM][cone].neutral};
+                const float ch_trkiso1 {trkIso[Iso::FIRST][cone].charged};
+                const float ch_trkiso2 {trkIso[Iso::SECOND][cone].charged};
+                const float ch_trkiso {trkIso[Iso::SUM][cone].charged};
+                const float pu_trkiso1 {trkIso[Iso::FIRST][cone].pu};
+                const float pu_trkiso2 {trkIso[Iso::SECOND][cone].pu};
+                const float pu_trkiso {trkIso[Iso::SUM][cone].pu};
 
                 const float iso1 = ch_iso1 + std::max( float(0.0), neutral_iso1 - float(0.5*pu_iso1) );
                 const float iso2 = ch_iso2 + std::max( float(0.0), neutral_iso2 - float(0.5*pu_iso2) );
@@ -811,8 +812,8 @@ bool getDileptonCand(AnalysisEvent& event, const std::vector<int>& muons, bool m
 
 //                if ( (event.muonTkPairPF2PATTkVtxChi2[event.mumuTrkIndex])/(event.muonTkPairPF2PATTkVtxNdof[event.mumuTrkIndex]+1.0e-06) > 10. ) continue;
 
-                event.zPairLeptonsRefitted.first  = TLorentzVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
-                event.zPairLeptonsRefitted.second = TLorentzVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.first  = FourVector{event.muonTkPairPF2PATTk1Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk1Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk1P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
+                event.zPairLeptonsRefitted.second = FourVector{event.muonTkPairPF2PATTk2Px[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Py[event.mumuTrkIndex], event.muonTkPairPF2PATTk2Pz[event.mumuTrkIndex], std::sqrt(event.muonTkPairPF2PATTk2P2[event.mumuTrkIndex]+std::pow(0.1057,2))};
 
                 return true;
             }
@@ -849,8 +850,8 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
 
             if (event.packedCandsCharge[chs[i]] * event.packedCandsCharge[chs[j]] >= 0) continue;
 
-            TLorentzVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
-            TLorentzVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
+            FourVector chs1 {event.packedCandsPx[chs[i]], event.packedCandsPy[chs[i]], event.packedCandsPz[chs[i]], event.packedCandsE[chs[i]]};
+            FourVector chs2 {event.packedCandsPx[chs[j]], event.packedCandsPy[chs[j]], event.packedCandsPz[chs[j]], event.packedCandsE[chs[j]]};
 
             double pT { (chs1+chs2).Pt() };
             double delR { chs1.DeltaR(chs2) };
@@ -862,63 +863,47 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
                 event.chsPairIndex.first = chs1.Pt() > chs2.Pt() ? chs[i] : chs[j];
                 event.chsPairIndex.second = chs1.Pt() > chs2.Pt() ? chs[j] : chs[i];
 
-                TLorentzVector chsTrk1, chsTrk2;
+                FourVector chsTrk1, chsTrk2;
                 chsTrk1.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.first], event.packedCandsPseudoTrkEta[event.chsPairIndex.first], event.packedCandsPseudoTrkPhi[event.chsPairIndex.first], event.packedCandsE[event.chsPairIndex.first]);
                 chsTrk2.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[event.chsPairIndex.second], event.packedCandsPseudoTrkEta[event.chsPairIndex.second], event.packedCandsPseudoTrkPhi[event.chsPairIndex.second], event.packedCandsE[event.chsPairIndex.second]);
 
                 event.chsPairTrkVec.first  = chsTrk1;
                 event.chsPairTrkVec.second = chsTrk2;
 
-                float neutral_iso {0.0}, neutral_iso1 {0.0}, neutral_iso2 {0.0};
-                float ch_iso {0.0}, ch_iso1 {0.0}, ch_iso2 {0.0};
-                float pu_iso {0.0}, pu_iso1 {0.0}, pu_iso2 {0.0};
-
-                float neutral_trkiso {0.0}, neutral_trkiso1 {0.0}, neutral_trkiso2 {0.0};
-                float ch_trkiso {0.0}, ch_trkiso1 {0.0}, ch_trkiso2 {0.0};
-                float pu_trkiso {0.0}, pu_trkiso1 {0.0}, pu_trkiso2 {0.0};
-
-                for (int k = 0; k < event.numPackedCands; k++) {
-                    if ( k == event.chsPairIndex.first || k == event.chsPairIndex.second ) continue;
-
-                    TLorentzVector packedCandVec {event.packedCandsPx[k], event.packedCandsPy[k], event.packedCandsPz[k], event.packedCandsE[k]};
-                    TLorentzVector packedCandTrkVec;
-                    packedCandTrkVec.SetPtEtaPhiE(event.packedCandsPseudoTrkPt[k], event.packedCandsPseudoTrkEta[k], event.packedCandsPseudoTrkPhi[k], event.packedCandsE[k]);
-
-                    if ( event.packedCandsCharge[k] == 0 ) {
-                        if ( packedCandVec.Pt() >= 0.5 ) {
-                            if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  neutral_iso1 += packedCandVec.Et();
-                            if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  neutral_iso2 += packedCandVec.Et();
-                            if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) neutral_iso += packedCandVec.Et();
-                        }
-                        if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                            if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)  < 0.3 ) neutral_trkiso1 += packedCandTrkVec.Et();
-                            if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec) < 0.3 ) neutral_trkiso2 += packedCandTrkVec.Et();
-                            if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec) ) neutral_trkiso += packedCandVec.Et();
-                        }
-                    }
-                    else {
-                        if ( event.packedCandsFromPV[k] >= 2 ) {
-                            if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  ch_iso1 += packedCandVec.Pt();
-                            if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  ch_iso2 += packedCandVec.Pt();
-                            if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) ch_iso += packedCandVec.Pt();
-
-                            if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)   < 0.3 )  ch_trkiso1 += packedCandTrkVec.Pt();
-                            if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec)  < 0.3 )  ch_trkiso2 += packedCandTrkVec.Pt();
-                            if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec)  < 0.3 ) ch_trkiso += packedCandTrkVec.Pt();
-                        }
-                        else {
-                            if ( packedCandVec.Pt() >= 0.5 ) {
-                                if ( event.chsPairVec.first.DeltaR(packedCandVec)   < 0.3 )  pu_iso1 += packedCandVec.Pt();
-                                if ( event.chsPairVec.second.DeltaR(packedCandVec)  < 0.3 )  pu_iso2 += packedCandVec.Pt();
-                                if ( (event.chsPairVec.first+event.chsPairVec.second).DeltaR(packedCandVec)  < 0.3 ) pu_iso += packedCandVec.Pt();
-                            }
-                            if ( packedCandTrkVec.Pt() >= 0.5 ) {
-                                if ( event.chsPairTrkVec.first.DeltaR(packedCandTrkVec)   < 0.3 )  pu_trkiso1 += packedCandTrkVec.Pt();
-                                if ( event.chsPairTrkVec.second.DeltaR(packedCandTrkVec)  < 0.3 )  pu_trkiso2 += packedCandTrkVec.Pt();
-                                if ( (event.chsPairTrkVec.first+event.chsPairTrkVec.second).DeltaR(packedCandTrkVec)  < 0.3 ) pu_trkiso += packedCandTrkVec.Pt();
-                            }
-                        }
-                    }
+                using Iso = PackedCandIsolation;
+                const PackedCandKinematics& packedCands{event.packedCandKinematics()};
+                PackedCandIsolation& packedCandIso{event.packedCandIsolation()};
+                const int excludeCand1{event.chsPairIndex.first};
+                const int excludeCand2{event.chsPairIndex.second};
+                const Iso::pairSums pfIso{packedCandIso.pairIsolation(Iso::Pair::chargedHadrons, event.chsPairIndex.first, event.chsPairIndex.second, Iso::Vec::pf, event.chsPairVec.first, event.chsPairVec.second, excludeCand1, excludeCand2)};
+                const Iso::pairSums trkIso{packedCandIso.pairIsolation(Iso::Pair::chargedHadrons, event.chsPairIndex.first, event.chsPairIndex.second, Iso::Vec::pseudoTrack, event.chsPairTrkVec.first, event.chsPairTrkVec.second, excludeCand1, excludeCand2)};
+                const size_t cone{Iso::CONE_0P3};
+
+                const float neutral_iso1 {pfIso[Iso::FIRST][cone].neutral};
+                const float neutral_iso2 {pfIso[Iso::SECOND][cone].neutral};
+                const float neutral_iso {pfIso[Iso::SUM][cone].neutral};
+                const float ch_iso1 {pfIso[Iso::FIRST][cone].charged};
+                const float ch_iso2 {pfIso[Iso::SECOND][cone].charged};
+                const float ch_iso {pfIso[Iso::SUM][cone].charged};
+                const float pu_iso1 {pfIso[Iso::FIRST][cone].pu};
+                const float pu_iso2 {pfIso[Iso::SECOND][cone].pu};
+                const float pu_iso {pfIso[Iso::SUM][cone].pu};
+
+                const float neutral_trkiso1 {trkIso[Iso::FIRST][cone].neutral};
+                const float neutral_trkiso2 {trkIso[Iso::SECOND][cone].neutral};
+                const float ch_trkiso1 {trkIso[Iso::FIRST][cone].charged};
+                const float ch_trkiso2 {trkIso[Iso::SECOND][cone].charged};
+                const float ch_trkiso {trkIso[Iso::SUM][cone].charged};
+                const float pu_trkiso1 {trkIso[Iso::FIRST][cone].pu};
+                const float pu_trkiso2 {trkIso[Iso::SECOND][cone].pu};
+                const float pu_trkiso {trkIso[Iso::SUM][cone].pu};
+
+                // As in Cuts, the neutral sum around the track pair has no
+                // cone cut and takes the PF Et
+                float neutral_trkiso {0.0};
+                for (int k = 0; k < packedCands.size; k++) {
+                    if ( k == excludeCand1 || k == excludeCand2 ) continue;
+                    if ( packedCands.neutralTrkEt[k] > 0.f ) neutral_trkiso += packedCands.et[k];
                 }
 
                 const float iso1 = ch_iso1 + std::max( float(0.0), neutral_iso1 - float(0.5*pu_iso1) );
@@ -940,7 +925,7 @@ bool getDihadronCand(AnalysisEvent& event, std::vector<int>& chs, bool mcTruth )
 //                if ( event.chsTrkIso > 0.4 ) continue;
 
                 event.chsPairTrkIndex = getChsTrackPairIndex(event);
-                TLorentzVector chsTrk1Refitted, chsTrk2Refitted;
+                FourVector chsTrk1Refitted, chsTrk2Refitted;
                 chsTrk1Refitted.SetPtEtaPhiE(event.chsTkPairTk1Pt[event.chsPairTrkIndex], event.chsTkPairTk1Eta[event.chsPairTrkIndex], event.chsTkPairTk1Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk1P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 chsTrk2Refitted.SetPtEtaPhiE(event.chsTkPairTk2Pt[event.chsPairTrkIndex], event.chsTkPairTk2Eta[event.chsPairTrkIndex], event.chsTkPairTk2Phi[event.chsPairTrkIndex], std::sqrt(event.chsTkPairTk2P2[event.chsPairTrkIndex]+std::pow(chsMass_,2)));
                 event.chsPairTrkVecRefitted.first  = chsTrk1Refitted;
@@ -0,0 +1,165 @@
+#include "scaleFactorTable.hpp"
+
+#include <TAxis.h>
+#include <TH1.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    std::vector<double> axisEdges(const TAxis& axis) {
+        std::vector<double> edges;
+        edges.reserve(static_cast<size_t>(axis.GetNbins() + 1));
+        for (int i{1}; i <= axis.GetNbins() + 1; i++) {
+            edges.emplace_back(axis.GetBinLowEdge(i));
+        }
+        return edges;
+    }
+
+    template <typename T>
+    void writeArray(std::ostream& out, const std::vector<T>& values) {
+        const uint64_t size{values.size()};
+        out.write(reinterpret_cast<const char*>(&size), sizeof(size));
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(size * sizeof(T)));
+    }
+
+    template <typename T>
+    std::vector<T> readArray(const char*& data, const char* end) {
+        uint64_t size{0};
+        if (end - data < static_cast<std::ptrdiff_t>(sizeof(size))) {
+            throw std::logic_error("Truncated scale factor table");
+        }
+        std::memcpy(&size, data, sizeof(size));
+        data += sizeof(size);
+        if (static_cast<uint64_t>(end - data) / sizeof(T) < size) {
+            throw std::logic_error("Truncated scale factor table");
+        }
+        std::vector<T> values(size);
+        std::memcpy(values.data(), data, size * sizeof(T));
+        data += size * sizeof(T);
+        return values;
+    }
+
+    void checkBinning(const TH1& nominal, const TH1& other) {
+        if (nominal.GetNcells() != other.GetNcells()) {
+            throw std::logic_error(std::string{"Histogram "} + other.GetName() + " is not binned as " + nominal.GetName());
+        }
+    }
+} // namespace
+
+ScaleFactorTable::ScaleFactorTable()
+    : xEdges_{}
+    , yEdges_{}
+    , stride_{0}
+    , values_{}
+{}
+
+ScaleFactorTable::ScaleFactorTable(const TH1& nominal)
+    : ScaleFactorTable{}
+{
+    setBinning(nominal);
+    for (int i{0}; i < nominal.GetNcells(); i++) {
+        const double content{nominal.GetBinContent(i)};
+        const double error{nominal.GetBinError(i)};
+        values_.push_back({content, content + error, content - error});
+    }
+}
+
+ScaleFactorTable::ScaleFactorTable(const TH1& nominal, const std::vector<const TH1*>& uncertainties)
+    : ScaleFactorTable{}
+{
+    setBinning(nominal);
+    for (const TH1* uncertainty : uncertainties) {
+        checkBinning(nominal, *uncertainty);
+    }
+    for (int i{0}; i < nominal.GetNcells(); i++) {
+        double error2{0.};
+        for (const TH1* uncertainty : uncertainties) {
+            error2 += uncertainty->GetBinError(i) * uncertainty->GetBinError(i);
+        }
+        const double content{nominal.GetBinContent(i)};
+        const double error{std::sqrt(error2)};
+        values_.push_back({content, content + error, content - error});
+    }
+}
+
+ScaleFactorTable::ScaleFactorTable(const TH1& nominal, const TH1& up, const TH1& down)
+    : ScaleFactorTable{}
+{
+    setBinning(nominal);
+    checkBinning(nominal, up);
+    checkBinning(nominal, down);
+    for (int i{0}; i < nominal.GetNcells(); i++) {
+        values_.push_back({nominal.GetBinContent(i), up.GetBinContent(i), down.GetBinContent(i)});
+    }
+}
+
+ScaleFactorTable ScaleFactorTable::ratio(const TH1& numerator, const TH1& denominator) {
+    checkBinning(numerator, denominator);
+    ScaleFactorTable table;
+    table.setBinning(numerator);
+    for (int i{0}; i < numerator.GetNcells(); i++) {
+        const double value{numerator.GetBinContent(i) / denominator.GetBinContent(i)};
+        table.values_.push_back({value, value, value});
+    }
+    return table;
+}
+
+void ScaleFactorTable::write(std::ostream& out) const {
+    const int64_t stride{stride_};
+    out.write(reinterpret_cast<const char*>(&stride), sizeof(stride));
+    writeArray(out, xEdges_);
+    writeArray(out, yEdges_);
+    writeArray(out, values_);
+}
+
+ScaleFactorTable ScaleFactorTable::read(const char* data, const size_t size) {
+    const char* end{data + size};
+    int64_t stride{0};
+    if (size < sizeof(stride)) {
+        throw std::logic_error("Truncated scale factor table");
+    }
+    std::memcpy(&stride, data, sizeof(stride));
+    data += sizeof(stride);
+
+    ScaleFactorTable table;
+    table.stride_ = static_cast<int>(stride);
+    table.xEdges_ = readArray<double>(data, end);
+    table.yEdges_ = readArray<double>(data, end);
+    table.values_ = readArray<entry>(data, end);
+    return table;
+}
+
+void ScaleFactorTable::setBinning(const TH1& hist) {
+    if (hist.GetDimension() > 2) {
+        throw std::logic_error(std::string{"Histogram "} + hist.GetName() + " has more than two dimensions");
+    }
+    xEdges_ = axisEdges(*hist.GetXaxis());
+    yEdges_ = hist.GetDimension() == 2 ? axisEdges(*hist.GetYaxis()) : std::vector<double>{};
+    stride_ = hist.GetNbinsX() + 2;
+    values_.clear();
+    values_.reserve(static_cast<size_t>(hist.GetNcells()));
+}
+
+void ScaleFactorTable::bins(const double* x, const double* y, const size_t n, int* result) const {
+    const double* xEdges{xEdges_.data()};
+    const double* yEdges{yEdges_.data()};
+    const size_t numXEdges{xEdges_.size()};
+    const size_t numYEdges{yEdges_.size()};
+    const int stride{stride_};
+    if (numYEdges == 0) {
+#pragma omp simd
+        for (size_t i = 0; i < n; i++) {
+            result[i] = axisBin(xEdges, numXEdges, x[i]);
+        }
+        return;
+    }
+#pragma omp simd
+    for (size_t i = 0; i < n; i++) {
+        result[i] = axisBin(xEdges, numXEdges, x[i]) + stride * axisBin(yEdges, numYEdges, y[i]);
+    }
+}
@@ -0,0 +1,109 @@
+#include "systematics.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <yaml-cpp/yaml.h>
+
+namespace
+{
+    Systematic::Target parseTarget(const std::string& target) {
+        static const std::map<std::string, Systematic::Target> targets{
+            {"leptonSF", Systematic::Target::leptonSF},
+            {"jes", Systematic::Target::jes},
+            {"jer", Systematic::Target::jer},
+            {"pileup", Systematic::Target::pileup},
+            {"bTag", Systematic::Target::bTag},
+            {"pdf", Systematic::Target::pdf},
+            {"meScale", Systematic::Target::meScale},
+            {"alphaS", Systematic::Target::alphaS},
+            {"isr", Systematic::Target::isr},
+            {"fsr", Systematic::Target::fsr}};
+        const auto found{targets.find(target)};
+        if (found == targets.end()) {
+            throw std::logic_error("Unknown systematic target " + target);
+        }
+        return found->second;
+    }
+
+    Systematic::Type parseType(const std::string& type) {
+        if (type == "shape") {
+            return Systematic::Type::shape;
+        }
+        if (type == "weight") {
+            return Systematic::Type::weight;
+        }
+        throw std::logic_error("Unknown systematic type " + type);
+    }
+
+    // The per event weights a variation can take from the ntuples
+    Double_t AnalysisEvent::*weightMember(const std::string& branch) {
+        static const std::map<std::string, Double_t AnalysisEvent::*> branches{
+            {"weight_muF0p5muR0p5", &AnalysisEvent::weight_muF0p5muR0p5},
+            {"weight_muF2muR2", &AnalysisEvent::weight_muF2muR2},
+            {"weight_pdfMax", &AnalysisEvent::weight_pdfMax},
+            {"weight_pdfMin", &AnalysisEvent::weight_pdfMin},
+            {"weight_alphaMax", &AnalysisEvent::weight_alphaMax},
+            {"weight_alphaMin", &AnalysisEvent::weight_alphaMin},
+            {"isrDefLo", &AnalysisEvent::isrDefLo},
+            {"isrDefHi", &AnalysisEvent::isrDefHi},
+            {"fsrDefLo", &AnalysisEvent::fsrDefLo},
+            {"fsrDefHi", &AnalysisEvent::fsrDefHi}};
+        const auto found{branches.find(branch)};
+        if (found == branches.end()) {
+            throw std::logic_error("Unknown systematic weight branch " + branch);
+        }
+        return found->second;
+    }
+} // namespace
+
+SystematicsRegistry::SystematicsRegistry()
+    : systematics_{{"nominal", "", Systematic::Type::shape, Systematic::Target::nominal, true, 0, "", nullptr, "", nullptr}}
+{
+}
+
+SystematicsRegistry::SystematicsRegistry(const std::string& conf)
+    : SystematicsRegistry{}
+{
+    const YAML::Node root{YAML::LoadFile(conf)};
+    for (const auto& entry : root["variations"]) {
+        const std::string name{entry["name"].as<std::string>()};
+        const Systematic::Target target{parseTarget(entry["affects"].as<std::string>())};
+        const Systematic::Type type{parseType(entry["type"].as<std::string>())};
+        if (type == Systematic::Type::weight && (target == Systematic::Target::jes || target == Systematic::Target::jer || target == Systematic::Target::bTag)) {
+            throw std::logic_error("Systematic " + name + " changes the jets, so it must be a shape systematic");
+        }
+
+        for (const bool up : {true, false}) {
+            if (systematics_.size() > 31) {
+                throw std::logic_error("Too many systematics for the --syst mask");
+            }
+            const std::string direction{up ? "Up" : "Down"};
+            Systematic systematic{name, "__" + name + (up ? "__plus" : "__minus"), type, target, up, 1 << (systematics_.size() - 1), "", nullptr, "", nullptr};
+            if (entry["weight" + direction]) {
+                systematic.weightBranch = entry["weight" + direction].as<std::string>();
+                systematic.weight = weightMember(systematic.weightBranch);
+            }
+            if (entry["generatorWeight" + direction]) {
+                systematic.generatorWeightBranch = entry["generatorWeight" + direction].as<std::string>();
+                systematic.generatorWeight = weightMember(systematic.generatorWeightBranch);
+            }
+            systematics_.emplace_back(systematic);
+        }
+    }
+}
+
+std::vector<std::string> SystematicsRegistry::weightBranches(const int mask) const {
+    std::vector<std::string> branches;
+    for (size_t i{0}; i < systematics_.size(); i++) {
+        if (!runs(i, mask, true)) {
+            continue;
+        }
+        if (systematics_[i].weight) {
+            branches.emplace_back(systematics_[i].weightBranch);
+        }
+        if (systematics_[i].generatorWeight) {
+            branches.emplace_back(systematics_[i].generatorWeightBranch);
+        }
+    }
+    return branches;
+}